@@ -15,6 +15,10 @@ class TRANSFORMATIONS_API ConvertPagedAttnInputs;
 /**
  * @ingroup ov_transformation_common_api
  * @brief Set precision and shape of KV cache in PagedAttn op based runtime options
+ *
+ * The "key_cache_precision"/"value_cache_precision" (element type string) and the
+ * "key_cache_quant_bychannel"/"value_cache_quant_bychannel" (bool) rt_info of the PagedAttn op override
+ * the corresponding options of KVCacheConfig for this op only, e.g. to keep a layer in a higher precision.
  */
 
 class ConvertPagedAttnInputs : public ov::pass::MatcherPass {
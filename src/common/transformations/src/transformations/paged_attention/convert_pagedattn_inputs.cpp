@@ -6,6 +6,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <string>
 
 #include "itt.hpp"
 #include "openvino/core/rt_info.hpp"
@@ -80,9 +81,26 @@ ConvertPagedAttnInputs::ConvertPagedAttnInputs(const KVCacheConfig& config,
 
                 return block_shape;
             };
-            auto key_cache_precision = format_cache_precision(m_config.keyCachePrecision, m_config.inferencePrecision);
+            // the per layer cache precisions set by the plugin policy override the model-wide ones
+            const auto& rt_info = pa_op->get_rt_info();
+            auto get_cache_precision = [&](const std::string& rt_key, ov::element::Type precision) {
+                const auto it = rt_info.find(rt_key);
+                return it == rt_info.end() ? precision : ov::element::Type(it->second.as<std::string>());
+            };
+            auto get_quant_bychannel = [&](const std::string& rt_key, bool bychannel) {
+                const auto it = rt_info.find(rt_key);
+                return it == rt_info.end() ? bychannel : it->second.as<bool>();
+            };
+            auto key_cache_precision =
+                format_cache_precision(get_cache_precision("key_cache_precision", m_config.keyCachePrecision),
+                                       m_config.inferencePrecision);
             auto value_cache_precision =
-                format_cache_precision(m_config.valueCachePrecision, m_config.inferencePrecision);
+                format_cache_precision(get_cache_precision("value_cache_precision", m_config.valueCachePrecision),
+                                       m_config.inferencePrecision);
+            const auto key_quant_bychannel =
+                get_quant_bychannel("key_cache_quant_bychannel", m_config.keyCacheQuantBychannel);
+            const auto value_quant_bychannel =
+                get_quant_bychannel("value_cache_quant_bychannel", m_config.valueCacheQuantBychannel);
             key_cache->set_element_type(key_cache_precision);
             value_cache->set_element_type(value_cache_precision);
             enable_keep_const_precision(key_cache);
@@ -94,14 +112,14 @@ ConvertPagedAttnInputs::ConvertPagedAttnInputs(const KVCacheConfig& config,
                                                               m_config.keyCacheBlockSize,
                                                               key_cache_precision,
                                                               m_config.keyCacheGroupSize,
-                                                              m_config.keyCacheQuantBychannel,
+                                                              key_quant_bychannel,
                                                               m_config.keyCacheDimOrder);
                 const auto value_cache_shape = init_cache_shape(pa_op->get_rt_info()["num_v_heads"].as<size_t>(),
                                                                 pa_op->get_rt_info()["v_head_size"].as<size_t>(),
                                                                 m_config.valueCacheBlockSize,
                                                                 value_cache_precision,
                                                                 m_config.valueCacheGroupSize,
-                                                                m_config.valueCacheQuantBychannel,
+                                                                value_quant_bychannel,
                                                                 m_config.valueCacheDimOrder);
 
                 key_cache->set_partial_shape(key_cache_shape);
@@ -16,5 +16,13 @@ namespace runtime {
  */
 size_t compute_hash(const void* src, size_t size);
 
+/**
+ * @brief Computes the hash value for the input data, the large data is split into chunks which are hashed in parallel
+ * @param src  A pointer to the input data
+ * @param size The length of the input data in bytes
+ * @return The same value as compute_hash() if the data fits into one chunk
+ */
+size_t compute_hash_in_chunks(const void* src, size_t size);
+
 }  // namespace runtime
 }  // namespace ov
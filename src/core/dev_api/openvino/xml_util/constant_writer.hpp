@@ -7,6 +7,7 @@
 #include <iostream>
 #include <map>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 #include "openvino/core/attribute_visitor.hpp"
@@ -20,6 +21,7 @@ public:
     using FilePosition = int64_t;
     using HashValue = size_t;
     using ConstWritePositions = std::multimap<HashValue, std::pair<FilePosition, const void*>>;
+    using DataHashes = std::unordered_map<const void*, std::pair<size_t, HashValue>>;
 
     ConstantWriter(std::ostream& bin_data, bool enable_compression = true);
     virtual ~ConstantWriter();
@@ -37,13 +39,21 @@ public:
         return m_data_hash;
     }
 
+    /// @brief Sets the known hashes of the data blobs as {pointer: {size, hash}}, such blobs are not hashed on write.
+    void set_known_data_hashes(DataHashes hashes) {
+        m_known_data_hashes = std::move(hashes);
+    }
+
 private:
     static std::unique_ptr<char[]> compress_data_to_fp16(const char* ptr,
                                                          size_t size,
                                                          const element::Type& src_type,
                                                          size_t& compressed_size);
 
+    HashValue get_hash(const char* ptr, size_t size) const;
+
     ConstWritePositions m_hash_to_file_positions;
+    DataHashes m_known_data_hashes;
     std::vector<std::vector<char>> m_packed_string_data;
     std::reference_wrapper<std::ostream> m_binary_output;
     bool m_enable_compression;
@@ -275,6 +275,11 @@ public:
 
     bool get_all_data_elements_bitwise_identical() const;
 
+    /// \brief Returns the hash of the constant data. The hash of the data allocated by the constant is computed on
+    /// the first call and reused by the next calls and by the copies of the constant which share the data. The hash of
+    /// the shared data (e.g. of ov::Tensor) is computed on every call, since its owner may change the data.
+    size_t get_data_hash() const;
+
     std::string convert_value_to_string(size_t index) const;
 
     /**
@@ -391,6 +396,8 @@ private:
     std::shared_ptr<ov::AlignedBuffer> m_data{};
     mutable std::atomic_bool m_all_elements_bitwise_identical{false};
     mutable std::atomic_bool m_all_elements_bitwise_identical_checked{false};
+    mutable std::atomic<size_t> m_data_hash{0};
+    mutable std::atomic_bool m_data_hash_computed{false};
     bool m_alloc_buffer_on_visit_attributes{true};
 
     friend struct ov::weight_sharing::Extension;
@@ -19,6 +19,17 @@ namespace pass {
 class OPENVINO_API ConstantFolding : public ModelPass {
 public:
     OPENVINO_MODEL_PASS_RTTI("ConstantFolding");
+
+    ConstantFolding() = default;
+
+    /// \brief Constructs the pass which evaluates independent elementwise, Convert, Reshape and Transpose nodes
+    /// with constant inputs concurrently, e.g. the weights decompression sub-graphs. The folded values are the same
+    /// as in the sequential mode.
+    /// \param parallel                   Enables the concurrent evaluation.
+    /// \param max_parallel_folding_size  Limits the total size in bytes of the values which are evaluated
+    ///                                   concurrently and kept until they replace the original nodes.
+    explicit ConstantFolding(bool parallel, size_t max_parallel_folding_size = 256 * 1024 * 1024);
+
     bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
 
 protected:
@@ -26,6 +37,10 @@ protected:
     /// \brief Folds pre-calculated output tensor values to constants in case lower and
     /// upper estimations are equal. Traverses graph backwards starting from the results.
     bool pre_calculated_values_folding(const std::shared_ptr<ov::Model>& model);
+
+private:
+    bool m_parallel = false;
+    size_t m_max_parallel_folding_size = 0;
 };
 
 /**
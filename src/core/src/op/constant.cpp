@@ -8,6 +8,7 @@
 #include <cstdio>
 #include <cstring>
 #include <sstream>
+#include <typeinfo>
 
 #include "compare.hpp"
 #include "element_visitor.hpp"
@@ -21,6 +22,7 @@
 #include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/reference/convert.hpp"
 #include "openvino/reference/utils/type_util.hpp"
+#include "openvino/runtime/compute_hash.hpp"
 #include "openvino/runtime/shared_buffer.hpp"
 #include "openvino/runtime/string_aligned_buffer.hpp"
 #include "openvino/runtime/tensor.hpp"
@@ -347,6 +349,8 @@ Constant::Constant(const Constant& other)
       m_data{other.m_data},
       m_all_elements_bitwise_identical{other.m_all_elements_bitwise_identical.load()},
       m_all_elements_bitwise_identical_checked{other.m_all_elements_bitwise_identical_checked.load()},
+      m_data_hash{other.m_data_hash.load()},
+      m_data_hash_computed{other.m_data_hash_computed.load()},
       m_alloc_buffer_on_visit_attributes{other.m_alloc_buffer_on_visit_attributes} {
     constructor_validate_and_infer_types();
 }
@@ -357,7 +361,9 @@ Constant::Constant(const Constant& other, const Shape& new_shape)
       m_byte_strides{calc_byte_strides(m_shape, m_element_type)},
       m_data{other.m_data},
       m_all_elements_bitwise_identical{other.m_all_elements_bitwise_identical.load()},
-      m_all_elements_bitwise_identical_checked{other.m_all_elements_bitwise_identical_checked.load()} {
+      m_all_elements_bitwise_identical_checked{other.m_all_elements_bitwise_identical_checked.load()},
+      m_data_hash{other.m_data_hash.load()},
+      m_data_hash_computed{other.m_data_hash_computed.load()} {
     const auto new_size = shape_size(new_shape);
     const auto other_size = shape_size(other.m_shape);
     OPENVINO_ASSERT(other_size == new_size, "ov::Shape size ", new_size, " is not equal to ", other_size);
@@ -595,6 +601,7 @@ bool Constant::visit_attributes(AttributeVisitor& visitor) {
         visitor.on_attribute("value", m_data);
     }
     update_identical_flags(false, false);
+    m_data_hash_computed = false;
     return true;
 }
 
@@ -605,6 +612,20 @@ bool Constant::get_all_data_elements_bitwise_identical() const {
     return m_all_elements_bitwise_identical;
 }
 
+size_t Constant::get_data_hash() const {
+    OPENVINO_ASSERT(m_element_type != element::string, "Data hash is not supported for string constants");
+    // The shared buffers (e.g. of the tensors or the mapped files) may be changed by their owners at any time,
+    // only the buffer allocated by the constant is written by the constant alone.
+    if (!m_data || typeid(*m_data) != typeid(ov::AlignedBuffer)) {
+        return ov::runtime::compute_hash_in_chunks(get_data_ptr(), get_byte_size());
+    }
+    if (!m_data_hash_computed) {
+        m_data_hash = ov::runtime::compute_hash_in_chunks(get_data_ptr(), get_byte_size());
+        m_data_hash_computed = true;
+    }
+    return m_data_hash;
+}
+
 void Constant::alloc_buffer_on_visit_attributes(bool val) {
     m_alloc_buffer_on_visit_attributes = val;
 }
@@ -6,11 +6,15 @@
 
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/constant_fold_utils.hpp"
+#include "openvino/core/memory_util.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/rt_info.hpp"
 #include "openvino/core/rt_info/weightless_caching_attributes.hpp"
 #include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/transpose.hpp"
 #include "openvino/op/util/op_types.hpp"
 #include "openvino/op/util/read_value_base.hpp"
 #include "openvino/op/util/shape_of_base.hpp"
@@ -102,15 +106,158 @@ static void remove_requires_precision_conversion_attribute(const std::shared_ptr
     }
 }
 
+/**
+ * \brief Check if the node can be folded concurrently with other nodes.
+ *
+ * Evaluation of the accepted ops only reads the input constants and the folding doesn't need any graph changes
+ * before the evaluation (precision conversion or restoration of the original input precision).
+ *
+ * \param node  Node to check.
+ *
+ * \return true if node can be folded concurrently otherwise false.
+ */
+static bool is_parallel_foldable(const std::shared_ptr<ov::Node>& node) {
+    if (!ov::op::util::is_unary_elementwise_arithmetic(node) && !ov::op::util::is_binary_elementwise_arithmetic(node) &&
+        !ov::is_type<ov::op::v0::Convert>(node) && !ov::is_type<ov::op::v1::Reshape>(node) &&
+        !ov::is_type<ov::op::v1::Transpose>(node)) {
+        return false;
+    }
+    if (node_has_requires_precision_conversion_attribute(node)) {
+        return false;
+    }
+    for (const auto& input : node->inputs()) {
+        if (!ov::is_type<ov::op::v0::Constant>(input.get_source_output().get_node()) ||
+            ov::util::has_original_input_precision(input)) {
+            return false;
+        }
+    }
+    for (const auto& output : node->outputs()) {
+        if (output.get_element_type().is_dynamic() || output.get_partial_shape().is_dynamic()) {
+            return false;
+        }
+    }
+    return node->can_constant_fold(node->input_values());
+}
+
+static size_t get_folded_size(const std::shared_ptr<ov::Node>& node) {
+    size_t size = 0;
+    for (const auto& output : node->outputs()) {
+        size += ov::util::get_memory_size(output.get_element_type(), ov::shape_size(output.get_shape()));
+    }
+    return size;
+}
+
+ov::pass::ConstantFolding::ConstantFolding(bool parallel, size_t max_parallel_folding_size)
+    : m_parallel(parallel),
+      m_max_parallel_folding_size(max_parallel_folding_size) {}
+
 bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(ConstantFolding);
 
     bool rewritten = pre_calculated_values_folding(model);
 
+    auto replace_with_folded = [this](const std::shared_ptr<Node>& original_node,
+                                      const std::shared_ptr<Node>& node,
+                                      const OutputVector& replacements) {
+        OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
+                        "Node folded but constant folding disabled. Check constant_fold implementation for ",
+                        node);
+        OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
+                        "constant_fold_default returned incorrect number of replacements for ",
+                        node);
+
+        bool replaced = false;
+        for (size_t i = 0; i < replacements.size(); ++i) {
+            auto node_output = original_node->output(i);
+            const auto& replacement = replacements.at(i);
+            auto replacement_ptr = replacement.get_node_shared_ptr();
+            if (replacement_ptr && (node_output != replacement)) {
+                replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
+
+                node_output.replace(replacement);
+                // Copy runtime info from source nodes
+                // when it was not propogated during pre-calculation
+                copy_runtime_info_from_input_values(original_node);
+                // Propagate runtime info attributes to replacement
+                copy_runtime_info(original_node, replacement_ptr);
+                ov::copy_weightless_cache_attr(original_node, replacement_ptr);
+                // Evict data if original node is constant or convert with constant input
+                if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(original_node)) {
+                    ov::wsh::Extension::hint_evict(*constant);
+                } else if (auto convert = ov::as_type_ptr<ov::op::v0::Convert>(original_node)) {
+                    if (auto const_input = ov::as_type<ov::op::v0::Constant>(convert->get_input_node_ptr(0))) {
+                        ov::wsh::Extension::hint_evict(*const_input);
+                    }
+                }
+
+                replaced = true;
+            }
+        }
+        return replaced;
+    };
+
+    // Evaluates the nodes which are ready to be folded concurrently, starting from the node at the position 'begin'.
+    // The nodes are taken in topological order until the size of the folded values exceeds the limit, so the rest
+    // nodes between them see the same graph when they are processed as in the sequential mode.
+    auto fold_in_parallel = [&](NodeVector& nodes, size_t begin) {
+        std::vector<size_t> batch;
+        size_t batch_size = 0;
+        for (size_t n = begin; n < nodes.size(); ++n) {
+            if (!nodes[n] || !is_parallel_foldable(nodes[n])) {
+                continue;
+            }
+            const auto folded_size = get_folded_size(nodes[n]);
+            if (!batch.empty() && batch_size + folded_size > m_max_parallel_folding_size) {
+                break;
+            }
+            if (rewritten) {
+                nodes[n]->validate_and_infer_types();
+            }
+            batch.push_back(n);
+            batch_size += folded_size;
+        }
+
+        std::vector<OutputVector> replacements(batch.size());
+        std::vector<char> folded(batch.size(), false);
+        std::vector<std::exception_ptr> errors(batch.size());
+        ov::parallel_for(batch.size(), [&](size_t i) {
+            const auto& node = nodes[batch[i]];
+            try {
+                replacements[i].resize(node->get_output_size());
+                folded[i] = node->constant_fold(replacements[i], node->input_values());
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+
+        for (size_t i = 0; i < batch.size(); ++i) {
+            if (errors[i]) {
+                std::rethrow_exception(errors[i]);
+            }
+            // Release the original node with its inputs as soon as it's replaced to reduce memory peak.
+            auto original_node = std::move(nodes[batch[i]]);
+            if (folded[i]) {
+                rewritten = replace_with_folded(original_node, original_node, replacements[i]) || rewritten;
+            } else if (restore_original_input_precision(original_node)) {
+                original_node->validate_and_infer_types();
+                rewritten = true;
+            }
+            replacements[i].clear();
+        }
+    };
+
     // Creating a local vector and moving each element to reduce memory peak.
     // Elements of 'nodes' vector are nullptr after the std::move in the loop.
     auto nodes = model->get_ordered_ops();
     for (size_t n = 0; n < nodes.size(); ++n) {
+        if (!nodes[n]) {
+            // the node has been already folded in parallel
+            continue;
+        }
+        if (m_parallel && is_parallel_foldable(nodes[n])) {
+            fold_in_parallel(nodes, n);
+            continue;
+        }
         auto original_node = std::move(nodes[n]);
         auto node = original_node;
         if (!original_node->can_constant_fold(original_node->input_values())) {
@@ -141,39 +288,7 @@ bool ov::pass::ConstantFolding::run_on_model(const std::shared_ptr<ov::Model>& m
 
         OutputVector replacements(node->get_output_size());
         if (node->constant_fold(replacements, node->input_values())) {
-            OPENVINO_ASSERT(!constant_folding_is_disabled(original_node),
-                            "Node folded but constant folding disabled. Check constant_fold implementation for ",
-                            node);
-            OPENVINO_ASSERT(replacements.size() == node->get_output_size(),
-                            "constant_fold_default returned incorrect number of replacements for ",
-                            node);
-
-            for (size_t i = 0; i < replacements.size(); ++i) {
-                auto node_output = original_node->output(i);
-                const auto& replacement = replacements.at(i);
-                auto replacement_ptr = replacement.get_node_shared_ptr();
-                if (replacement_ptr && (node_output != replacement)) {
-                    replacement_ptr->set_friendly_name(friendly_name_from(*original_node, replacements.size(), i));
-
-                    node_output.replace(replacement);
-                    // Copy runtime info from source nodes
-                    // when it was not propogated during pre-calculation
-                    copy_runtime_info_from_input_values(original_node);
-                    // Propagate runtime info attributes to replacement
-                    copy_runtime_info(original_node, replacement_ptr);
-                    ov::copy_weightless_cache_attr(original_node, replacement_ptr);
-                    // Evict data if original node is constant or convert with constant input
-                    if (auto constant = ov::as_type_ptr<ov::op::v0::Constant>(original_node)) {
-                        ov::wsh::Extension::hint_evict(*constant);
-                    } else if (auto convert = ov::as_type_ptr<ov::op::v0::Convert>(original_node)) {
-                        if (auto const_input = ov::as_type<ov::op::v0::Constant>(convert->get_input_node_ptr(0))) {
-                            ov::wsh::Extension::hint_evict(*const_input);
-                        }
-                    }
-
-                    rewritten = true;
-                }
-            }
+            rewritten = replace_with_folded(original_node, node, replacements) || rewritten;
         } else {
             // if CF was unsuccessful remove original precision attribute from inputs
             bool restored = restore_original_input_precision(original_node);
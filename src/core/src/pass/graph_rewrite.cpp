@@ -9,6 +9,7 @@
 #include <iostream>
 #include <regex>
 #include <string>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -175,8 +176,9 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         return status;
     };
 
-    // list of matchers to run for a node; define here to keep memory allocated
-    std::vector<size_t> matcher_passes_to_run;
+    // lists of matchers to run for the node types which have been already processed, as the model usually has
+    // many nodes of the same type and the list is collected over all parents of the type
+    std::unordered_map<const DiscreteTypeInfo*, std::vector<size_t>> type_to_matchers_to_run;
 
     while (!nodes_to_run.empty()) {
         auto weak_node = nodes_to_run.front();
@@ -203,25 +205,25 @@ bool ov::pass::GraphRewrite::apply_matcher_passes(std::shared_ptr<Model> f,
         // If all Matchers in MatcherPasses has type based root node then we apply efficient
         // algorithm for finding matchers
         if (all_roots_has_type) {
-            const DiscreteTypeInfo* node_type_info = &node->get_type_info();
-            matcher_passes_to_run.clear();
-            while (node_type_info) {
-                auto matchers = type_to_matcher.find(*node_type_info);
-                if (matchers != type_to_matcher.end()) {
-                    // do not run found matchers immediately, need to collect all matchers for
-                    // parents
-                    // and sort them in order of the registration
-                    matcher_passes_to_run.insert(matcher_passes_to_run.end(),
-                                                 matchers->second.begin(),
-                                                 matchers->second.end());
+            auto matchers_to_run = type_to_matchers_to_run.emplace(&node->get_type_info(), std::vector<size_t>{});
+            auto& matcher_passes_to_run = matchers_to_run.first->second;
+            if (matchers_to_run.second) {
+                const DiscreteTypeInfo* node_type_info = &node->get_type_info();
+                while (node_type_info) {
+                    auto matchers = type_to_matcher.find(*node_type_info);
+                    if (matchers != type_to_matcher.end()) {
+                        // do not run found matchers immediately, need to collect all matchers for
+                        // parents
+                        // and sort them in order of the registration
+                        matcher_passes_to_run.insert(matcher_passes_to_run.end(),
+                                                     matchers->second.begin(),
+                                                     matchers->second.end());
+                    }
+                    node_type_info = node_type_info->parent;
                 }
-                node_type_info = node_type_info->parent;
-            }
-
-            std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
 
-            // TODO: type_to_matcher with just collected list of matchers to enable
-            // fast processing at the next time when node with the same type will be processed
+                std::sort(matcher_passes_to_run.begin(), matcher_passes_to_run.end());
+            }
 
             for (size_t matcher_index : matcher_passes_to_run) {
                 if (run_matcher_pass(m_matchers[matcher_index], node)) {
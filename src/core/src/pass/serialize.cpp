@@ -17,6 +17,7 @@
 #include "openvino/core/model_util.hpp"
 #include "openvino/core/parallel.hpp"
 #include "openvino/core/type/float16.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/pass/constant_folding.hpp"
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/runtime/compute_hash.hpp"
@@ -315,6 +316,18 @@ bool pass::Hash::run_on_model(const std::shared_ptr<ov::Model>& model) {
     // Determinism is important for hash calculation
     // If skip weights set, disable compression to skip internal data hashing
     auto constant_writer = util::ConstantWriter(bin, !m_skip_weights);
+    if (!m_skip_weights) {
+        // Constants memoize the hashes of their data, so the weights are read only by the first hash calculation
+        util::ConstantWriter::DataHashes data_hashes;
+        for (const auto& node : model->get_ordered_ops()) {
+            if (const auto constant = ov::as_type_ptr<op::v0::Constant>(node);
+                constant && constant->get_element_type() != element::string) {
+                data_hashes.emplace(constant->get_data_ptr(),
+                                    std::make_pair(constant->get_byte_size(), constant->get_data_hash()));
+            }
+        }
+        constant_writer.set_known_data_hashes(std::move(data_hashes));
+    }
     serialize_func(xml, bin, model, Serialize::Version::UNSPECIFIED, true, constant_writer);
 
     auto seed = util::u64_hash_combine(0, xml_hash.get_result());
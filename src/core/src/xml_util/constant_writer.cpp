@@ -38,12 +38,12 @@ ConstantWriter::FilePosition ConstantWriter::write(const char* ptr,
         // the same hash for {2, 2} and {0, 128} arrays.
         // But even strong hashing algorithms sometimes give collisions.
         // Therefore we always have to compare values when finding a match in the hash multimap.
-        const HashValue hash = ov::runtime::compute_hash(data_ptr, new_size);
+        const HashValue hash = get_hash(data_ptr, new_size);
 
         const auto found = m_hash_to_file_positions.equal_range(hash);
         // iterate over all matches of the key in the multimap
         for (auto it = found.first; it != found.second; ++it) {
-            if (memcmp(ptr, it->second.second, size) == 0) {
+            if (ptr == it->second.second || memcmp(ptr, it->second.second, size) == 0) {
                 return it->second.first;
             }
         }
@@ -74,7 +74,7 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
             dst += sv.size();
         }
 
-        const HashValue hash = ov::runtime::compute_hash(tmp.data(), new_size);
+        const HashValue hash = ov::runtime::compute_hash_in_chunks(tmp.data(), new_size);
         const auto found = m_hash_to_file_positions.equal_range(hash);
         for (auto it = found.first; it != found.second; ++it) {
             if (memcmp(tmp.data(), it->second.second, new_size) == 0) {
@@ -101,6 +101,14 @@ ConstantWriter::FilePosition ConstantWriter::write(const std::vector<std::string
     }
 }
 
+ConstantWriter::HashValue ConstantWriter::get_hash(const char* ptr, size_t size) const {
+    if (const auto known = m_known_data_hashes.find(ptr);
+        known != m_known_data_hashes.end() && known->second.first == size) {
+        return known->second.second;
+    }
+    return ov::runtime::compute_hash_in_chunks(ptr, size);
+}
+
 std::unique_ptr<char[]> ConstantWriter::compress_data_to_fp16(const char* ptr,
                                                               size_t size,
                                                               const element::Type& src_type,
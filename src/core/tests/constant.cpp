@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include <memory>
+#include <numeric>
 #include <optional>
 #include <string_view>
 #include <variant>
@@ -2799,6 +2800,37 @@ TEST(constant, create_with_zero_dim_shape) {
     EXPECT_EQ(c.get_byte_size(), 0);
 }
 
+TEST(constant, data_hash) {
+    // the data is larger than one chunk of the parallel hash calculation
+    std::vector<float> values(5 * 1024 * 1024);
+    std::iota(values.begin(), values.end(), 0.f);
+    auto c1 = ov::op::v0::Constant(element::f32, Shape{values.size()}, values);
+    auto c2 = ov::op::v0::Constant(element::f32, Shape{values.size()}, values);
+    values.back() = -1.f;
+    auto c3 = ov::op::v0::Constant(element::f32, Shape{values.size()}, values);
+
+    const auto hash = c1.get_data_hash();
+    EXPECT_EQ(c1.get_data_hash(), hash);
+    EXPECT_EQ(c2.get_data_hash(), hash);
+    EXPECT_NE(c3.get_data_hash(), hash);
+    EXPECT_EQ(ov::op::v0::Constant(c1, Shape{values.size() / 2, 2}).get_data_hash(), hash);
+
+    auto string_constant = ov::op::v0::Constant(element::string, Shape{1}, std::vector<std::string>{"a"});
+    OV_EXPECT_THROW(string_constant.get_data_hash(), ov::Exception, HasSubstr("not supported for string constants"));
+}
+
+TEST(constant, data_hash_of_shared_data) {
+    auto tensor = ov::Tensor(element::f32, Shape{4});
+    std::iota(tensor.data<float>(), tensor.data<float>() + tensor.get_size(), 0.f);
+    const auto c = ov::op::v0::Constant(tensor);
+
+    const auto hash = c.get_data_hash();
+    tensor.data<float>()[0] = -1.f;
+    EXPECT_NE(c.get_data_hash(), hash);
+    tensor.data<float>()[0] = 0.f;
+    EXPECT_EQ(c.get_data_hash(), hash);
+}
+
 using ConstantInputValue = std::variant<bool,
                                         char,
                                         signed char,
@@ -4158,4 +4158,46 @@ TEST(constant_folding, loop_with_node_which_has_no_evaluate) {
     EXPECT_NO_THROW(pass::ConstantFolding().run_on_model(model));
     EXPECT_EQ(count_ops_of_type<op::v5::Loop>(model), 1);
 }
+
+TEST(constant_folding, parallel_decompression_subgraphs) {
+    auto make_model = [] {
+        auto data = std::make_shared<op::v0::Parameter>(element::f32, Shape{1, 16});
+        ResultVector results;
+        for (size_t i = 0; i < 8; ++i) {
+            std::vector<uint8_t> weights_values(16 * 32);
+            std::iota(weights_values.begin(), weights_values.end(), static_cast<uint8_t>(i));
+            auto weights = op::v0::Constant::create(element::u8, Shape{32, 16}, weights_values);
+            auto convert = std::make_shared<op::v0::Convert>(weights, element::f32);
+            auto zero_point = op::v0::Constant::create(element::f32, Shape{32, 1}, std::vector<float>(32, 3.f + i));
+            auto subtract = std::make_shared<op::v1::Subtract>(convert, zero_point);
+            auto scale = op::v0::Constant::create(element::f32, Shape{32, 1}, std::vector<float>(32, 0.1f * (i + 1)));
+            auto multiply = std::make_shared<op::v1::Multiply>(subtract, scale);
+            multiply->set_friendly_name("weights_" + std::to_string(i));
+            auto matmul = std::make_shared<op::v0::MatMul>(data, multiply, false, true);
+            results.push_back(std::make_shared<op::v0::Result>(matmul));
+        }
+        return std::make_shared<Model>(results, ParameterVector{data});
+    };
+
+    auto model_ref = make_model();
+    pass::ConstantFolding().run_on_model(model_ref);
+
+    // the small limit makes the pass fold the sub-graphs in several batches
+    auto model = make_model();
+    pass::ConstantFolding(true, 4 * 32 * 16 * sizeof(float)).run_on_model(model);
+
+    ASSERT_EQ(count_ops_of_type<op::v0::Convert>(model), 0);
+    ASSERT_EQ(count_ops_of_type<op::v1::Multiply>(model), 0);
+    for (size_t i = 0; i < model->get_results().size(); ++i) {
+        auto matmul = model->get_results()[i]->get_input_node_shared_ptr(0);
+        auto matmul_ref = model_ref->get_results()[i]->get_input_node_shared_ptr(0);
+        auto weights = ov::as_type_ptr<op::v0::Constant>(matmul->get_input_node_shared_ptr(1));
+        auto weights_ref = ov::as_type_ptr<op::v0::Constant>(matmul_ref->get_input_node_shared_ptr(1));
+        ASSERT_TRUE(weights);
+        ASSERT_TRUE(weights_ref);
+        ASSERT_EQ(weights->get_friendly_name(), weights_ref->get_friendly_name());
+        ASSERT_EQ(weights->get_byte_size(), weights_ref->get_byte_size());
+        ASSERT_EQ(std::memcmp(weights->get_data_ptr(), weights_ref->get_data_ptr(), weights->get_byte_size()), 0);
+    }
+}
 }  // namespace ov::test
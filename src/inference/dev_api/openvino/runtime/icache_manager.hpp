@@ -5,6 +5,7 @@
 #pragma once
 
 #include <clocale>
+#include <filesystem>
 #include <functional>
 #include <iostream>
 #include <string>
@@ -70,6 +71,19 @@ public:
      * @param id Id of cache (hash of the model)
      */
     virtual void remove_cache_entry(const std::string& id) = 0;
+
+    /**
+     * @brief Gets the file to lock the cache entry across processes while it is populated
+     *
+     * Only one of the processes missing the same cache entry simultaneously compiles the model, the others wait for
+     * the entry to be published
+     *
+     * @param id Id of cache (hash of the model)
+     * @return Path to the lock file, empty if the entry already exists or can't be locked across processes
+     */
+    virtual std::filesystem::path get_lock_file(const std::string& id) const {
+        return {};
+    }
 };
 
 /**
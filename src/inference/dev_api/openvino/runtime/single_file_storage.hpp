@@ -4,12 +4,22 @@
 
 #pragma once
 
+#include <mutex>
+#include <shared_mutex>
+
 #include "openvino/core/weight_sharing_util.hpp"
 #include "openvino/runtime/icache_manager.hpp"
 #include "openvino/runtime/tlv_format.hpp"
 #include "openvino/util/ov_version.hpp"
 
 namespace ov::runtime {
+/**
+ * @brief Model cache stored in a single file of TLV records.
+ * The file can be shared by the storages of several processes. They serialize their operations with the lock file
+ * "<file>.lock" and bring their index up to date with the records written by the others before every operation. The
+ * compaction writes a new generation record at the beginning of the file, so the index of the replaced file is
+ * rebuilt instead of using its offsets.
+ */
 class SingleFileStorage final : public ICacheManager, public IContextStore {
 public:
     /** @brief Current version of the single file storage format. */
@@ -19,6 +29,8 @@ public:
         String = 0x02,
         Blob = 0x03,
         BlobMap = 0x04,
+        BlobRemoved = 0x05,
+        Generation = 0x06,
         ConstantMeta = 0x10,
         WeightSource = 0x11,
     };
@@ -42,11 +54,28 @@ public:
 
     /**
      * @brief Remove a cache entry from the storage.
-     * @note This function does nothing - the storage is append-only.
+     * @note The removal record is appended to the file, the blob data stays in the file until compact() is called.
      * @param blob_id The identifier of the blob to be removed.
      */
     void remove_cache_entry(const std::string& blob_id) override;
 
+    /**
+     * @brief Set the limit of the total size of the blobs in the storage.
+     * When the limit is exceeded after writing a blob, the least recently accessed blobs are removed. The accesses are
+     * tracked by each process, the file order is used for the blobs not accessed by this one.
+     * @param max_size The limit in bytes, 0 means no limit.
+     */
+    void set_max_size(uint64_t max_size);
+
+    /**
+     * @brief Rewrite the live records of the storage into a new file which replaces the current one.
+     * It's done automatically after a write or a removal when the removed blobs take more space than the stored ones.
+     * The blobs already memory-mapped by the readers stay valid, they keep the replaced file alive. The other storages
+     * of the file rebuild their index on their next operation.
+     * @return True if the file was replaced, false if it could not be done (e.g. the file is in use on Windows).
+     */
+    bool compact();
+
     /**
      * @brief Write the weight sharing context to the storage.
      * @param context The weight sharing context to be stored.
@@ -69,18 +98,43 @@ public:
 
 private:
     std::filesystem::path m_file_path;
+    std::filesystem::path m_lock_path;
 
     struct BlobInfo {
         uint64_t offset;
         uint64_t size;
         std::string model_name;
+        uint64_t last_access;
     };
     std::unordered_map<BlobIdType, BlobInfo> m_blob_index;
     std::shared_ptr<wsh::Context> m_shared_context;
-    bool build_content_index(std::ifstream& stream);
+    // The generation and the size of the file content in the index.
+    uint64_t m_generation = 0;
+    uint64_t m_indexed_size = 0;
+    // The size of the removed blobs which are still in the file.
+    uint64_t m_removed_size = 0;
+    // The removed size to reach before the next compaction is tried, when the last one could not replace the file.
+    uint64_t m_compaction_retry_size = 0;
+    uint64_t m_max_size = 0;
+    uint64_t m_access_clock = 0;
+    // Readers share the lock while they use the file, writers and compaction hold it exclusively.
+    std::shared_mutex m_mutex;
+    // Guards the index updated by the readers.
+    std::mutex m_index_mutex;
+
+    bool build_content_index(std::istream& stream);
+    void update_content_index();
 
     static BlobIdType convert_blob_id(const std::string& blob_id);
+    static BlobInfo write_blob_records(std::ostream& stream,
+                                       BlobIdType blob_id,
+                                       const StreamWriter& writer,
+                                       std::string model_name);
     void write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer);
+    void write_removal_entry(std::ostream& stream, BlobIdType blob_id);
+    void evict_blobs(std::ostream& stream, BlobIdType written_blob_id);
+    void compact_if_needed();
+    bool compact_file();
     bool has_blob_id(BlobIdType blob_id) const;
 };
 }  // namespace ov::runtime
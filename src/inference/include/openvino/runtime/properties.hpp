@@ -772,6 +772,22 @@ static constexpr Property<std::string> cache_dir{"CACHE_DIR"};
  */
 inline constexpr Property<std::filesystem::path> cache_path{"CACHE_PATH"};
 
+/**
+ * @brief This property limits the total size in bytes of the compiled blobs in the cache file.
+ * @ingroup ov_runtime_cpp_prop_api
+ *
+ * It applies when `cache_path` is a file with the `.bin` extension. When the limit is exceeded after a model is cached,
+ * the least recently used blobs are removed. The file is compacted when the removed blobs take more space than the
+ * stored ones. The limit belongs to the cache file, so it is shared by all the models cached in it.
+ *
+ * The default value 0 means no limit.
+ *
+ * @code
+ * core.set_property(ov::cache_path("cache.bin"), ov::cache_max_size(4ull << 30)); // keeps up to 4 GiB of blobs
+ * @endcode
+ */
+inline constexpr Property<uint64_t, PropertyMutability::RW> cache_max_size{"CACHE_MAX_SIZE"};
+
 /**
  * @brief Read-only property to notify user that compiled model was loaded from the cache
  * @ingroup ov_runtime_cpp_prop_api
@@ -4,8 +4,110 @@
 
 #include "cache_guard.hpp"
 
+#include <thread>
+
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
 namespace ov {
 
+/**
+ * @brief Exclusive lock of the file shared by the processes, the OS releases it if the process terminates
+ * The holder removes the file before releasing the lock, so the lock files are not left in the cache directory
+ */
+class CacheFileLock {
+public:
+    enum class Result { acquired, busy, failed };
+
+    explicit CacheFileLock(std::filesystem::path path) : m_path(std::move(path)) {}
+    CacheFileLock(const CacheFileLock&) = delete;
+    CacheFileLock& operator=(const CacheFileLock&) = delete;
+
+    ~CacheFileLock() {
+        unlock();
+    }
+
+    Result try_lock();
+    void unlock();
+
+private:
+    std::filesystem::path m_path;
+#ifdef _WIN32
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+#else
+    int m_fd = -1;
+#endif
+};
+
+#ifdef _WIN32
+CacheFileLock::Result CacheFileLock::try_lock() {
+    m_handle = CreateFileW(m_path.c_str(),
+                           GENERIC_READ | GENERIC_WRITE | DELETE,
+                           FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                           nullptr,
+                           OPEN_ALWAYS,
+                           FILE_ATTRIBUTE_NORMAL,
+                           nullptr);
+    if (m_handle == INVALID_HANDLE_VALUE) {
+        return Result::failed;
+    }
+    OVERLAPPED overlapped{};
+    if (LockFileEx(m_handle, LOCKFILE_EXCLUSIVE_LOCK | LOCKFILE_FAIL_IMMEDIATELY, 0, 1, 0, &overlapped)) {
+        return Result::acquired;
+    }
+    CloseHandle(m_handle);
+    m_handle = INVALID_HANDLE_VALUE;
+    return Result::busy;
+}
+
+void CacheFileLock::unlock() {
+    if (m_handle != INVALID_HANDLE_VALUE) {
+        FILE_DISPOSITION_INFO disposition{TRUE};
+        SetFileInformationByHandle(m_handle, FileDispositionInfo, &disposition, sizeof(disposition));
+        CloseHandle(m_handle);
+        m_handle = INVALID_HANDLE_VALUE;
+    }
+}
+#else
+CacheFileLock::Result CacheFileLock::try_lock() {
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+        return Result::failed;
+    }
+    // The previous holder may have removed the file after it was opened, then the lock must be taken again
+    struct stat locked_stat {};
+    struct stat path_stat {};
+    if (::flock(m_fd, LOCK_EX | LOCK_NB) == 0 && ::fstat(m_fd, &locked_stat) == 0 &&
+        ::stat(m_path.c_str(), &path_stat) == 0 && locked_stat.st_dev == path_stat.st_dev &&
+        locked_stat.st_ino == path_stat.st_ino) {
+        return Result::acquired;
+    }
+    ::close(m_fd);
+    m_fd = -1;
+    return Result::busy;
+}
+
+void CacheFileLock::unlock() {
+    if (m_fd >= 0) {
+        std::error_code ec;
+        std::filesystem::remove(m_path, ec);
+        ::close(m_fd);
+        m_fd = -1;
+    }
+}
+#endif
+
+//////////////////////////////////////////////////////
+
 CacheGuardEntry::CacheGuardEntry(CacheGuard& cacheGuard,
                                  const std::string& hash,
                                  std::shared_ptr<std::mutex> m,
@@ -20,6 +122,7 @@ CacheGuardEntry::CacheGuardEntry(CacheGuard& cacheGuard,
 
 CacheGuardEntry::~CacheGuardEntry() {
     m_refCount--;
+    m_file_lock.reset();
     m_mutex->unlock();
     m_cacheGuard.check_for_remove(m_hash);
 }
@@ -28,9 +131,32 @@ void CacheGuardEntry::perform_lock() {
     m_mutex->lock();
 }
 
+void CacheGuardEntry::perform_file_lock(const std::filesystem::path& lock_file, std::chrono::milliseconds timeout) {
+    constexpr auto poll_interval = std::chrono::milliseconds(20);
+    const auto deadline = std::chrono::steady_clock::now() + timeout;
+    bool waited = false;
+    while (true) {
+        auto file_lock = std::make_unique<CacheFileLock>(lock_file);
+        const auto result = file_lock->try_lock();
+        if (result == CacheFileLock::Result::acquired && !waited) {
+            // This process populates the cache entry, other processes wait for it
+            m_file_lock = std::move(file_lock);
+            return;
+        }
+        if (result != CacheFileLock::Result::busy || std::chrono::steady_clock::now() >= deadline) {
+            // Another process has released the lock after populating the entry (or failing to do it), the lock
+            // file can't be used or the wait is timed out - continue without the lock
+            return;
+        }
+        waited = true;
+        std::this_thread::sleep_for(poll_interval);
+    }
+}
+
 //////////////////////////////////////////////////////
 
-std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& hash) {
+std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& hash,
+                                                           const std::filesystem::path& lock_file) {
     std::unique_ptr<CacheGuardEntry> res;
     {
         std::unique_lock<std::mutex> lock(m_tableMutex);
@@ -48,6 +174,9 @@ std::unique_ptr<CacheGuardEntry> CacheGuard::get_hash_lock(const std::string& ha
         }
     }
     res->perform_lock();  // in case of exception, 'res' will be destroyed and item will be cleaned up from table
+    if (!lock_file.empty()) {
+        res->perform_file_lock(lock_file, m_file_lock_timeout);
+    }
     return res;
 }
 
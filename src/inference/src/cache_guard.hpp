@@ -11,6 +11,8 @@
  */
 
 #include <atomic>
+#include <chrono>
+#include <filesystem>
 #include <map>
 #include <memory>
 #include <mutex>
@@ -20,6 +22,8 @@
 namespace ov {
 
 class CacheGuard;
+class CacheFileLock;
+
 /**
  * @brief This class represents RAII guard class to protect multiple threads to modify the same cached network
  * Use CacheGuard::getHashLock(hash) to acquire lock for specific cache entry identified by its 'hash'
@@ -47,6 +51,7 @@ public:
      * @brief Destructor, will perform the following cleanup
      *
      * Decrement reference counter
+     * Release the lock file
      * Unlock associated mutex
      * Call CacheGuard::checkForRemove to check if appropriate table hash entry is not used anymore and can be deleted
      */
@@ -60,17 +65,31 @@ public:
      */
     void perform_lock();
 
+    /**
+     * @brief Locks the cache entry across the processes with the lock file
+     * If another process holds the lock, waits until it is released or the timeout expires and continues without the
+     * lock - the cache entry published by that process is read instead of being populated again
+     *
+     * @note Will be called only by CacheGuard after perform_lock(), it shall not be called from client's code
+     *
+     * @param lock_file Path to the lock file of the cache entry
+     * @param timeout Maximum time to wait for another process holding the lock
+     */
+    void perform_file_lock(const std::filesystem::path& lock_file, std::chrono::milliseconds timeout);
+
 private:
     CacheGuard& m_cacheGuard;
     std::string m_hash;
     std::shared_ptr<std::mutex> m_mutex;
     std::atomic_int& m_refCount;
+    std::unique_ptr<CacheFileLock> m_file_lock;
 };
 
 /**
  * @brief This class holds a table of currently locked hashes
  * OpenVINO core will need to obtain a lock for a specific cache to get exclusive access to it
  * It is needed to avoid race situations when multiple threads try to to write to the same cache simultaneously
+ * With the lock file, the cache entry is populated only once by multiple processes starting simultaneously
  *
  * Usage example:
  *     auto hash = <calculate hash for network>;
@@ -81,18 +100,33 @@ private:
  */
 class CacheGuard {
 public:
-    CacheGuard() = default;
+    /**
+     * @brief Default maximum time to wait for another process populating the same cache entry
+     */
+    static constexpr std::chrono::minutes default_file_lock_timeout{10};
+
+    /**
+     * @brief Constructor
+     *
+     * @param file_lock_timeout Maximum time to wait for another process populating the same cache entry
+     */
+    explicit CacheGuard(std::chrono::milliseconds file_lock_timeout = default_file_lock_timeout)
+        : m_file_lock_timeout(file_lock_timeout) {}
 
     /**
      * @brief Gets a lock for a specific cache entry identified by it's hash value
      * Once returned, client has an exclusive access to cache entry for read/write/delete
      * If any other thread holds a lock to same hash - this function will not return until it is unlocked
+     * If the lock file is given and another process holds it - this function will not return until it is unlocked or
+     * the timeout expires, the lock file is held only if it was not locked by another process
      *
      * @param hash String representing hash of network
+     * @param lock_file Path to the lock file of the cache entry, no lock across the processes if empty
      *
      * @return RAII pointer to CacheGuardEntry
      */
-    std::unique_ptr<CacheGuardEntry> get_hash_lock(const std::string& hash);
+    std::unique_ptr<CacheGuardEntry> get_hash_lock(const std::string& hash,
+                                                   const std::filesystem::path& lock_file = {});
 
     /**
      * @brief Checks whether there is any clients holding the lock after CacheGuardEntry deletion
@@ -119,6 +153,7 @@ private:
     };
     std::mutex m_tableMutex;
     std::unordered_map<std::string, Item> m_table;
+    std::chrono::milliseconds m_file_lock_timeout;
 };
 
 }  // namespace ov
@@ -12,6 +12,7 @@
 #include <filesystem>
 #include <fstream>
 #include <functional>
+#include <random>
 #include <string>
 #include <variant>
 
@@ -28,6 +29,7 @@ namespace ov {
  * @brief File storage-based Implementation of ICacheManager
  *
  * Uses simple file for read/write cached models.
+ * The blob is written to a temporary file and renamed, so partially written blobs are never observed by readers.
  *
  */
 class FileStorageCacheManager final : public ICacheManager {
@@ -51,20 +53,31 @@ private:
         // Fix the bug caused by pugixml, which may return unexpected results if the locale is different from "C".
         ScopedLocale plocal_C(LC_ALL, "C");
         const auto blob_path = get_blob_file(id);
+        // Unique name, the same entry may be written by other processes
+        auto temp_path = blob_path;
+        temp_path += "." + std::to_string(std::random_device{}()) + ".tmp";
 
-        if (ov::util::file_exists(blob_path)) {
-            std::filesystem::permissions(blob_path,
-                                         std::filesystem::perms::owner_write,
-                                         std::filesystem::perm_options::add);
-        }
+        try {
+            std::ofstream stream;
+            stream.exceptions(std::ios_base::failbit | std::ios_base::badbit);
+            stream.open(temp_path, std::ios_base::binary);
+            writer(stream);
+            stream.close();
+            std::filesystem::permissions(temp_path,
+                                         std::filesystem::perms::owner_read | std::filesystem::perms::group_read);
 
-        std::ofstream stream;
-        stream.exceptions(std::ios_base::failbit | std::ios_base::badbit);
-        stream.open(blob_path, std::ios_base::binary);
-        writer(stream);
-        stream.close();
-        std::filesystem::permissions(blob_path,
-                                     std::filesystem::perms::owner_read | std::filesystem::perms::group_read);
+            // Read-only file can't be replaced on Windows
+            if (ov::util::file_exists(blob_path)) {
+                std::filesystem::permissions(blob_path,
+                                             std::filesystem::perms::owner_write,
+                                             std::filesystem::perm_options::add);
+            }
+            std::filesystem::rename(temp_path, blob_path);
+        } catch (...) {
+            std::error_code ec;
+            std::filesystem::remove(temp_path, ec);
+            throw;
+        }
     }
 
     void read_cache_entry(const std::string& id, bool enable_mmap, StreamReader reader) override {
@@ -90,5 +103,13 @@ private:
             std::ignore = std::filesystem::remove(blob_path);
         }
     }
+
+    std::filesystem::path get_lock_file(const std::string& id) const override {
+        auto blob_path = get_blob_file(id);
+        if (ov::util::file_exists(blob_path)) {
+            return {};  // already published, it's read without locking
+        }
+        return blob_path += ".lock";
+    }
 };
 }  // namespace ov
@@ -214,6 +214,7 @@ static const auto core_properties_names = ov::util::make_array(ov::cache_dir.nam
                                                                ov::cache_path.name(),
                                                                ov::cache_model_path.name(),
                                                                ov::cache_blob_id.name(),
+                                                               ov::cache_max_size.name(),
                                                                ov::enable_mmap.name(),
                                                                ov::force_tbb_terminate.name());
 
@@ -885,7 +886,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
             return ModelCache::compute_hash(model, cache_content.m_model_path, compiled_config);
         });
         cache_content.model = model;
-        const auto lock = m_cache_guard.get_hash_lock(cache_content.m_blob_id);
+        const auto lock =
+            m_cache_guard.get_hash_lock(cache_content.m_blob_id,
+                                        cache_content.m_cache_manager->get_lock_file(cache_content.m_blob_id));
         compiled_model = load_model_from_cache(cache_content, plugin, parsed.m_config, {}, [&]() {
             return compile_model_and_cache(plugin, model, parsed.m_config, {}, cache_content);
         });
@@ -925,7 +928,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::shared_ptr<
         });
         cache_content.model = model;
 
-        const auto lock = m_cache_guard.get_hash_lock(cache_content.m_blob_id);
+        const auto lock =
+            m_cache_guard.get_hash_lock(cache_content.m_blob_id,
+                                        cache_content.m_cache_manager->get_lock_file(cache_content.m_blob_id));
         compiled_model = load_model_from_cache(cache_content, plugin, parsed.m_config, context, [&]() {
             return compile_model_and_cache(plugin, model, parsed.m_config, context, cache_content);
         });
@@ -957,7 +962,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::filesystem:
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
             return ModelCache::compute_hash(cache_content.m_model_path, create_compile_config(plugin, parsed.m_config));
         });
-        const auto lock = m_cache_guard.get_hash_lock(cache_content.m_blob_id);
+        const auto lock =
+            m_cache_guard.get_hash_lock(cache_content.m_blob_id,
+                                        cache_content.m_cache_manager->get_lock_file(cache_content.m_blob_id));
         compiled_model = load_model_from_cache(cache_content, plugin, parsed.m_config, {}, [&]() {
             const auto model =
                 util::read_model(model_path, "", get_extensions_copy(), parsed.m_core_config.get_enable_mmap());
@@ -989,7 +996,9 @@ ov::SoPtr<ov::ICompiledModel> ov::CoreImpl::compile_model(const std::string& mod
         cache_content.m_blob_id = get_blob_id_or_compute(config, [&] {
             return ModelCache::compute_hash(model_str, weights, create_compile_config(plugin, parsed.m_config));
         });
-        const auto lock = m_cache_guard.get_hash_lock(cache_content.m_blob_id);
+        const auto lock =
+            m_cache_guard.get_hash_lock(cache_content.m_blob_id,
+                                        cache_content.m_cache_manager->get_lock_file(cache_content.m_blob_id));
         compiled_model = load_model_from_cache(cache_content, plugin, parsed.m_config, {}, [&]() {
             const auto model = read_model(model_str, weights);
             return compile_model_and_cache(plugin, model, parsed.m_config, {}, cache_content);
@@ -1297,6 +1306,8 @@ ov::Any ov::CoreImpl::get_property_for_core(const std::string& name) const {
     } else if (name == ov::enable_mmap.name()) {
         const auto flag = m_core_config.get_enable_mmap();
         return decltype(ov::enable_mmap)::value_type(flag);
+    } else if (name == ov::cache_max_size.name()) {
+        return decltype(ov::cache_max_size)::value_type(m_core_config.get_cache_max_size());
     }
 
     OPENVINO_THROW("Exception is thrown while trying to call get_property with unsupported property: '", name, "'");
@@ -1721,21 +1732,37 @@ ov::CoreConfig::CoreConfig(const CoreConfig& other) {
         std::lock_guard<std::mutex> lock(other.m_cache_config_mutex);
         m_cache_config = other.m_cache_config;
         m_devices_cache_config = other.m_devices_cache_config;
+        m_cache_max_size = other.m_cache_max_size;
     }
     m_flag_enable_mmap = other.m_flag_enable_mmap;
 }
 
 void ov::CoreConfig::set(const ov::AnyMap& config, const std::string& device_name) {
+    if (const auto cfg_entry = config.find(ov::cache_max_size.name()); cfg_entry != config.end()) {
+        std::lock_guard<std::mutex> lock(m_cache_config_mutex);
+        m_cache_max_size = cfg_entry->second.as<uint64_t>();
+        // the limit belongs to the cache file, it's applied to the files already in use as well
+        const auto set_max_size = [this](const CacheConfig& cache_config) {
+            if (auto storage = std::dynamic_pointer_cast<runtime::SingleFileStorage>(cache_config.m_cache_manager)) {
+                storage->set_max_size(m_cache_max_size);
+            }
+        };
+        set_max_size(m_cache_config);
+        for (const auto& device_cfg : m_devices_cache_config) {
+            set_max_size(device_cfg.second);
+        }
+    }
+
     if (const auto cache_path = get_cache_path_from_config(config); cache_path.has_value()) {
         if (std::lock_guard<std::mutex> lock(m_cache_config_mutex); device_name.empty()) {
             // fill global cache config
-            m_cache_config = CoreConfig::CacheConfig::create(*cache_path);
+            m_cache_config = CoreConfig::CacheConfig::create(*cache_path, m_cache_max_size);
             // sets cache config per-device if it's not set explicitly before
             for (auto& device_cfg : m_devices_cache_config) {
-                device_cfg.second = CoreConfig::CacheConfig::create(*cache_path);
+                device_cfg.second = CoreConfig::CacheConfig::create(*cache_path, m_cache_max_size);
             }
         } else {
-            m_devices_cache_config[device_name] = CoreConfig::CacheConfig::create(*cache_path);
+            m_devices_cache_config[device_name] = CoreConfig::CacheConfig::create(*cache_path, m_cache_max_size);
         }
     }
 
@@ -1768,16 +1795,23 @@ bool ov::CoreConfig::get_enable_mmap() const {
     return m_flag_enable_mmap;
 }
 
+uint64_t ov::CoreConfig::get_cache_max_size() const {
+    std::lock_guard<std::mutex> lock(m_cache_config_mutex);
+    return m_cache_max_size;
+}
+
 ov::CoreConfig::CacheConfig ov::CoreConfig::get_cache_config_for_device(const ov::Plugin& plugin) const {
     std::lock_guard<std::mutex> lock(m_cache_config_mutex);
     return m_devices_cache_config.count(plugin.get_name()) ? m_devices_cache_config.at(plugin.get_name())
                                                            : m_cache_config;
 }
 
-ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::filesystem::path& dir) {
+ov::CoreConfig::CacheConfig ov::CoreConfig::CacheConfig::create(const std::filesystem::path& dir, uint64_t max_size) {
     auto cfg = CacheConfig{dir, nullptr};
     if (dir.extension() == ".bin") {
-        cfg.m_cache_manager = std::make_shared<runtime::SingleFileStorage>(dir);
+        auto storage = std::make_shared<runtime::SingleFileStorage>(dir);
+        storage->set_max_size(max_size);
+        cfg.m_cache_manager = std::move(storage);
     } else if (!dir.empty()) {
         cfg.m_cache_manager = std::make_shared<FileStorageCacheManager>(dir);
     }
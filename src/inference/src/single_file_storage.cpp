@@ -4,15 +4,100 @@
 
 #include "openvino/runtime/single_file_storage.hpp"
 
+#include <algorithm>
+
 #include "openvino/runtime/aligned_buffer.hpp"
 #include "openvino/util/file_util.hpp"
 #include "openvino/util/mmap_object.hpp"
 #include "openvino/util/parallel_read_streambuf.hpp"
 #include "openvino/util/variant_visitor.hpp"
 
+#ifdef _WIN32
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <unistd.h>
+
+#    include <cerrno>
+#endif
+
 namespace ov::runtime {
 
 namespace {
+constexpr uint64_t header_size = 3 * sizeof(uint16_t);  // the version
+
+/**
+ * @brief Lock of the cache file shared by the processes, the OS releases it if the process terminates.
+ * A separate file is locked, since the compaction replaces the cache file. If the lock file can't be opened (e.g. in a
+ * read-only directory), the operation goes on without the lock.
+ */
+class StorageFileLock {
+public:
+    StorageFileLock(const std::filesystem::path& path, bool exclusive);
+    StorageFileLock(const StorageFileLock&) = delete;
+    StorageFileLock& operator=(const StorageFileLock&) = delete;
+    ~StorageFileLock();
+
+private:
+#ifdef _WIN32
+    HANDLE m_handle = INVALID_HANDLE_VALUE;
+#else
+    int m_fd = -1;
+#endif
+};
+
+#ifdef _WIN32
+StorageFileLock::StorageFileLock(const std::filesystem::path& path, bool exclusive) {
+    m_handle = CreateFileW(path.c_str(),
+                           GENERIC_READ | GENERIC_WRITE,
+                           FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                           nullptr,
+                           OPEN_ALWAYS,
+                           FILE_ATTRIBUTE_NORMAL,
+                           nullptr);
+    if (m_handle == INVALID_HANDLE_VALUE) {
+        return;
+    }
+    OVERLAPPED overlapped{};
+    if (!LockFileEx(m_handle, exclusive ? LOCKFILE_EXCLUSIVE_LOCK : 0, 0, 1, 0, &overlapped)) {
+        CloseHandle(m_handle);
+        m_handle = INVALID_HANDLE_VALUE;
+    }
+}
+
+StorageFileLock::~StorageFileLock() {
+    if (m_handle != INVALID_HANDLE_VALUE) {
+        OVERLAPPED overlapped{};
+        UnlockFileEx(m_handle, 0, 1, 0, &overlapped);
+        CloseHandle(m_handle);
+    }
+}
+#else
+StorageFileLock::StorageFileLock(const std::filesystem::path& path, bool exclusive) {
+    m_fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (m_fd < 0) {
+        m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    }
+    if (m_fd < 0) {
+        return;
+    }
+    int result = 0;
+    do {
+        result = ::flock(m_fd, exclusive ? LOCK_EX : LOCK_SH);
+    } while (result != 0 && errno == EINTR);
+}
+
+StorageFileLock::~StorageFileLock() {
+    if (m_fd >= 0) {
+        ::close(m_fd);  // releases the lock
+    }
+}
+#endif
+
 void write_version(std::ostream& stream, const util::Version& version) {
     const uint16_t major = static_cast<uint16_t>(version.major);
     const uint16_t minor = static_cast<uint16_t>(version.minor);
@@ -66,6 +151,37 @@ void write_padding(std::ostream& stream, uint64_t alignment) {
         stream.write(padding.data(), padding.size());
     }
 }
+
+// Returns the generation of the file, it's written after the version by the compaction and is 0 until then.
+uint64_t read_generation(std::istream& stream) {
+    TLVTraits::TagType tag{};
+    TLVTraits::LengthType size{};
+    uint64_t generation = 0;
+    stream.seekg(header_size, std::ios::beg);
+    stream.read(reinterpret_cast<char*>(&tag), sizeof(tag));
+    stream.read(reinterpret_cast<char*>(&size), sizeof(size));
+    if (stream.good() && SingleFileStorage::Tag{tag} == SingleFileStorage::Tag::Generation &&
+        size == sizeof(generation)) {
+        stream.read(reinterpret_cast<char*>(&generation), sizeof(generation));
+    }
+    if (!stream.good()) {
+        generation = 0;
+    }
+    stream.clear();
+    return generation;
+}
+
+bool copy_data(std::istream& src, std::ostream& dst, uint64_t size) {
+    constexpr uint64_t chunk_size = 4 * 1024 * 1024;
+    std::vector<char> buffer(static_cast<size_t>(std::min(size, chunk_size)));
+    while (size > 0 && src.good() && dst.good()) {
+        const auto chunk = static_cast<std::streamsize>(std::min(size, chunk_size));
+        src.read(buffer.data(), chunk);
+        dst.write(buffer.data(), chunk);
+        size -= static_cast<uint64_t>(chunk);
+    }
+    return src.good() && dst.good();
+}
 }  // namespace
 
 const size_t SingleFileStorage::blob_alignment = []() {
@@ -75,9 +191,12 @@ const size_t SingleFileStorage::blob_alignment = []() {
 
 SingleFileStorage::SingleFileStorage(const std::filesystem::path& path)
     : m_file_path{path},
+      m_lock_path{path},
       m_blob_index{},
       m_shared_context{std::make_shared<wsh::Context>()} {
+    m_lock_path += ".lock";
     util::create_directory_recursive(m_file_path.parent_path());
+    StorageFileLock file_lock(m_lock_path, true);
     if (!util::file_exists(m_file_path)) {
         std::ofstream stream(m_file_path, std::ios::binary);
         write_version(stream, m_version);
@@ -89,7 +208,7 @@ SingleFileStorage::SingleFileStorage(const std::filesystem::path& path)
     }
 }
 
-bool SingleFileStorage::build_content_index(std::ifstream& stream) {
+bool SingleFileStorage::build_content_index(std::istream& stream) {
     const auto blob_reader = [this](std::istream& s, TLVTraits::LengthType size) {
         if (size == 0) {
             return true;
@@ -114,8 +233,28 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
         if (!s.good()) {
             return false;
         }
-        m_blob_index[id].offset = static_cast<uint64_t>(blob_data_pos);
-        m_blob_index[id].size = static_cast<uint64_t>(blob_data_size);
+        auto& blob_info = m_blob_index[id];
+        blob_info.offset = static_cast<uint64_t>(blob_data_pos);
+        blob_info.size = static_cast<uint64_t>(blob_data_size);
+        blob_info.last_access = ++m_access_clock;
+        return true;
+    };
+    const auto blob_removed_reader = [this](std::istream& s, TLVTraits::LengthType size) {
+        if (size == 0) {
+            return true;
+        }
+        BlobIdType id;
+        if (size != sizeof(id)) {
+            return false;
+        }
+        s.read(reinterpret_cast<char*>(&id), sizeof(id));
+        if (!s.good()) {
+            return false;
+        }
+        if (const auto blob_it = m_blob_index.find(id); blob_it != m_blob_index.end()) {
+            m_removed_size += blob_it->second.size;
+            m_blob_index.erase(blob_it);
+        }
         return true;
     };
     const auto blob_map_reader = [this](std::istream& s, TLVTraits::LengthType size) {
@@ -189,19 +328,55 @@ bool SingleFileStorage::build_content_index(std::ifstream& stream) {
             return false;
         }
         const auto weight_size = size - header_size - padding_size;
-        m_shared_context->m_cache_sources[source_id] = {};
+        m_shared_context->m_cache_sources.try_emplace(source_id);
         s.seekg(weight_size, std::ios::cur);
         return s.good();
     };
     const TLVValueScanner scanners = {
         {static_cast<TLVTraits::TagType>(Tag::Blob), blob_reader},
         {static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_reader},
+        {static_cast<TLVTraits::TagType>(Tag::BlobRemoved), blob_removed_reader},
         {static_cast<TLVTraits::TagType>(Tag::ConstantMeta), constant_meta_reader},
         {static_cast<TLVTraits::TagType>(Tag::WeightSource), weight_source_reader},
     };
     return scan_tlv_records(stream, scanners);
 }
 
+void SingleFileStorage::update_content_index() {
+    std::ifstream stream(m_file_path, std::ios::binary | std::ios::ate);
+    if (!stream.good()) {
+        m_blob_index.clear();
+        m_generation = 0;
+        m_indexed_size = 0;
+        m_removed_size = 0;
+        return;
+    }
+    const auto file_size = static_cast<uint64_t>(stream.tellg());
+
+    // The file was compacted or recreated by another storage, the offsets in the index are stale. The index is rebuilt,
+    // the access order of the blobs is kept.
+    std::unordered_map<BlobIdType, BlobInfo> stale_index;
+    if (const auto generation = read_generation(stream); generation != m_generation || file_size < m_indexed_size) {
+        stale_index = std::move(m_blob_index);
+        m_blob_index.clear();
+        m_generation = generation;
+        m_indexed_size = 0;
+        m_removed_size = 0;
+    }
+
+    // Only the records appended since the last update are scanned.
+    if (file_size > std::max(m_indexed_size, header_size)) {
+        stream.seekg(static_cast<std::streamoff>(std::max(m_indexed_size, header_size)), std::ios::beg);
+        OPENVINO_ASSERT(build_content_index(stream), "The cache file may be corrupted or in an unsupported format");
+        m_indexed_size = file_size;
+    }
+    for (auto& [id, blob_info] : m_blob_index) {
+        if (const auto stale_it = stale_index.find(id); stale_it != stale_index.end()) {
+            blob_info.last_access = stale_it->second.last_access;
+        }
+    }
+}
+
 SingleFileStorage::BlobIdType SingleFileStorage::convert_blob_id(const std::string& blob_id) {
     return static_cast<BlobIdType>(std::stoull(blob_id.c_str()));
 }
@@ -210,9 +385,10 @@ bool SingleFileStorage::has_blob_id(BlobIdType blob_id) const {
     return m_blob_index.find(blob_id) != m_blob_index.end();
 }
 
-void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer) {
-    OPENVINO_ASSERT(!has_blob_id(blob_id), "Blob with id ", blob_id, " already exists in cache.");
-
+SingleFileStorage::BlobInfo SingleFileStorage::write_blob_records(std::ostream& stream,
+                                                                 BlobIdType blob_id,
+                                                                 const StreamWriter& writer,
+                                                                 std::string model_name) {
     std::streampos blob_pos;
     std::streamoff blob_size;
 
@@ -227,22 +403,98 @@ void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_i
     };
     write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::Blob), blob_writer);
 
-    std::string model_name;  // Intentionally empty
-
     const auto blob_map_writer = [&](std::ostream& s) {
         s.write(reinterpret_cast<const char*>(&blob_id), sizeof(blob_id));
         write_tlv_string(s, model_name);
     };
     write_tlv_record(stream, static_cast<TLVTraits::TagType>(Tag::BlobMap), blob_map_writer);
 
-    m_blob_index[blob_id] = {static_cast<uint64_t>(blob_pos), static_cast<uint64_t>(blob_size), std::move(model_name)};
+    return {static_cast<uint64_t>(blob_pos), static_cast<uint64_t>(blob_size), std::move(model_name), 0};
+}
+
+void SingleFileStorage::write_blob_entry(std::fstream& stream, BlobIdType blob_id, StreamWriter& writer) {
+    OPENVINO_ASSERT(!has_blob_id(blob_id), "Blob with id ", blob_id, " already exists in cache.");
+
+    auto blob_info = write_blob_records(stream, blob_id, writer, {});  // The model name is intentionally empty
+    blob_info.last_access = ++m_access_clock;
+    m_blob_index[blob_id] = std::move(blob_info);
+}
+
+void SingleFileStorage::write_removal_entry(std::ostream& stream, BlobIdType blob_id) {
+    write_tlv_record(stream,
+                     static_cast<TLVTraits::TagType>(Tag::BlobRemoved),
+                     sizeof(blob_id),
+                     reinterpret_cast<const char*>(&blob_id));
+    if (const auto blob_it = m_blob_index.find(blob_id); blob_it != m_blob_index.end()) {
+        m_removed_size += blob_it->second.size;
+        m_blob_index.erase(blob_it);
+    }
+}
+
+void SingleFileStorage::evict_blobs(std::ostream& stream, BlobIdType written_blob_id) {
+    if (m_max_size == 0) {
+        return;
+    }
+    uint64_t total_size = 0;
+    for (const auto& [id, blob_info] : m_blob_index) {
+        total_size += blob_info.size;
+    }
+    while (total_size > m_max_size) {
+        auto lru_it = m_blob_index.end();
+        for (auto it = m_blob_index.begin(); it != m_blob_index.end(); ++it) {
+            if (it->first != written_blob_id &&
+                (lru_it == m_blob_index.end() || it->second.last_access < lru_it->second.last_access)) {
+                lru_it = it;
+            }
+        }
+        if (lru_it == m_blob_index.end()) {
+            break;  // the written blob alone exceeds the limit, keep it
+        }
+        total_size -= lru_it->second.size;
+        write_removal_entry(stream, lru_it->first);
+    }
+}
+
+void SingleFileStorage::compact_if_needed() {
+    uint64_t stored_size = 0;
+    for (const auto& [id, blob_info] : m_blob_index) {
+        stored_size += blob_info.size;
+    }
+    if (m_removed_size > std::max(stored_size, m_compaction_retry_size) && !compact_file()) {
+        // The file can't be replaced now, it's tried again when twice as much is removed.
+        m_compaction_retry_size = 2 * m_removed_size;
+    }
 }
 
 void SingleFileStorage::write_cache_entry(const std::string& blob_id, StreamWriter writer) {
     ScopedLocale plocal_C(LC_ALL, "C");
-    std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
-    OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", blob_id);
-    write_blob_entry(stream, convert_blob_id(blob_id), writer);
+    const auto cid = convert_blob_id(blob_id);
+    std::unique_lock lock(m_mutex);
+    StorageFileLock file_lock(m_lock_path, true);
+    update_content_index();
+    if (has_blob_id(cid)) {
+        // The same blob is written by another thread or process meanwhile, the stored one stays valid.
+        return;
+    }
+    {
+        std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+        OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for writing blob id ", blob_id);
+        const auto entry_pos = stream.tellp();
+        try {
+            write_blob_entry(stream, cid, writer);
+        } catch (...) {
+            // Drop the partial record, otherwise the storages refreshing their index would read it as corrupted.
+            stream.close();
+            std::error_code ec;
+            std::filesystem::resize_file(m_file_path, static_cast<std::uintmax_t>(entry_pos), ec);
+            throw;
+        }
+        evict_blobs(stream, cid);
+        if (const auto end_pos = stream.tellp(); end_pos >= 0) {
+            m_indexed_size = static_cast<uint64_t>(end_pos);
+        }
+    }
+    compact_if_needed();
 }
 
 void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable_mmap, StreamReader reader) {
@@ -250,26 +502,187 @@ void SingleFileStorage::read_cache_entry(const std::string& blob_id, bool enable
 
     const auto cid = convert_blob_id(blob_id);
 
-    if (std::filesystem::exists(m_file_path) && has_blob_id(cid)) {
-        const auto& [blob_pos, blob_size, model_name] = m_blob_index[cid];
-        if (enable_mmap) {
-            CompiledBlobVariant compiled_blob{std::in_place_index<0>,
-                                              read_tensor_data(m_file_path,
-                                                               element::u8,
-                                                               {static_cast<PartialShape::value_type>(blob_size)},
-                                                               blob_pos)};
-            reader(compiled_blob);
-        } else {
-            // Use parallel file I/O to saturate NVMe bandwidth instead of single-threaded ifstream.
-            ov::util::ParallelReadStreamBuf par_buf(m_file_path, static_cast<std::streamoff>(blob_pos));
-            std::istream stream(&par_buf);
-            CompiledBlobVariant compiled_blob{std::in_place_index<1>, std::ref(stream)};
-            reader(compiled_blob);
+    // The blob offsets stay valid until the reader returns, compaction waits for it in all the processes.
+    std::shared_lock lock(m_mutex);
+    StorageFileLock file_lock(m_lock_path, false);
+    uint64_t blob_pos = 0;
+    uint64_t blob_size = 0;
+    {
+        std::lock_guard<std::mutex> index_lock(m_index_mutex);
+        update_content_index();
+        const auto blob_it = m_blob_index.find(cid);
+        if (blob_it == m_blob_index.end()) {
+            return;
+        }
+        blob_it->second.last_access = ++m_access_clock;
+        blob_pos = blob_it->second.offset;
+        blob_size = blob_it->second.size;
+    }
+    if (enable_mmap) {
+        CompiledBlobVariant compiled_blob{std::in_place_index<0>,
+                                          read_tensor_data(m_file_path,
+                                                           element::u8,
+                                                           {static_cast<PartialShape::value_type>(blob_size)},
+                                                           blob_pos)};
+        reader(compiled_blob);
+    } else {
+        // Use parallel file I/O to saturate NVMe bandwidth instead of single-threaded ifstream.
+        ov::util::ParallelReadStreamBuf par_buf(m_file_path, static_cast<std::streamoff>(blob_pos));
+        std::istream stream(&par_buf);
+        CompiledBlobVariant compiled_blob{std::in_place_index<1>, std::ref(stream)};
+        reader(compiled_blob);
+    }
+}
+
+void SingleFileStorage::remove_cache_entry(const std::string& blob_id) {
+    ScopedLocale plocal_C(LC_ALL, "C");
+    const auto cid = convert_blob_id(blob_id);
+    std::unique_lock lock(m_mutex);
+    StorageFileLock file_lock(m_lock_path, true);
+    update_content_index();
+    if (!has_blob_id(cid)) {
+        return;
+    }
+    {
+        std::fstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::out | std::ios::ate);
+        OPENVINO_ASSERT(stream.good(), "Failed to open cache file ", m_file_path, " for removing blob id ", blob_id);
+        write_removal_entry(stream, cid);
+        if (const auto end_pos = stream.tellp(); end_pos >= 0) {
+            m_indexed_size = static_cast<uint64_t>(end_pos);
         }
     }
+    compact_if_needed();
+}
+
+void SingleFileStorage::set_max_size(uint64_t max_size) {
+    std::unique_lock lock(m_mutex);
+    m_max_size = max_size;
+}
+
+bool SingleFileStorage::compact() {
+    ScopedLocale plocal_C(LC_ALL, "C");
+    std::unique_lock lock(m_mutex);
+    StorageFileLock file_lock(m_lock_path, true);
+    update_content_index();
+    return compact_file();
 }
 
-void SingleFileStorage::remove_cache_entry(const std::string& id) {}
+bool SingleFileStorage::compact_file() {
+    auto compacted_path = m_file_path;
+    compacted_path += ".compact";
+    std::unordered_map<BlobIdType, BlobInfo> compacted_index;
+    const uint64_t generation = m_generation + 1;
+    uint64_t compacted_size = 0;
+    bool compacted = false;
+    {
+        std::ifstream src(m_file_path, std::ios::binary);
+        OPENVINO_ASSERT(src.good(), "Failed to open cache file ", m_file_path, " for compaction");
+        std::ofstream dst(compacted_path, std::ios::binary | std::ios::trunc);
+        OPENVINO_ASSERT(dst.good(), "Failed to create cache file ", compacted_path);
+        util::Version file_version;
+        read_version(src, file_version);
+        write_version(dst, m_version);
+        // The other storages of the file find the new generation and rebuild their index.
+        write_tlv_record(dst,
+                         static_cast<TLVTraits::TagType>(Tag::Generation),
+                         sizeof(generation),
+                         reinterpret_cast<const char*>(&generation));
+
+        // Only the latest record of each live blob is copied, the removed and overwritten ones are dropped.
+        const auto blob_copier = [&](std::istream& s, TLVTraits::LengthType size) {
+            if (size == 0) {
+                return true;
+            }
+            constexpr auto header_size = sizeof(BlobIdType) + sizeof(PadSizeType);
+            if (size < header_size) {
+                return false;
+            }
+            BlobIdType id;
+            PadSizeType padding_size;
+            s.read(reinterpret_cast<char*>(&id), sizeof(id));
+            s.read(reinterpret_cast<char*>(&padding_size), sizeof(padding_size));
+            if (!s.good() || padding_size > size - header_size) {
+                return false;
+            }
+            const auto blob_data_pos = s.seekg(padding_size, std::ios::cur).tellg();
+            if (!s.good() || blob_data_pos < 0) {
+                return false;
+            }
+            const auto blob_data_size = size - header_size - padding_size;
+            const auto blob_it = m_blob_index.find(id);
+            if (blob_it == m_blob_index.end() || blob_it->second.offset != static_cast<uint64_t>(blob_data_pos)) {
+                s.seekg(static_cast<std::streamoff>(blob_data_size), std::ios::cur);
+                return s.good();
+            }
+            bool copied = false;
+            const auto copy_blob = [&](std::ostream& d) {
+                copied = copy_data(s, d, blob_data_size);
+            };
+            auto blob_info = write_blob_records(dst, id, copy_blob, blob_it->second.model_name);
+            blob_info.last_access = blob_it->second.last_access;
+            compacted_index[id] = std::move(blob_info);
+            return copied;
+        };
+        const auto constant_meta_copier = [&](std::istream& s, TLVTraits::LengthType size) {
+            std::vector<char> value(static_cast<size_t>(size));
+            s.read(value.data(), value.size());
+            write_tlv_record(dst, static_cast<TLVTraits::TagType>(Tag::ConstantMeta), size, value.data());
+            return s.good();
+        };
+        const auto weight_source_copier = [&](std::istream& s, TLVTraits::LengthType size) {
+            if (size == 0) {
+                return true;
+            }
+            constexpr auto header_size = sizeof(DataIdType) + sizeof(DataIdType) + sizeof(PadSizeType);
+            if (size < header_size) {
+                return false;
+            }
+            DataIdType device_id, source_id;
+            PadSizeType padding_size;
+            s.read(reinterpret_cast<char*>(&device_id), sizeof(device_id));
+            s.read(reinterpret_cast<char*>(&source_id), sizeof(source_id));
+            s.read(reinterpret_cast<char*>(&padding_size), sizeof(padding_size));
+            if (!s.good() || padding_size > size - header_size) {
+                return false;
+            }
+            s.seekg(padding_size, std::ios::cur);
+            bool copied = s.good();
+            write_tlv_record(dst, static_cast<TLVTraits::TagType>(Tag::WeightSource), [&](std::ostream& d) {
+                d.write(reinterpret_cast<const char*>(&device_id), sizeof(device_id));
+                d.write(reinterpret_cast<const char*>(&source_id), sizeof(source_id));
+                write_padding(d, blob_alignment);
+                copied = copied && copy_data(s, d, size - header_size - padding_size);
+            });
+            return copied;
+        };
+        const TLVValueScanner scanners = {
+            {static_cast<TLVTraits::TagType>(Tag::Blob), blob_copier},
+            {static_cast<TLVTraits::TagType>(Tag::ConstantMeta), constant_meta_copier},
+            {static_cast<TLVTraits::TagType>(Tag::WeightSource), weight_source_copier},
+        };
+        compacted = src.good() && scan_tlv_records(src, scanners);
+        compacted_size = static_cast<uint64_t>(dst.tellp());
+        dst.close();
+        compacted = compacted && dst.good();
+    }
+
+    // The readers which mapped the current file keep it alive after it's replaced. On Windows the mapped file can't
+    // be replaced, the current file is kept then.
+    std::error_code ec;
+    if (compacted) {
+        std::filesystem::rename(compacted_path, m_file_path, ec);
+    }
+    if (!compacted || ec) {
+        std::filesystem::remove(compacted_path, ec);
+        return false;
+    }
+    m_blob_index = std::move(compacted_index);
+    m_generation = generation;
+    m_indexed_size = compacted_size;
+    m_removed_size = 0;
+    m_compaction_retry_size = 0;
+    return true;
+}
 
 std::shared_ptr<wsh::Context> SingleFileStorage::get_context() const {
     return m_shared_context;
@@ -277,6 +690,9 @@ std::shared_ptr<wsh::Context> SingleFileStorage::get_context() const {
 
 void SingleFileStorage::write_context(const weight_sharing::Context& context) {
     ScopedLocale plocal_C(LC_ALL, "C");
+    std::unique_lock lock(m_mutex);
+    StorageFileLock file_lock(m_lock_path, true);
+    update_content_index();
     std::ofstream stream(m_file_path, std::ios::binary | std::ios::in | std::ios::ate);
 
     weight_sharing::WeightRegistry delta_weight_registry;
@@ -332,19 +748,28 @@ void SingleFileStorage::write_context(const weight_sharing::Context& context) {
     for (const auto& [source_id, buffer] : context.m_runtime_sources) {
         m_shared_context->m_runtime_sources.emplace(source_id, buffer);
     }
+    if (const auto end_pos = stream.tellp(); end_pos >= 0) {
+        m_indexed_size = static_cast<uint64_t>(end_pos);
+    }
 }
 
 void SingleFileStorage::initialize(std::shared_ptr<ov::wsh::Context> weight_sharing_context) {
+    std::unique_lock lock(m_mutex);
     if (weight_sharing_context) {
         m_shared_context = std::move(weight_sharing_context);
     }
 
+    StorageFileLock file_lock(m_lock_path, false);
     if (std::ifstream stream(m_file_path, std::ios::binary); stream.good()) {
         util::Version file_version;
         read_version(stream, file_version);
         OPENVINO_ASSERT(util::is_version_compatible(m_version, file_version), "Incompatible cache format");
-        OPENVINO_ASSERT(build_content_index(stream), "The cache file may be corrupted or in an unsupported format");
     }
+    // The content is indexed again into the given context.
+    m_blob_index.clear();
+    m_indexed_size = 0;
+    m_removed_size = 0;
+    update_content_index();
 }
 
 };  // namespace ov::runtime
@@ -136,6 +136,17 @@ TEST(PropertyTest, SetCachePathPropertyCoreNoThrow) {
     EXPECT_EQ(value.as<std::filesystem::path>(), std::filesystem::path("./tmp_cache_dir"));
 }
 
+TEST(PropertyTest, SetCacheMaxSizePropertyCoreNoThrow) {
+    ov::Core core;
+
+    ov::Any value;
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::cache_max_size.name()));
+    EXPECT_EQ(value.as<uint64_t>(), 0);
+    OV_ASSERT_NO_THROW(core.set_property(ov::cache_max_size(1024)));
+    OV_ASSERT_NO_THROW(value = core.get_property(ov::cache_max_size.name()));
+    EXPECT_EQ(value.as<uint64_t>(), 1024);
+}
+
 TEST(PropertyTest, SetTBBForceTerminatePropertyCoreNoThrow) {
     ov::Core core;
 
@@ -6,13 +6,17 @@
 
 #include <gtest/gtest.h>
 
+#include <atomic>
+#include <chrono>
 #include <fstream>
 #include <iterator>
 #include <memory>
 #include <stdexcept>
 #include <streambuf>
 #include <string>
+#include <thread>
 
+#include "cache_guard.hpp"
 #include "common_test_utils/common_utils.hpp"
 
 namespace ov::test {
@@ -91,6 +95,42 @@ TEST_F(FileStorageCacheManagerTest, RemovesBlobAfterStreamFailureWhenCallerClean
     EXPECT_FALSE(std::filesystem::exists(blob_path("2")));
 }
 
+TEST_F(FileStorageCacheManagerTest, DoesNotLeaveTemporaryFileAfterWriteFailure) {
+    EXPECT_THROW(m_cache_manager->write_cache_entry("3",
+                                                    [&](std::ostream& stream) {
+                                                        stream << "partial";
+                                                        throw std::runtime_error("write failed");
+                                                    }),
+                 std::runtime_error);
+
+    EXPECT_TRUE(std::filesystem::is_empty(m_cache_dir));
+}
+
+TEST_F(FileStorageCacheManagerTest, PublishesBlobOnlyWhenFullyWritten) {
+    m_cache_manager->write_cache_entry("4", [&](std::ostream& stream) {
+        stream << "cached";
+        stream.flush();
+        EXPECT_FALSE(std::filesystem::exists(blob_path("4")));
+    });
+    EXPECT_EQ(read_blob(blob_path("4")), "cached");
+
+    m_cache_manager->write_cache_entry("4", [&](std::ostream& stream) {
+        stream << "new";
+        stream.flush();
+        EXPECT_EQ(read_blob(blob_path("4")), "cached");
+    });
+    EXPECT_EQ(read_blob(blob_path("4")), "new");
+}
+
+TEST_F(FileStorageCacheManagerTest, ProvidesLockFileForMissingEntryOnly) {
+    EXPECT_EQ(m_cache_manager->get_lock_file("5"), std::filesystem::path{blob_path("5").string() + ".lock"});
+
+    m_cache_manager->write_cache_entry("5", [&](std::ostream& stream) {
+        stream << "cached";
+    });
+    EXPECT_TRUE(m_cache_manager->get_lock_file("5").empty());
+}
+
 TEST_F(FileStorageCacheManagerTest, OverwritesExistingBlobWhenEntryAlreadyExists) {
     m_cache_manager->write_cache_entry("7", [&](std::ostream& stream) {
         stream << "cached";
@@ -120,5 +160,45 @@ TEST_F(FileStorageCacheManagerTest, DoesNotLeaveAuxiliaryFilesInCacheDirectory)
     EXPECT_EQ(entries.front(), std::filesystem::path{"8.blob"});
 }
 
+class CacheGuardFileLockTest : public ::testing::Test {
+protected:
+    std::filesystem::path m_lock_file;
+
+    void SetUp() override {
+        m_lock_file = ov::test::utils::generateTestFilePrefix() + ".lock";
+    }
+
+    void TearDown() override {
+        std::filesystem::remove(m_lock_file);
+    }
+};
+
+// The guards stand for the cache guards of different processes.
+TEST_F(CacheGuardFileLockTest, WaitsForLockFileHolder) {
+    CacheGuard owner_guard, waiter_guard;
+    auto owner_lock = owner_guard.get_hash_lock("1", m_lock_file);
+    EXPECT_TRUE(std::filesystem::exists(m_lock_file));
+
+    std::atomic_bool waiter_locked{false};
+    std::thread waiter([&] {
+        const auto waiter_lock = waiter_guard.get_hash_lock("1", m_lock_file);
+        waiter_locked = true;
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_FALSE(waiter_locked);
+
+    owner_lock.reset();
+    waiter.join();
+    EXPECT_TRUE(waiter_locked);
+    EXPECT_FALSE(std::filesystem::exists(m_lock_file)) << "The lock file should be removed by its holder";
+}
+
+TEST_F(CacheGuardFileLockTest, StopsWaitingAfterTimeout) {
+    CacheGuard owner_guard, waiter_guard{std::chrono::milliseconds(50)};
+    const auto owner_lock = owner_guard.get_hash_lock("1", m_lock_file);
+    const auto waiter_lock = waiter_guard.get_hash_lock("1", m_lock_file);
+    EXPECT_TRUE(std::filesystem::exists(m_lock_file));
+}
+
 }  // namespace
 }  // namespace ov::test
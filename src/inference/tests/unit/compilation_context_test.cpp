@@ -322,6 +322,21 @@ TEST(NetworkContext, HashWithDifferentResults) {
     ASSERT_EQ(ov::ModelCache::compute_hash(net2, {}), ov::ModelCache::compute_hash(net3, {}));
 }
 
+TEST(NetworkContext, HashWithModifiedSharedWeights) {
+    // the constant shares the weights of the tensor, which may be changed between the hash calculations
+    ov::Tensor weights(ov::element::f32, ov::Shape{3, 1, 2});
+    std::fill_n(weights.data<float>(), weights.get_size(), 1.f);
+    auto data = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::Shape{3, 1, 2});
+    auto mul = std::make_shared<ov::op::v1::Multiply>(data, std::make_shared<ov::op::v0::Constant>(weights));
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{mul}, ov::ParameterVector{data});
+
+    const auto hash = ov::ModelCache::compute_hash(model, {});
+    weights.data<float>()[0] = 2.f;
+    ASSERT_NE(ov::ModelCache::compute_hash(model, {}), hash);
+    weights.data<float>()[0] = 1.f;
+    ASSERT_EQ(ov::ModelCache::compute_hash(model, {}), hash);
+}
+
 // Verify all internal hash calculations are thread-safe (like ov::Model serialization)
 TEST(NetworkContext, HashOfSameMultiThreading) {
     auto net1 = create_simple_model();
@@ -22,6 +22,23 @@ namespace {
 constexpr uint64_t version_size() {
     return 3 * sizeof(uint16_t);  // major, minor, patch
 }
+
+void write_blob(SingleFileStorage& storage, const std::string& blob_id, const std::vector<uint8_t>& blob_data) {
+    storage.write_cache_entry(blob_id, [&](std::ostream& stream) {
+        stream.write(reinterpret_cast<const char*>(blob_data.data()), blob_data.size());
+    });
+}
+
+// Returns the blob data read with mmap or empty vector if the blob is not stored.
+std::vector<uint8_t> read_blob(SingleFileStorage& storage, const std::string& blob_id) {
+    std::vector<uint8_t> blob_data;
+    storage.read_cache_entry(blob_id, true, [&](const ICacheManager::CompiledBlobVariant& compiled_blob) {
+        const auto& tensor = std::get<const ov::Tensor>(compiled_blob);
+        const auto data = static_cast<const uint8_t*>(tensor.data());
+        blob_data.assign(data, data + tensor.get_byte_size());
+    });
+    return blob_data;
+}
 }  // namespace
 
 struct SingleFileStorageTestParam {
@@ -44,6 +61,7 @@ protected:
     void TearDown() override {
         m_storage.reset();
         std::filesystem::remove(m_file_path);
+        std::filesystem::remove(std::filesystem::path{m_file_path} += ".lock");
     }
 };
 
@@ -158,39 +176,220 @@ TEST_F(SingleFileStorageTest, BlobAlignment) {
     }
 }
 
-TEST_F(SingleFileStorageTest, AppendOnlyCacheEntry) {
+TEST_F(SingleFileStorageTest, RemoveCacheEntry) {
     const auto blob_id = std::string{"123"};
     m_storage->write_cache_entry(blob_id, [&](std::ostream& s) {
         // Although pointless it shall be harmless to write nothing
     });
-    EXPECT_NO_THROW(m_storage->remove_cache_entry(blob_id));  // removal does nothing => expect legit read
-    bool read_called = false;
-    EXPECT_NO_THROW(m_storage->read_cache_entry(blob_id, false, [&](const ICacheManager::CompiledBlobVariant&) {
-        read_called = true;
+    EXPECT_NO_THROW(m_storage->write_cache_entry(blob_id, [&](std::ostream&) {
+        throw "Unexpected write for existing blob id";
+    })) << "Write of existing blob id should be no-op";
+
+    EXPECT_NO_THROW(m_storage->remove_cache_entry(blob_id));
+    EXPECT_NO_THROW(m_storage->read_cache_entry(blob_id, false, [](const ICacheManager::CompiledBlobVariant&) {
+        throw "Unexpected read for removed blob id";
     }));
-    EXPECT_TRUE(read_called);
+    EXPECT_NO_THROW(m_storage->remove_cache_entry("987")) << "Removal of non-existing blob id should be no-op";
 
-    OV_EXPECT_THROW_HAS_SUBSTRING(m_storage->write_cache_entry(blob_id, [&](std::ostream&) {}),
-                                  ov::AssertFailure,
-                                  blob_id + " already exists in cache");
+    const std::vector<uint8_t> blob_data(100, 0x5A);
+    write_blob(*m_storage, blob_id, blob_data);  // the removed blob id can be written again
     m_storage.reset();
 
     SingleFileStorage reopened_storage(m_file_path);
     reopened_storage.initialize();
-    OV_EXPECT_THROW_HAS_SUBSTRING(reopened_storage.write_cache_entry(blob_id, [&](std::ostream&) {}),
-                                  ov::AssertFailure,
-                                  blob_id + " already exists in cache");
-
-    EXPECT_NO_THROW(reopened_storage.read_cache_entry("987", false, [](const ICacheManager::CompiledBlobVariant&) {
-        throw "Unexpected read for not stored blob id";
+    EXPECT_NO_THROW(reopened_storage.write_cache_entry(blob_id, [&](std::ostream&) {
+        throw "Unexpected write for existing blob id";
     }));
-    EXPECT_NO_THROW(reopened_storage.remove_cache_entry("987")) << "Removal of non-existing blob id should be no-op";
+    EXPECT_EQ(read_blob(reopened_storage, blob_id), blob_data);
+
+    reopened_storage.remove_cache_entry(blob_id);
+    SingleFileStorage storage_after_removal(m_file_path);
+    storage_after_removal.initialize();
+    EXPECT_TRUE(read_blob(storage_after_removal, blob_id).empty());
+}
+
+TEST_F(SingleFileStorageTest, EvictLeastRecentlyUsed) {
+    const std::vector<uint8_t> blob_data(1000, 0x3C);
+    m_storage->set_max_size(3 * blob_data.size());
+    write_blob(*m_storage, "1", blob_data);
+    write_blob(*m_storage, "2", blob_data);
+    write_blob(*m_storage, "3", blob_data);
+    EXPECT_EQ(read_blob(*m_storage, "1"), blob_data);
+
+    write_blob(*m_storage, "4", blob_data);  // exceeds the limit, the least recently used blob 2 is evicted
+    const auto evicted_test = [&](SingleFileStorage& storage) {
+        EXPECT_TRUE(read_blob(storage, "2").empty());
+        for (const auto& blob_id : {"1", "3", "4"}) {
+            EXPECT_EQ(read_blob(storage, blob_id), blob_data) << "Blob " << blob_id << " should not be evicted";
+        }
+    };
+    evicted_test(*m_storage);
+
+    SingleFileStorage reopened_storage(m_file_path);
+    reopened_storage.initialize();
+    evicted_test(reopened_storage);
+
+    m_storage->set_max_size(blob_data.size() / 2);
+    write_blob(*m_storage, "5", blob_data);  // the written blob is kept even if it exceeds the limit alone
+    for (const auto& blob_id : {"1", "3", "4"}) {
+        EXPECT_TRUE(read_blob(*m_storage, blob_id).empty()) << "Blob " << blob_id << " should be evicted";
+    }
+    EXPECT_EQ(read_blob(*m_storage, "5"), blob_data);
+}
+
+TEST_F(SingleFileStorageTest, CompactKeepsLiveRecords) {
+    const std::vector<std::pair<std::string, std::vector<uint8_t>>> test_blobs{
+        {"1", std::vector<uint8_t>(4099, 0xAB)},
+        {"2", std::vector<uint8_t>(400, 0xCD)},
+        {"3", std::vector<uint8_t>(5, 0xEF)},
+        {"4", std::vector<uint8_t>(8192, 0x12)},
+    };
+    for (const auto& [blob_id, blob_data] : test_blobs) {
+        write_blob(*m_storage, blob_id, blob_data);
+    }
+    weight_sharing::Context test_context;
+    test_context.m_weight_registry[1][11] = {100, 200, element::Type_t::f32};
+    const auto weights = std::make_shared<ov::AlignedBuffer>(1024);
+    std::memset(weights->get_ptr(), 0x77, weights->size());
+    test_context.m_cache_sources[1].m_weights = weights;
+    m_storage->write_context(test_context);
+
+    m_storage->remove_cache_entry("2");
+    m_storage->remove_cache_entry("3");
+    const std::vector<uint8_t> rewritten_data(300, 0x34);
+    write_blob(*m_storage, "3", rewritten_data);
+
+    const auto file_size_before = test::utils::fileSize(m_file_path.string());
+    ASSERT_TRUE(m_storage->compact());
+    EXPECT_LT(test::utils::fileSize(m_file_path.string()), file_size_before);
+
+    const auto compacted_test = [&](SingleFileStorage& storage) {
+        EXPECT_TRUE(read_blob(storage, "2").empty());
+        EXPECT_EQ(read_blob(storage, "3"), rewritten_data);
+        for (const auto& blob_id : {"1", "4"}) {
+            storage.read_cache_entry(blob_id, true, [&](const ICacheManager::CompiledBlobVariant& compiled_blob) {
+                const auto& tensor = std::get<const ov::Tensor>(compiled_blob);
+                EXPECT_EQ(reinterpret_cast<uintptr_t>(tensor.data()) % SingleFileStorage::blob_alignment, 0)
+                    << "Blob with id " << blob_id << " is not properly aligned";
+            });
+        }
+        EXPECT_EQ(read_blob(storage, "1"), test_blobs[0].second);
+        EXPECT_EQ(read_blob(storage, "4"), test_blobs[3].second);
+        EXPECT_EQ(storage.get_context()->m_weight_registry.count(1), 1);
+        EXPECT_EQ(storage.get_context()->m_cache_sources.count(1), 1);
+    };
+    compacted_test(*m_storage);
+    m_storage.reset();
 
-    read_called = false;
-    EXPECT_NO_THROW(reopened_storage.read_cache_entry(blob_id, false, [&](const ICacheManager::CompiledBlobVariant&) {
-        read_called = true;
+    SingleFileStorage reopened_storage(m_file_path);
+    reopened_storage.initialize();
+    compacted_test(reopened_storage);
+}
+
+TEST_F(SingleFileStorageTest, CompactKeepsMappedBlobs) {
+    const std::vector<uint8_t> removed_data(5000, 0x56), blob_data(3000, 0x78);
+    write_blob(*m_storage, "1", removed_data);
+    write_blob(*m_storage, "2", blob_data);
+    m_storage->remove_cache_entry("1");
+
+    ov::Tensor mapped_blob;
+    m_storage->read_cache_entry("2", true, [&](const ICacheManager::CompiledBlobVariant& compiled_blob) {
+        mapped_blob = std::get<const ov::Tensor>(compiled_blob);
+    });
+    ASSERT_EQ(mapped_blob.get_byte_size(), blob_data.size());
+
+    // The file can't be replaced while it's mapped on Windows, the mapped blob stays valid in both cases.
+    m_storage->compact();
+    EXPECT_EQ(std::memcmp(mapped_blob.data(), blob_data.data(), blob_data.size()), 0);
+    EXPECT_EQ(read_blob(*m_storage, "2"), blob_data);
+}
+
+TEST_F(SingleFileStorageTest, CompactAutomatically) {
+    const std::vector<uint8_t> blob_data(10000, 0x9A);
+    m_storage->set_max_size(3 * blob_data.size());
+    for (int i = 0; i < 20; ++i) {
+        write_blob(*m_storage, std::to_string(i), blob_data);
+    }
+
+    // At most 3 blobs are stored and the removed ones can't take more space than them.
+    const auto max_record_size = blob_data.size() + 2 * SingleFileStorage::blob_alignment;
+    EXPECT_LE(test::utils::fileSize(m_file_path.string()), static_cast<long long>(7 * max_record_size));
+    for (const auto& blob_id : {"17", "18", "19"}) {
+        EXPECT_EQ(read_blob(*m_storage, blob_id), blob_data) << "Blob " << blob_id << " should be stored";
+    }
+    EXPECT_TRUE(read_blob(*m_storage, "16").empty());
+}
+
+// The storages of the same file stand for the processes sharing it.
+TEST_F(SingleFileStorageTest, SeesEntriesOfOtherStorage) {
+    SingleFileStorage other_storage(m_file_path);
+    other_storage.initialize();
+
+    const std::vector<uint8_t> blob_data(700, 0x21);
+    write_blob(*m_storage, "1", blob_data);
+    EXPECT_EQ(read_blob(other_storage, "1"), blob_data);
+    EXPECT_NO_THROW(write_blob(other_storage, "1", blob_data));
+
+    other_storage.remove_cache_entry("1");
+    EXPECT_TRUE(read_blob(*m_storage, "1").empty());
+    const std::vector<uint8_t> rewritten_data(900, 0x43);
+    write_blob(*m_storage, "1", rewritten_data);
+    EXPECT_EQ(read_blob(other_storage, "1"), rewritten_data);
+}
+
+// The blob written by another process after the cache miss is kept, the late writer doesn't replace or remove it.
+TEST_F(SingleFileStorageTest, OtherStorageWritesSameBlob) {
+    SingleFileStorage other_storage(m_file_path);
+    other_storage.initialize();
+    EXPECT_TRUE(read_blob(other_storage, "1").empty());
+
+    const std::vector<uint8_t> blob_data(700, 0x65);
+    write_blob(*m_storage, "1", blob_data);
+    const auto file_size = test::utils::fileSize(m_file_path.string());
+    EXPECT_NO_THROW(other_storage.write_cache_entry("1", [&](std::ostream&) {
+        throw "Unexpected write for blob id written by other storage";
     }));
-    EXPECT_TRUE(read_called);
+    EXPECT_EQ(test::utils::fileSize(m_file_path.string()), file_size);
+    EXPECT_EQ(read_blob(*m_storage, "1"), blob_data);
+    EXPECT_EQ(read_blob(other_storage, "1"), blob_data);
+
+    SingleFileStorage reopened_storage(m_file_path);
+    reopened_storage.initialize();
+    EXPECT_EQ(read_blob(reopened_storage, "1"), blob_data);
+}
+
+TEST_F(SingleFileStorageTest, RebuildIndexAfterCompactionByOtherStorage) {
+    const std::vector<std::pair<std::string, std::vector<uint8_t>>> test_blobs{
+        {"1", std::vector<uint8_t>(5000, 0x11)},
+        {"2", std::vector<uint8_t>(3000, 0x22)},
+        {"3", std::vector<uint8_t>(6000, 0x33)},
+    };
+    for (const auto& [blob_id, blob_data] : test_blobs) {
+        write_blob(*m_storage, blob_id, blob_data);
+    }
+    SingleFileStorage other_storage(m_file_path);
+    other_storage.initialize();
+    EXPECT_EQ(read_blob(other_storage, "3"), test_blobs[2].second);
+
+    // The blobs move to other offsets, the index of the other storage is stale.
+    m_storage->remove_cache_entry("1");
+    ASSERT_TRUE(m_storage->compact());
+    const std::vector<uint8_t> new_data(2000, 0x44);
+    write_blob(*m_storage, "4", new_data);
+
+    EXPECT_TRUE(read_blob(other_storage, "1").empty());
+    EXPECT_EQ(read_blob(other_storage, "2"), test_blobs[1].second);
+    EXPECT_EQ(read_blob(other_storage, "3"), test_blobs[2].second);
+    EXPECT_EQ(read_blob(other_storage, "4"), new_data);
+
+    // The other storage compacts the file in its turn and appends to it.
+    other_storage.remove_cache_entry("2");
+    ASSERT_TRUE(other_storage.compact());
+    write_blob(other_storage, "5", new_data);
+    EXPECT_TRUE(read_blob(*m_storage, "2").empty());
+    EXPECT_EQ(read_blob(*m_storage, "3"), test_blobs[2].second);
+    EXPECT_EQ(read_blob(*m_storage, "4"), new_data);
+    EXPECT_EQ(read_blob(*m_storage, "5"), new_data);
 }
 
 // Large blob test: write >= 4 MB so that the real DEFAULT_THRESHOLD (4 MB) in
@@ -0,0 +1,148 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "activation_arena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include "cpu_memory.h"
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+ActivationArena::Lease& ActivationArena::Lease::operator=(Lease&& other) noexcept {
+    if (this != &other) {
+        reset();
+        m_arena = std::move(other.m_arena);
+        m_block = std::move(other.m_block);
+    }
+    return *this;
+}
+
+ActivationArena::Lease::~Lease() {
+    reset();
+}
+
+void ActivationArena::Lease::reset() {
+    if (m_block) {
+        m_arena->release(std::move(m_block));
+    }
+    m_arena.reset();
+}
+
+ActivationArena::Ptr ActivationArena::get(int numaNodeId) {
+    static std::mutex mutex;
+    static std::map<int, Ptr> arenas;
+
+    std::lock_guard<std::mutex> lock(mutex);
+    auto& arena = arenas[numaNodeId];
+    if (!arena) {
+        arena = std::make_shared<ActivationArena>(numaNodeId);
+    }
+    return arena;
+}
+
+ActivationArena::ActivationArena(int numaNodeId, size_t capacity)
+    : m_numaNodeId(numaNodeId),
+      m_capacity(capacity) {}
+
+std::unique_ptr<MemoryBlockWithReuse> ActivationArena::allocate(size_t size) {
+    auto block = std::make_unique<MemoryBlockWithReuse>(m_numaNodeId);
+    block->resize(size);
+    m_allocated += size;
+    return block;
+}
+
+ActivationArena::Lease ActivationArena::lease(size_t size, ActivationArenaStatistics* stats) {
+    OPENVINO_ASSERT(size > 0, "ActivationArena: unexpected lease of an empty buffer");
+
+    std::unique_ptr<MemoryBlockWithReuse> block;
+    bool overcommitted = false;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // best fit among the returned buffers
+        auto pooled = m_pool.lower_bound(size);
+        if (pooled != m_pool.end()) {
+            block = std::move(pooled->second);
+            m_pool.erase(pooled);
+        } else {
+            // the pooled buffers are too small, drop them to make room for a new one
+            while (m_capacity != 0 && m_allocated + size > m_capacity && !m_pool.empty()) {
+                m_allocated -= m_pool.begin()->first;
+                m_pool.erase(m_pool.begin());
+            }
+            // a single lease may exceed the capacity, otherwise it would never be served
+            overcommitted = m_capacity != 0 && m_allocated + size > m_capacity && m_leased != 0;
+            block = allocate(size);
+        }
+        m_leased += block->size();
+        m_peakLeased = std::max(m_peakLeased, m_leased);
+    }
+
+    if (stats) {
+        stats->leases.fetch_add(1, std::memory_order_relaxed);
+        if (overcommitted) {
+            stats->overcommits.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    return {shared_from_this(), std::move(block)};
+}
+
+void ActivationArena::release(std::unique_ptr<MemoryBlockWithReuse> block) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const auto size = block->size();
+    m_leased -= size;
+    m_pool.emplace(size, std::move(block));
+    trim();
+}
+
+void ActivationArena::trim() {
+    // keep the smallest buffers, since they are the most likely to be reused
+    while (m_capacity != 0 && m_allocated > m_capacity && !m_pool.empty()) {
+        auto largest = std::prev(m_pool.end());
+        m_allocated -= largest->first;
+        m_pool.erase(largest);
+    }
+}
+
+void ActivationArena::requestCapacity(size_t capacity) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_capacityRequested) {
+        m_capacity = capacity;
+        m_capacityRequested = true;
+    } else if (m_capacity != 0) {
+        m_capacity = capacity == 0 ? 0 : std::max(m_capacity, capacity);
+    }
+    trim();
+}
+
+size_t ActivationArena::capacity() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_capacity;
+}
+
+size_t ActivationArena::allocated() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocated;
+}
+
+size_t ActivationArena::leased() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_leased;
+}
+
+size_t ActivationArena::peakLeased() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_peakLeased;
+}
+
+}  // namespace ov::intel_cpu
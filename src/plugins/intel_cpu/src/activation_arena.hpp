@@ -0,0 +1,128 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include "cpu_memory.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Lease counters of an arena client (e.g. of a compiled model), can be updated and read concurrently
+ */
+struct ActivationArenaStatistics {
+    std::atomic<uint64_t> leases{0};
+    // number of leases allocated over the arena capacity, since the other clients held the memory
+    std::atomic<uint64_t> overcommits{0};
+};
+
+using ActivationArenaStatisticsPtr = std::shared_ptr<ActivationArenaStatistics>;
+
+/**
+ * @brief Process wide pool of activation memory shared by the compiled models running on the same NUMA node.
+ *
+ * A compiled model leases a buffer for its intermediate tensors only for the duration of an inference and returns it
+ * afterwards, so the peak memory scales with the number of concurrent inferences rather than with the number of
+ * loaded models. The returned buffers are kept in the pool and reused by the next leases with the best-fit policy.
+ *
+ * If the arena capacity is set and the requested buffer does not fit, the pooled buffers are dropped to make room for
+ * it. The lease never waits for the buffers held by the other clients: blocking an inference on the memory of another
+ * one trades the latency for the memory and may deadlock the clients holding several leases, so the buffer is
+ * allocated over the capacity instead and the pool is trimmed back once the buffers are returned.
+ *
+ * @note The arena is thread safe.
+ */
+class ActivationArena : public std::enable_shared_from_this<ActivationArena> {
+public:
+    using Ptr = std::shared_ptr<ActivationArena>;
+
+    class Lease {
+    public:
+        Lease() = default;
+        Lease(Lease&& other) noexcept = default;
+        Lease& operator=(Lease&& other) noexcept;
+        Lease(const Lease&) = delete;
+        Lease& operator=(const Lease&) = delete;
+        ~Lease();
+
+        [[nodiscard]] void* data() const {
+            return m_block ? m_block->getRawPtr() : nullptr;
+        }
+
+        [[nodiscard]] size_t size() const {
+            return m_block ? m_block->size() : 0;
+        }
+
+        explicit operator bool() const {
+            return static_cast<bool>(m_block);
+        }
+
+        /**
+         * @brief Returns the buffer to the arena
+         */
+        void reset();
+
+    private:
+        friend class ActivationArena;
+        Lease(Ptr arena, std::unique_ptr<MemoryBlockWithReuse> block)
+            : m_arena(std::move(arena)),
+              m_block(std::move(block)) {}
+
+        Ptr m_arena;
+        std::unique_ptr<MemoryBlockWithReuse> m_block;
+    };
+
+    /**
+     * @brief Returns the arena shared by all the compiled models of the process running on the NUMA node
+     */
+    static Ptr get(int numaNodeId);
+
+    /**
+     * @param numaNodeId NUMA node to bind the buffers to, -1 means no binding
+     * @param capacity maximum number of bytes pooled by the arena, zero means unlimited
+     */
+    explicit ActivationArena(int numaNodeId, size_t capacity = 0);
+
+    /**
+     * @brief Leases a buffer of at least the given size, never blocks
+     * @param stats counters of the client to be updated
+     */
+    Lease lease(size_t size, ActivationArenaStatistics* stats = nullptr);
+
+    /**
+     * @brief Requests the capacity on behalf of a client. The arena is shared, so the clients must not shrink it for
+     * each other: the largest requested capacity is applied, unlimited (zero) one included
+     */
+    void requestCapacity(size_t capacity);
+
+    [[nodiscard]] size_t capacity() const;
+    // bytes allocated by the arena, both leased and pooled
+    [[nodiscard]] size_t allocated() const;
+    [[nodiscard]] size_t leased() const;
+    [[nodiscard]] size_t peakLeased() const;
+
+private:
+    void release(std::unique_ptr<MemoryBlockWithReuse> block);
+    std::unique_ptr<MemoryBlockWithReuse> allocate(size_t size);
+    // must be called under the lock
+    void trim();
+
+    const int m_numaNodeId;
+    mutable std::mutex m_mutex;
+    std::multimap<size_t, std::unique_ptr<MemoryBlockWithReuse>> m_pool;
+    size_t m_capacity;
+    bool m_capacityRequested = false;
+    size_t m_allocated = 0;
+    size_t m_leased = 0;
+    size_t m_peakLeased = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,174 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "adaptive_streams_executor.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+#include "streams_controller.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+std::vector<StreamsController::Candidate> toCandidates(const std::vector<ov::threading::IStreamsExecutor::Config>& cfgs) {
+    std::vector<StreamsController::Candidate> candidates;
+    candidates.reserve(cfgs.size());
+    for (const auto& config : cfgs) {
+        candidates.push_back({config.get_streams(), config.get_threads_per_stream()});
+    }
+    return candidates;
+}
+}  // namespace
+
+AdaptiveStreamsExecutor::AdaptiveStreamsExecutor(std::vector<Config> configs,
+                                                 size_t current,
+                                                 std::shared_ptr<ov::threading::IStreamsExecutor> executor,
+                                                 Factory factory,
+                                                 const StreamsController::Settings& settings)
+    : m_configs(std::move(configs)),
+      m_factory(std::move(factory)),
+      m_executor(std::move(executor)),
+      m_controller(toCandidates(m_configs), current, settings) {
+    OPENVINO_ASSERT(m_executor, "Adaptive streams executor requires the executor of the current configuration");
+    m_usedExecutors.push_back(m_executor);
+}
+
+void AdaptiveStreamsExecutor::set_switch_callback(std::function<void()> callback) {
+    std::lock_guard<std::mutex> lock{m_callbackMutex};
+    m_switchCallback = std::move(callback);
+}
+
+void AdaptiveStreamsExecutor::run(ov::threading::Task task) {
+    const auto submitted = StreamsController::Clock::now();
+    std::shared_ptr<ov::threading::IStreamsExecutor> executor;
+    ov::threading::Task tracked;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_inFlight++;
+        // the executor is kept alive by the tasks, since the compiled model may be released while they complete
+        tracked = [self = shared_from_this(), task = std::move(task), submitted, queueDepth = m_inFlight] {
+            const auto started = StreamsController::Clock::now();
+            try {
+                task();
+            } catch (...) {
+                self->complete(submitted, started, queueDepth);
+                throw;
+            }
+            self->complete(submitted, started, queueDepth);
+        };
+        if (m_switchPending) {
+            m_held.push_back(std::move(tracked));
+            return;
+        }
+        executor = m_executor;
+    }
+    executor->run(std::move(tracked));
+}
+
+void AdaptiveStreamsExecutor::complete(StreamsController::Clock::time_point submitted,
+                                       StreamsController::Clock::time_point started,
+                                       size_t queueDepth) {
+    const auto now = StreamsController::Clock::now();
+    std::shared_ptr<ov::threading::IStreamsExecutor> executor;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_controller.record({queueDepth,
+                             std::chrono::duration_cast<std::chrono::microseconds>(now - submitted),
+                             std::chrono::duration_cast<std::chrono::microseconds>(now - started)});
+        m_inFlight--;
+        if (!m_switchPending) {
+            m_switchPending = m_controller.evaluate(now).has_value();
+        }
+        if (!m_switchPending || m_inFlight != m_held.size()) {
+            return;
+        }
+        // the previous executor is kept alive by the executor manager, so it is safe to drop it from its own thread
+        m_executor = m_factory(m_configs[m_controller.current()]);
+        if (std::find(m_usedExecutors.begin(), m_usedExecutors.end(), m_executor) == m_usedExecutors.end()) {
+            m_usedExecutors.push_back(m_executor);
+        }
+    }
+
+    // the tasks submitted meanwhile are still held, so the graphs are not used
+    {
+        std::lock_guard<std::mutex> lock{m_callbackMutex};
+        if (m_switchCallback) {
+            m_switchCallback();
+        }
+    }
+
+    std::vector<ov::threading::Task> held;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        m_switchPending = false;
+        held.swap(m_held);
+        executor = m_executor;
+    }
+    for (auto&& task : held) {
+        executor->run(std::move(task));
+    }
+}
+
+std::shared_ptr<ov::threading::IStreamsExecutor> AdaptiveStreamsExecutor::current() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    return m_executor;
+}
+
+void AdaptiveStreamsExecutor::execute(ov::threading::Task task) {
+    current()->execute(std::move(task));
+}
+
+int AdaptiveStreamsExecutor::get_stream_id() {
+    return current()->get_stream_id();
+}
+
+int AdaptiveStreamsExecutor::get_streams_num() {
+    return current()->get_streams_num();
+}
+
+int AdaptiveStreamsExecutor::get_numa_node_id() {
+    return current()->get_numa_node_id();
+}
+
+int AdaptiveStreamsExecutor::get_socket_id() {
+    return current()->get_socket_id();
+}
+
+std::vector<int> AdaptiveStreamsExecutor::get_rank() {
+    return current()->get_rank();
+}
+
+void AdaptiveStreamsExecutor::cpu_reset() {
+    std::vector<std::shared_ptr<ov::threading::IStreamsExecutor>> executors;
+    {
+        std::lock_guard<std::mutex> lock{m_mutex};
+        executors = m_usedExecutors;
+    }
+    for (const auto& executor : executors) {
+        executor->cpu_reset();
+    }
+}
+
+std::vector<std::string> AdaptiveStreamsExecutor::get_decisions() const {
+    std::lock_guard<std::mutex> lock{m_mutex};
+    std::vector<std::string> decisions;
+    decisions.reserve(m_controller.decisions().size());
+    for (const auto& decision : m_controller.decisions()) {
+        decisions.push_back(decision.toString());
+    }
+    return decisions;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,97 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "openvino/runtime/threading/istreams_executor.hpp"
+#include "openvino/runtime/threading/itask_executor.hpp"
+#include "streams_controller.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Streams executor switching between the streams configurations of the compiled model at runtime.
+ *
+ * The tasks are forwarded to the streams executor of the current configuration, their queue depth, latency and
+ * busy time are fed to the StreamsController. When the controller decides to change the configuration, the new tasks
+ * are held until the tasks in flight are completed, then the executor of the new configuration is created, the switch
+ * callback is called (to drop the graphs created for the old streams) and the held tasks are dispatched.
+ */
+class AdaptiveStreamsExecutor : public ov::threading::IStreamsExecutor,
+                                public std::enable_shared_from_this<AdaptiveStreamsExecutor> {
+public:
+    using Factory = std::function<std::shared_ptr<ov::threading::IStreamsExecutor>(const Config&)>;
+
+    /**
+     * @param configs streams configurations sorted by the number of streams
+     * @param current index of the configuration of the executor
+     * @param executor executor of the current configuration
+     * @param factory creates the executors of the other configurations
+     * @param settings the controller settings
+     */
+    AdaptiveStreamsExecutor(std::vector<Config> configs,
+                            size_t current,
+                            std::shared_ptr<ov::threading::IStreamsExecutor> executor,
+                            Factory factory,
+                            const StreamsController::Settings& settings = {});
+
+    /**
+     * @brief Sets the callback called after the switch, when no task is executed. Empty callback detaches the owner
+     */
+    void set_switch_callback(std::function<void()> callback);
+
+    void run(ov::threading::Task task) override;
+
+    void execute(ov::threading::Task task) override;
+
+    int get_stream_id() override;
+
+    int get_streams_num() override;
+
+    int get_numa_node_id() override;
+
+    int get_socket_id() override;
+
+    std::vector<int> get_rank() override;
+
+    void cpu_reset() override;
+
+    /**
+     * @brief Returns the log of the configuration changes, the latest last
+     */
+    std::vector<std::string> get_decisions() const;
+
+private:
+    std::shared_ptr<ov::threading::IStreamsExecutor> current() const;
+
+    void complete(StreamsController::Clock::time_point submitted,
+                  StreamsController::Clock::time_point started,
+                  size_t queueDepth);
+
+    const std::vector<Config> m_configs;
+    const Factory m_factory;
+
+    mutable std::mutex m_mutex;
+    std::shared_ptr<ov::threading::IStreamsExecutor> m_executor;
+    // the executors of all the configurations used so far, their threads are reset together
+    std::vector<std::shared_ptr<ov::threading::IStreamsExecutor>> m_usedExecutors;
+    StreamsController m_controller;
+    // number of the submitted and not completed tasks, including the held ones
+    size_t m_inFlight = 0;
+    bool m_switchPending = false;
+    std::vector<ov::threading::Task> m_held;
+
+    // guards the callback separately, since it locks the graphs, which may call execute() under the graph lock
+    std::mutex m_callbackMutex;
+    std::function<void()> m_switchCallback;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,153 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Interface of a cache which records are charged to a CacheMemoryBudget and can be evicted by the budget
+ */
+class ReclaimableCache {
+public:
+    virtual ~ReclaimableCache() = default;
+
+    /**
+     * @brief Finds the least recently used record of the cache
+     * @param keep the record which must not be evicted (i.e. the one just stored)
+     * @param lastAccess the access tick of the found record
+     * @param shard the cache specific location of the record to be passed to evictLeastRecentlyUsed()
+     * @return false if the cache has no records to evict
+     */
+    virtual bool findLeastRecentlyUsed(const void* keep, uint64_t& lastAccess, size_t& shard) const = 0;
+
+    /**
+     * @brief Evicts the least recently used record of the shard unless it is the \p keep one
+     */
+    virtual void evictLeastRecentlyUsed(size_t shard, const void* keep) = 0;
+};
+
+/**
+ * @brief Byte budget which can be shared by several caches (e.g. by the runtime caches of a graph context).
+ * Caches charge the cost of every stored record and release it on eviction. If the budget is exceeded, the least
+ * recently used records of all the attached caches are evicted until the budget is respected.
+ *
+ * @note The budget is thread safe.
+ */
+class CacheMemoryBudget {
+public:
+    using Ptr = std::shared_ptr<CacheMemoryBudget>;
+
+    /**
+     * @param limit maximum number of bytes charged by all the caches, zero means unlimited
+     */
+    explicit CacheMemoryBudget(size_t limit = 0) : m_limit(limit) {}
+
+    void setLimit(size_t limit) {
+        m_limit.store(limit, std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t limit() const {
+        return m_limit.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] size_t used() const {
+        return m_used.load(std::memory_order_relaxed);
+    }
+
+    void charge(size_t bytes) {
+        m_used.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    void release(size_t bytes) {
+        m_used.fetch_sub(bytes, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Checks whether a record of the given cost can ever fit into the budget
+     */
+    [[nodiscard]] bool fits(size_t bytes) const {
+        const auto currentLimit = limit();
+        return currentLimit == 0 || bytes <= currentLimit;
+    }
+
+    [[nodiscard]] bool exceeded() const {
+        const auto currentLimit = limit();
+        return currentLimit != 0 && used() > currentLimit;
+    }
+
+    /**
+     * @brief Returns the access tick to order the records of all the attached caches by the access time
+     */
+    uint64_t tick() {
+        return m_clock.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void attach(ReclaimableCache* cache) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_caches.push_back(cache);
+    }
+
+    void detach(ReclaimableCache* cache) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_caches.erase(std::remove(m_caches.begin(), m_caches.end(), cache), m_caches.end());
+    }
+
+    /**
+     * @brief Evicts the least recently used records of all the attached caches until the budget is respected
+     * @param keep the record which must not be evicted (i.e. the one just stored)
+     */
+    void reclaim(const void* keep) {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        while (exceeded()) {
+            ReclaimableCache* victim = nullptr;
+            size_t victimShard = 0;
+            uint64_t oldestAccess = std::numeric_limits<uint64_t>::max();
+            for (auto* cache : m_caches) {
+                uint64_t lastAccess = 0;
+                size_t shard = 0;
+                if (cache->findLeastRecentlyUsed(keep, lastAccess, shard) && lastAccess < oldestAccess) {
+                    victim = cache;
+                    victimShard = shard;
+                    oldestAccess = lastAccess;
+                }
+            }
+            if (!victim) {
+                return;
+            }
+            victim->evictLeastRecentlyUsed(victimShard, keep);
+        }
+    }
+
+private:
+    std::atomic<size_t> m_limit;
+    std::atomic<size_t> m_used{0};
+    std::atomic<uint64_t> m_clock{0};
+    std::mutex m_mutex;
+    std::vector<ReclaimableCache*> m_caches;
+};
+
+/**
+ * @brief Counters of a cache, can be updated and read concurrently
+ */
+struct CacheStatistics {
+    std::atomic<uint64_t> hits{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> evictions{0};
+    // total cost of the records currently stored in the cache
+    std::atomic<uint64_t> bytes{0};
+};
+
+using CacheStatisticsPtr = std::shared_ptr<CacheStatistics>;
+
+}  // namespace ov::intel_cpu
@@ -4,15 +4,43 @@
 
 #pragma once
 
+#include <atomic>
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <type_traits>
 #include <utility>
 
-#include "lru_cache.h"
+#include "cache_budget.h"
+#include "concurrent_lru_cache.h"
 
 namespace ov::intel_cpu {
 
+template <typename T, typename = void>
+struct HasFootprint : std::false_type {};
+
+template <typename T>
+struct HasFootprint<T, std::void_t<decltype(std::declval<const T&>()->footprint())>> : std::true_type {};
+
+/**
+ * @brief Default cost of a cache record in bytes: the size of the record itself plus the footprint of the value, if
+ * the value points to an object which provides size_t footprint() const method (e.g. a primitive reporting the memory
+ * consumed by its JIT kernels).
+ */
+template <typename KeyType, typename ValType>
+size_t defaultRecordCost(const ValType& val) {
+    // the LRU list node and the hash map node
+    constexpr size_t recordOverhead = 4 * sizeof(void*);
+    size_t cost = sizeof(KeyType) + sizeof(ValType) + recordOverhead;
+    if constexpr (HasFootprint<ValType>::value) {
+        if (val) {
+            cost += val->footprint();
+        }
+    }
+    return cost;
+}
+
 class CacheEntryBase {
 public:
     enum class LookUpStatus : int8_t { Hit, Miss };
@@ -25,31 +53,45 @@ public:
  * @tparam KeyType is a key type that must define hash() const method with return type convertible to size_t and define
  * comparison operator.
  * @tparam ValType is a type that must meet all the requirements to the std::unordered_map mapped type
- * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType) and ValueType get(const
- * KeyType&) interface and must have constructor of type ImplType(size_t).
+ * @tparam ImplType is a type for the internal storage. It must provide put(KeyType, ValueType, size_t cost) and
+ * ValueType get(const KeyType&) interface and must have constructor of type ImplType(size_t, CacheMemoryBudget::Ptr,
+ * CacheStatisticsPtr).
  *
  * @note In this implementation default constructed value objects are treated as empty objects.
  */
 
-template <typename KeyType, typename ValType, typename ImplType = LruCache<KeyType, ValType>>
+template <typename KeyType, typename ValType, typename ImplType = ConcurrentLruCache<KeyType, ValType>>
 class CacheEntry : public CacheEntryBase {
 public:
     using ResultType = std::pair<ValType, LookUpStatus>;
+    using CostType = std::function<size_t(const ValType&)>;
 
-    explicit CacheEntry(size_t capacity) : _impl(capacity) {}
+    explicit CacheEntry(size_t capacity,
+                        CacheMemoryBudget::Ptr budget = nullptr,
+                        CacheStatisticsPtr statistics = nullptr)
+        : _statistics(statistics ? std::move(statistics) : std::make_shared<CacheStatistics>()),
+          _impl(capacity, std::move(budget), _statistics) {}
 
     /**
      * @brief Searches the key in the underlying storage and returns value if it exists, or creates a value using the
      * builder functor and adds it to the underlying storage.
      * @param key is the search key
      * @param builder is a callable object that creates the ValType object from the KeyType lval reference
+     * @param cost is a callable object that returns the cost of the created value in bytes, defaultRecordCost is used
+     * if empty
      * @return result of the operation which is a pair of the requested object of ValType and the status of whether the
      * cache hit or miss occurred
+     *
+     * @note The builder is called without any lock held, so the same value may be built concurrently by several
+     * threads, the last one is kept in the cache.
      */
 
-    ResultType getOrCreate(const KeyType& key, std::function<ValType(const KeyType&)> builder) {
+    ResultType getOrCreate(const KeyType& key,
+                           std::function<ValType(const KeyType&)> builder,
+                           const CostType& cost = nullptr) {
         if (0 == _impl.getCapacity()) {
             // fast track
+            _statistics->misses.fetch_add(1, std::memory_order_relaxed);
             return {builder(key), CacheEntryBase::LookUpStatus::Miss};
         }
         auto retStatus = LookUpStatus::Hit;
@@ -59,12 +101,15 @@ public:
             retStatus = LookUpStatus::Miss;
             retVal = builder(key);
             if (retVal != retEmpty) {
-                _impl.put(key, retVal);
+                _impl.put(key, retVal, cost ? cost(retVal) : defaultRecordCost<KeyType>(retVal));
             }
         }
+        auto& counter = retStatus == LookUpStatus::Hit ? _statistics->hits : _statistics->misses;
+        counter.fetch_add(1, std::memory_order_relaxed);
         return {retVal, retStatus};
     }
 
+    CacheStatisticsPtr _statistics;
     ImplType _impl;
 };
 
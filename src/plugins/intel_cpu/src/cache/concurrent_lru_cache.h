@@ -0,0 +1,246 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "cache_budget.h"
+
+/**
+ * @brief Thread safe preemptive cache with LRU eviction policy.
+ * The records are distributed over several independently locked shards by the key hash, so concurrent lookups of
+ * different keys rarely contend. The LRU order is maintained per shard. Small caches use a single shard, so the
+ * eviction order is exact for them.
+ * Every record is charged with its cost (in bytes) to the byte budget, which can be shared with other caches. The budget
+ * evicts the least recently used records of all the caches sharing it, once it is exceeded.
+ * @tparam Key is a key type that must define hash() const method with return type convertible to size_t and define
+ * comparison operator.
+ * @tparam Value is a type that must meet all the requirements to the std::unordered_map mapped type
+ */
+
+namespace ov::intel_cpu {
+
+template <typename Key, typename Value>
+class ConcurrentLruCache : public ReclaimableCache {
+public:
+    /**
+     * @param capacity maximum number of records
+     * @param budget byte budget to charge the records cost to, nullptr means unlimited
+     * @param statistics counters to be updated, can be shared with the owner of the cache
+     */
+    explicit ConcurrentLruCache(size_t capacity,
+                                CacheMemoryBudget::Ptr budget = nullptr,
+                                CacheStatisticsPtr statistics = nullptr)
+        : _budget(budget ? std::move(budget) : std::make_shared<CacheMemoryBudget>()),
+          _statistics(statistics ? std::move(statistics) : std::make_shared<CacheStatistics>()),
+          _shards(shardsNum(capacity)),
+          _capacity(capacity) {
+        for (size_t i = 0; i < _shards.size(); i++) {
+            _shards[i].capacity = capacity / _shards.size() + (i < capacity % _shards.size() ? 1 : 0);
+        }
+        _budget->attach(this);
+    }
+
+    ConcurrentLruCache(const ConcurrentLruCache&) = delete;
+    ConcurrentLruCache& operator=(const ConcurrentLruCache&) = delete;
+
+    ~ConcurrentLruCache() override {
+        _budget->detach(this);
+        for (auto& shard : _shards) {
+            for (const auto& record : shard.lruList) {
+                releaseCost(record.cost);
+            }
+        }
+    }
+
+    /**
+     * @brief Puts the value associated with the key into the cache.
+     * @param key
+     * @param value
+     * @param cost of the record in bytes. The record is not stored if its cost alone exceeds the budget.
+     */
+    void put(const Key& key, const Value& val, size_t cost = 0) {
+        if (0 == _capacity || !_budget->fits(cost)) {
+            return;
+        }
+        const Record* stored = nullptr;
+        {
+            auto& shard = _shards[shardIndex(key)];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            auto mapItr = shard.cacheMapper.find(key);
+            if (mapItr != shard.cacheMapper.end()) {
+                touch(shard, mapItr->second);
+                releaseCost(mapItr->second->cost);
+                mapItr->second->value = val;
+                mapItr->second->cost = cost;
+                stored = &*mapItr->second;
+            } else {
+                if (shard.cacheMapper.size() == shard.capacity) {
+                    evictOne(shard);
+                }
+                auto itr = shard.lruList.insert(shard.lruList.begin(), {key, val, cost, _budget->tick()});
+                shard.cacheMapper.insert({key, itr});
+                stored = &*itr;
+            }
+            chargeCost(cost);
+        }
+        if (_budget->exceeded()) {
+            _budget->reclaim(stored);
+        }
+    }
+
+    /**
+     * @brief Searches a value associated with the key.
+     * @param key
+     * @return Value associated with the key or default constructed instance of the Value type.
+     */
+    Value get(const Key& key) {
+        auto& shard = _shards[shardIndex(key)];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        auto itr = shard.cacheMapper.find(key);
+        if (itr == shard.cacheMapper.end()) {
+            return Value();
+        }
+
+        touch(shard, itr->second);
+        return itr->second->value;
+    }
+
+    bool findLeastRecentlyUsed(const void* keep, uint64_t& lastAccess, size_t& shardIdx) const override {
+        bool found = false;
+        for (size_t i = 0; i < _shards.size(); i++) {
+            const auto& shard = _shards[i];
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            if (shard.lruList.empty() || &shard.lruList.back() == keep) {
+                continue;
+            }
+            if (!found || shard.lruList.back().lastAccess < lastAccess) {
+                found = true;
+                lastAccess = shard.lruList.back().lastAccess;
+                shardIdx = i;
+            }
+        }
+        return found;
+    }
+
+    void evictLeastRecentlyUsed(size_t shardIdx, const void* keep) override {
+        auto& shard = _shards[shardIdx];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        if (!shard.lruList.empty() && &shard.lruList.back() != keep) {
+            evictOne(shard);
+        }
+    }
+
+    /**
+     * @brief Evicts n least recently used cache records of every shard
+     * @param n number of records to be evicted, can be greater than capacity
+     */
+    void evict(size_t n) {
+        for (auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            for (size_t i = 0; i < n && !shard.lruList.empty(); ++i) {
+                evictOne(shard);
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the current capacity value
+     * @return the current capacity value
+     */
+    [[nodiscard]] size_t getCapacity() const noexcept {
+        return _capacity;
+    }
+
+    /**
+     * @brief Returns the number of the stored records
+     */
+    [[nodiscard]] size_t size() const {
+        size_t result = 0;
+        for (const auto& shard : _shards) {
+            std::lock_guard<std::mutex> lock(shard.mutex);
+            result += shard.cacheMapper.size();
+        }
+        return result;
+    }
+
+private:
+    // a shard is not worth its overhead unless it can hold at least this number of records
+    static constexpr size_t minShardCapacity = 64;
+    static constexpr size_t maxShardsNum = 16;
+
+    struct Record {
+        Key key;
+        Value value;
+        size_t cost;
+        uint64_t lastAccess;
+    };
+
+    struct key_hasher {
+        std::size_t operator()(const Key& k) const {
+            return k.hash();
+        }
+    };
+
+    using lru_list_type = std::list<Record>;
+    using cache_map_value_type = typename lru_list_type::iterator;
+
+    struct Shard {
+        mutable std::mutex mutex;
+        lru_list_type lruList;
+        std::unordered_map<Key, cache_map_value_type, key_hasher> cacheMapper;
+        size_t capacity = 0;
+    };
+
+    static size_t shardsNum(size_t capacity) {
+        return std::clamp<size_t>(capacity / minShardCapacity, 1, maxShardsNum);
+    }
+
+    size_t shardIndex(const Key& key) const {
+        // the low bits of the hash select the bucket inside the shard, so use the high ones to select the shard
+        const size_t hash = key_hasher()(key);
+        return (hash ^ (hash >> 17U)) % _shards.size();
+    }
+
+    // must be called under the shard lock, so the access ticks are ordered within the shard
+    void touch(Shard& shard, typename lru_list_type::iterator itr) {
+        itr->lastAccess = _budget->tick();
+        shard.lruList.splice(shard.lruList.begin(), shard.lruList, itr);
+    }
+
+    // must be called under the shard lock
+    void evictOne(Shard& shard) {
+        const auto& record = shard.lruList.back();
+        releaseCost(record.cost);
+        shard.cacheMapper.erase(record.key);
+        shard.lruList.pop_back();
+        _statistics->evictions.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void chargeCost(size_t cost) {
+        _budget->charge(cost);
+        _statistics->bytes.fetch_add(cost, std::memory_order_relaxed);
+    }
+
+    void releaseCost(size_t cost) {
+        _budget->release(cost);
+        _statistics->bytes.fetch_sub(cost, std::memory_order_relaxed);
+    }
+
+    CacheMemoryBudget::Ptr _budget;
+    CacheStatisticsPtr _statistics;
+    std::vector<Shard> _shards;
+    size_t _capacity;
+};
+
+}  // namespace ov::intel_cpu
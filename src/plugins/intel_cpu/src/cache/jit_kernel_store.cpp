@@ -0,0 +1,566 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "jit_kernel_store.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/version.hpp"
+#include "openvino/util/file_util.hpp"
+#include "openvino/util/mmap_object.hpp"
+#include "utils/debug_capabilities.h"
+
+#if defined(__linux__)
+#    include <fcntl.h>
+#    include <sys/file.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
+#if defined(OPENVINO_ARCH_X86_64)
+#    include "cpu/x64/cpu_isa_traits.hpp"
+#endif
+
+namespace ov::intel_cpu {
+
+namespace {
+
+constexpr size_t pageSize = 4096;
+
+struct RecordHeader {
+    uint32_t keySize;
+    uint32_t codeSize;
+    uint32_t relocationsNum;
+    uint32_t checksum;
+};
+
+uint32_t crc32(const uint8_t* data, size_t size, uint32_t crc = 0) {
+    static const auto table = [] {
+        std::array<uint32_t, 256> result{};
+        for (uint32_t i = 0; i < result.size(); i++) {
+            uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1U) ? 0xEDB88320U ^ (c >> 1U) : c >> 1U;
+            }
+            result[i] = c;
+        }
+        return result;
+    }();
+    crc = ~crc;
+    for (size_t i = 0; i < size; i++) {
+        crc = table[(crc ^ data[i]) & 0xFFU] ^ (crc >> 8U);
+    }
+    return ~crc;
+}
+
+uint32_t recordChecksum(const uint8_t* payload, size_t payloadSize) {
+    return crc32(payload, payloadSize);
+}
+
+#if defined(__linux__)
+constexpr std::array<char, 8> storeMagic{'O', 'V', 'C', 'P', 'U', 'J', 'I', 'T'};
+constexpr uint32_t storeFormatVersion = 1;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    uint32_t formatVersion;
+    uint32_t versionSize;
+    uint64_t isaFeatures;
+};
+
+uint64_t hostIsaFeatures() {
+    uint64_t features = 0;
+#    if defined(OPENVINO_ARCH_X86_64)
+    using namespace dnnl::impl::cpu::x64;
+    const cpu_isa_t isas[] = {sse41,
+                              avx,
+                              avx2,
+                              avx2_vnni,
+                              avx2_vnni_2,
+                              avx512_core,
+                              avx512_core_vnni,
+                              avx512_core_bf16,
+                              avx512_core_fp16,
+                              avx512_core_amx,
+                              avx512_core_amx_fp16};
+    for (size_t i = 0; i < std::size(isas); i++) {
+        if (mayiuse(isas[i])) {
+            features |= (1ULL << i);
+        }
+    }
+#    endif
+    return features;
+}
+
+std::string headerBlob() {
+    const std::string version = ov::get_openvino_version().buildNumber;
+    FileHeader header{storeMagic, storeFormatVersion, static_cast<uint32_t>(version.size()), hostIsaFeatures()};
+    std::string blob(sizeof(header), '\0');
+    std::memcpy(blob.data(), &header, sizeof(header));
+    blob += version;
+    return blob;
+}
+
+template <typename T>
+void append(std::string& blob, const T* data, size_t count) {
+    blob.append(reinterpret_cast<const char*>(data), sizeof(T) * count);
+}
+
+// sorted address ranges mapped into the process
+std::vector<std::pair<uint64_t, uint64_t>> processMemoryRanges() {
+    std::vector<std::pair<uint64_t, uint64_t>> ranges;
+    std::ifstream maps("/proc/self/maps");
+    std::string line;
+    while (std::getline(maps, line)) {
+        const auto dash = line.find('-');
+        const auto space = line.find(' ');
+        if (dash == std::string::npos || space == std::string::npos || dash > space) {
+            continue;
+        }
+        try {
+            ranges.emplace_back(std::stoull(line.substr(0, dash), nullptr, 16),
+                                std::stoull(line.substr(dash + 1, space - dash - 1), nullptr, 16));
+        } catch (const std::exception&) {
+            continue;
+        }
+    }
+    std::sort(ranges.begin(), ranges.end());
+    return ranges;
+}
+
+bool pointsToProcessMemory(const std::vector<std::pair<uint64_t, uint64_t>>& ranges, uint64_t value) {
+    auto itr = std::upper_bound(ranges.begin(), ranges.end(), std::make_pair(value, UINT64_MAX));
+    return itr != ranges.begin() && value < std::prev(itr)->second;
+}
+
+// the store contains the code to be executed, so nobody but the owner may modify it
+bool isTrusted(const std::string& path, bool directory) {
+    struct stat st {};
+    if (lstat(path.c_str(), &st) != 0) {
+        return false;
+    }
+    if (directory ? !S_ISDIR(st.st_mode) : !S_ISREG(st.st_mode)) {
+        return false;
+    }
+    const mode_t forbidden = directory ? (S_IRWXG | S_IRWXO) : (S_IWGRP | S_IWOTH);
+    return st.st_uid == geteuid() && (st.st_mode & forbidden) == 0;
+}
+
+void writeAll(int fd, const char* data, size_t size, const std::string& path) {
+    while (size > 0) {
+        const auto written = ::write(fd, data, size);
+        OPENVINO_ASSERT(written > 0, "Failed to write ", path);
+        data += written;
+        size -= static_cast<size_t>(written);
+    }
+}
+
+/**
+ * @brief Serializes the modifications of the store file by the concurrent processes. The store file itself can not be
+ * locked, since the compaction replaces it with another file.
+ */
+class StoreFileLock {
+public:
+    explicit StoreFileLock(const std::string& storePath)
+        : m_fd(::open((storePath + ".lock").c_str(), O_RDWR | O_CREAT | O_CLOEXEC | O_NOFOLLOW, S_IRUSR | S_IWUSR)) {
+        OPENVINO_ASSERT(m_fd >= 0, "Failed to open the lock file of ", storePath);
+        if (flock(m_fd, LOCK_EX) != 0) {
+            ::close(m_fd);
+            OPENVINO_THROW("Failed to lock ", storePath);
+        }
+    }
+    ~StoreFileLock() {
+        flock(m_fd, LOCK_UN);
+        ::close(m_fd);
+    }
+
+    StoreFileLock(const StoreFileLock&) = delete;
+    StoreFileLock& operator=(const StoreFileLock&) = delete;
+
+private:
+    int m_fd;
+};
+#endif
+
+}  // namespace
+
+#if defined(__linux__)
+JitExecutableCode::JitExecutableCode(const uint8_t* code, size_t size, const std::vector<uint32_t>& relocations)
+    : m_size(size),
+      m_allocatedSize((size + pageSize - 1) / pageSize * pageSize) {
+    void* memory = mmap(nullptr, m_allocatedSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    OPENVINO_ASSERT(memory != MAP_FAILED, "Failed to allocate memory for the JIT kernel");
+    m_code = static_cast<uint8_t*>(memory);
+    std::memcpy(m_code, code, size);
+    // the relocation slots contain the offsets inside the code
+    const auto base = reinterpret_cast<uint64_t>(m_code);
+    for (const auto offset : relocations) {
+        uint64_t value = 0;
+        std::memcpy(&value, m_code + offset, sizeof(value));
+        value += base;
+        std::memcpy(m_code + offset, &value, sizeof(value));
+    }
+    if (mprotect(m_code, m_allocatedSize, PROT_READ | PROT_EXEC) != 0) {
+        munmap(m_code, m_allocatedSize);
+        OPENVINO_THROW("Failed to make the JIT kernel memory executable");
+    }
+}
+
+JitExecutableCode::~JitExecutableCode() {
+    if (m_code) {
+        munmap(m_code, m_allocatedSize);
+    }
+}
+#else
+JitExecutableCode::JitExecutableCode([[maybe_unused]] const uint8_t* code,
+                                     [[maybe_unused]] size_t size,
+                                     [[maybe_unused]] const std::vector<uint32_t>& relocations) {
+    OPENVINO_THROW("JIT kernel store is not supported on this platform");
+}
+
+JitExecutableCode::~JitExecutableCode() = default;
+#endif
+
+JitKernelStore::Ptr JitKernelStore::get(const std::string& dir, size_t sizeCap) {
+    static std::mutex mutex;
+    static std::unordered_map<std::string, std::weak_ptr<JitKernelStore>> stores;
+
+    const auto path = (std::filesystem::path(dir) / "cpu_jit_kernels.bin").string();
+    std::lock_guard<std::mutex> lock(mutex);
+    auto store = stores[path].lock();
+    if (!store) {
+        store = std::make_shared<JitKernelStore>(path, sizeCap);
+        stores[path] = store;
+    }
+    return store;
+}
+
+JitKernelStore::JitKernelStore(std::string path, size_t sizeCap) : m_path(std::move(path)), m_sizeCap(sizeCap) {
+#if defined(__linux__)
+    try {
+        const auto dir = std::filesystem::path(m_path).parent_path();
+        if (!dir.empty() && !ov::util::directory_exists(dir)) {
+            if (dir.has_parent_path()) {
+                ov::util::create_directory_recursive(dir.parent_path());
+            }
+            OPENVINO_ASSERT(mkdir(dir.c_str(), S_IRWXU) == 0 || errno == EEXIST, "Failed to create ", dir);
+        }
+        OPENVINO_ASSERT(isTrusted(dir.empty() ? std::string(".") : dir.string(), true),
+                        "The directory must be owned by the current user and not accessible by the others");
+        open();
+        m_enabled = true;
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Failed to open JIT kernel store ", m_path, ": ", e.what());
+        m_index.clear();
+        m_mapped.reset();
+    }
+#endif
+}
+
+#if defined(__linux__)
+void JitKernelStore::open() {
+    // the compaction must see the records appended by the other processes, so it is done under the lock
+    StoreFileLock lock(m_path);
+    if (!ov::util::file_exists(std::filesystem::path(m_path))) {
+        return;
+    }
+    OPENVINO_ASSERT(isTrusted(m_path, false),
+                    "The file must be owned by the current user and not writable by the others");
+    if (std::filesystem::file_size(m_path) == 0) {
+        return;
+    }
+    m_mapped = ov::load_mmap_object(std::filesystem::path(m_path));
+    const auto* data = reinterpret_cast<const uint8_t*>(m_mapped->data());
+    const size_t size = m_mapped->size();
+    m_fileSize = size;
+
+    const auto expectedHeader = headerBlob();
+    if (size < expectedHeader.size() || std::memcmp(data, expectedHeader.data(), expectedHeader.size()) != 0) {
+        // another plugin version or another CPU, start from scratch
+        compact({});
+        return;
+    }
+
+    std::vector<RecordView> records;
+    size_t offset = expectedHeader.size();
+    while (offset + sizeof(RecordHeader) <= size) {
+        RecordHeader header{};
+        std::memcpy(&header, data + offset, sizeof(header));
+        const size_t recordSize = sizeof(header) + static_cast<size_t>(header.keySize) + header.codeSize +
+                                  static_cast<size_t>(header.relocationsNum) * sizeof(uint32_t);
+        if (header.codeSize == 0 || recordSize > size - offset) {
+            // torn record, the rest of the file is dropped by the compaction
+            break;
+        }
+        records.push_back({data + offset, recordSize});
+        offset += recordSize;
+    }
+
+    if (offset != size || size > m_sizeCap) {
+        compact(records);
+        return;
+    }
+
+    for (const auto& record : records) {
+        RecordHeader header{};
+        std::memcpy(&header, record.begin, sizeof(header));
+        m_index[std::string(reinterpret_cast<const char*>(record.begin + sizeof(header)), header.keySize)] = record;
+    }
+}
+
+void JitKernelStore::compact(const std::vector<RecordView>& records) {
+    // keep the most recently added valid records within the 3/4 of the cap, so the compaction is not repeated on every
+    // open
+    std::vector<RecordView> kept;
+    size_t keptSize = 0;
+    for (auto itr = records.rbegin(); itr != records.rend(); ++itr) {
+        RecordHeader header{};
+        std::memcpy(&header, itr->begin, sizeof(header));
+        if (recordChecksum(itr->begin + sizeof(header), itr->size - sizeof(header)) != header.checksum) {
+            continue;
+        }
+        if (keptSize + itr->size > m_sizeCap / 4 * 3) {
+            break;
+        }
+        keptSize += itr->size;
+        kept.push_back(*itr);
+    }
+
+    const auto tmpPath = m_path + ".tmp" + std::to_string(getpid());
+    {
+        std::filesystem::remove(tmpPath);
+        const int fd = ::open(tmpPath.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, S_IRUSR | S_IWUSR);
+        OPENVINO_ASSERT(fd >= 0, "Failed to create ", tmpPath);
+        try {
+            const auto header = headerBlob();
+            writeAll(fd, header.data(), header.size(), tmpPath);
+            for (auto itr = kept.rbegin(); itr != kept.rend(); ++itr) {
+                writeAll(fd, reinterpret_cast<const char*>(itr->begin), itr->size, tmpPath);
+            }
+        } catch (...) {
+            ::close(fd);
+            std::filesystem::remove(tmpPath);
+            throw;
+        }
+        ::close(fd);
+    }
+    m_index.clear();
+    m_mapped.reset();
+    // the rename is atomic, so the concurrent processes see either the old or the new file
+    std::filesystem::rename(tmpPath, m_path);
+
+    m_mapped = ov::load_mmap_object(std::filesystem::path(m_path));
+    const auto* data = reinterpret_cast<const uint8_t*>(m_mapped->data());
+    m_fileSize = m_mapped->size();
+    size_t offset = headerBlob().size();
+    while (offset < m_fileSize) {
+        RecordHeader header{};
+        std::memcpy(&header, data + offset, sizeof(header));
+        const size_t recordSize = sizeof(header) + static_cast<size_t>(header.keySize) + header.codeSize +
+                                  static_cast<size_t>(header.relocationsNum) * sizeof(uint32_t);
+        m_index[std::string(reinterpret_cast<const char*>(data + offset + sizeof(header)), header.keySize)] = {
+            data + offset,
+            recordSize};
+        offset += recordSize;
+    }
+}
+#endif
+
+JitExecutableCodePtr JitKernelStore::load(const std::string& key) {
+    RecordView record{};
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto itr = m_index.find(key);
+        if (itr == m_index.end()) {
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        record = itr->second;
+    }
+
+    RecordHeader header{};
+    std::memcpy(&header, record.begin, sizeof(header));
+    const auto* payload = record.begin + sizeof(header);
+    if (recordChecksum(payload, record.size - sizeof(header)) != header.checksum) {
+        DEBUG_LOG("JIT kernel store record is corrupted: ", m_path);
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_index.erase(key);
+        m_misses.fetch_add(1, std::memory_order_relaxed);
+        return nullptr;
+    }
+
+    const auto* code = payload + header.keySize;
+    std::vector<uint32_t> relocations(header.relocationsNum);
+    std::memcpy(relocations.data(), code + header.codeSize, relocations.size() * sizeof(uint32_t));
+    for (const auto offset : relocations) {
+        if (static_cast<size_t>(offset) + sizeof(uint64_t) > header.codeSize) {
+            m_misses.fetch_add(1, std::memory_order_relaxed);
+            return nullptr;
+        }
+    }
+
+    m_hits.fetch_add(1, std::memory_order_relaxed);
+    return std::make_shared<JitExecutableCode>(code, header.codeSize, relocations);
+}
+
+bool JitKernelStore::store(const std::string& key, const uint8_t* code, const uint8_t* sameCode, size_t size) {
+#if defined(__linux__)
+    std::vector<uint32_t> relocations;
+    if (!m_enabled || size == 0 || size > UINT32_MAX || !findRelocations(code, sameCode, size, relocations)) {
+        return false;
+    }
+
+    std::string payload = key;
+    const size_t codeOffset = payload.size();
+    append(payload, code, size);
+    // store the offsets inside the code in the relocation slots
+    const auto base = reinterpret_cast<uint64_t>(code);
+    for (const auto offset : relocations) {
+        uint64_t value = 0;
+        std::memcpy(&value, payload.data() + codeOffset + offset, sizeof(value));
+        value -= base;
+        std::memcpy(payload.data() + codeOffset + offset, &value, sizeof(value));
+    }
+    append(payload, relocations.data(), relocations.size());
+
+    const RecordHeader header{static_cast<uint32_t>(key.size()),
+                              static_cast<uint32_t>(size),
+                              static_cast<uint32_t>(relocations.size()),
+                              recordChecksum(reinterpret_cast<const uint8_t*>(payload.data()), payload.size())};
+    std::string record;
+    append(record, &header, 1);
+    record += payload;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_fileSize + record.size() > m_sizeCap) {
+        return false;
+    }
+    try {
+        // the file is opened under the lock, so the record is never appended to the file replaced by the compaction
+        StoreFileLock fileLock(m_path);
+        const int fd =
+            ::open(m_path.c_str(), O_WRONLY | O_APPEND | O_CREAT | O_CLOEXEC | O_NOFOLLOW, S_IRUSR | S_IWUSR);
+        if (fd < 0) {
+            return false;
+        }
+        struct stat st {};
+        bool written = fstat(fd, &st) == 0 && st.st_uid == geteuid() &&
+                       static_cast<size_t>(st.st_size) + record.size() <= m_sizeCap;
+        if (written) {
+            if (st.st_size == 0) {
+                const auto fileHeader = headerBlob();
+                written = ::write(fd, fileHeader.data(), fileHeader.size()) == static_cast<ssize_t>(fileHeader.size());
+            }
+            written = written && ::write(fd, record.data(), record.size()) == static_cast<ssize_t>(record.size());
+            m_fileSize = static_cast<size_t>(st.st_size) + record.size();
+        }
+        ::close(fd);
+        return written;
+    } catch (const std::exception& e) {
+        DEBUG_LOG("Failed to append to JIT kernel store ", m_path, ": ", e.what());
+        return false;
+    }
+#else
+    (void)key;
+    (void)code;
+    (void)sameCode;
+    (void)size;
+    return false;
+#endif
+}
+
+bool JitKernelStore::findRelocations(const uint8_t* code,
+                                     const uint8_t* sameCode,
+                                     size_t size,
+                                     std::vector<uint32_t>& relocations) {
+    relocations.clear();
+#if defined(__linux__)
+    const auto base = reinterpret_cast<uint64_t>(code);
+    const auto sameBase = reinterpret_cast<uint64_t>(sameCode);
+    // the code may rely on the alignment of its start address
+    if (base % pageSize != 0 || sameBase % pageSize != 0 || base == sameBase) {
+        return false;
+    }
+
+    auto pointsInside = [size](uint64_t value, uint64_t codeBase) {
+        return value >= codeBase && value <= codeBase + size;
+    };
+
+    // the copies may differ only in the 64-bit absolute addresses of the code labels. Any other difference
+    // (e.g. a rel32 displacement of a call or a jump to a target outside the code) can not be relocated
+    size_t minStart = 0;
+    for (size_t i = 0; i < size;) {
+        if (code[i] == sameCode[i]) {
+            i++;
+            continue;
+        }
+        bool relocated = false;
+        for (size_t j = std::max(minStart, i >= 7 ? i - 7 : 0); j <= i && j + sizeof(uint64_t) <= size; j++) {
+            uint64_t value = 0;
+            uint64_t sameValue = 0;
+            std::memcpy(&value, code + j, sizeof(value));
+            std::memcpy(&sameValue, sameCode + j, sizeof(sameValue));
+            if (pointsInside(value, base) && pointsInside(sameValue, sameBase) &&
+                value - base == sameValue - sameBase) {
+                relocations.push_back(static_cast<uint32_t>(j));
+                i = minStart = j + sizeof(uint64_t);
+                relocated = true;
+                break;
+            }
+        }
+        if (!relocated) {
+            return false;
+        }
+    }
+
+    // the same absolute address in both copies may point to a function or data of the process
+    const auto ranges = processMemoryRanges();
+    auto overlapsRelocation = [&relocations](size_t begin, size_t end) {
+        auto itr = std::upper_bound(relocations.begin(), relocations.end(), static_cast<uint32_t>(begin));
+        if (itr != relocations.begin() && *std::prev(itr) + sizeof(uint64_t) > begin) {
+            return true;
+        }
+        return itr != relocations.end() && *itr < end;
+    };
+    for (size_t j = 0; j + sizeof(uint32_t) <= size; j++) {
+        uint32_t value32 = 0;
+        std::memcpy(&value32, code + j, sizeof(value32));
+        if (value32 >= pageSize && pointsToProcessMemory(ranges, value32) &&
+            !overlapsRelocation(j, j + sizeof(uint32_t))) {
+            return false;
+        }
+        if (j + sizeof(uint64_t) <= size) {
+            uint64_t value = 0;
+            std::memcpy(&value, code + j, sizeof(value));
+            if (value >= pageSize && pointsToProcessMemory(ranges, value) &&
+                !overlapsRelocation(j, j + sizeof(uint64_t))) {
+                return false;
+            }
+        }
+    }
+    return true;
+#else
+    (void)code;
+    (void)sameCode;
+    (void)size;
+    return false;
+#endif
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,147 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/util/mmap_object.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Executable copy of a machine code loaded from the JIT kernel store.
+ * The memory is released on destruction, so the object must outlive all the calls of the code.
+ */
+class JitExecutableCode {
+public:
+    JitExecutableCode(const uint8_t* code, size_t size, const std::vector<uint32_t>& relocations);
+    ~JitExecutableCode();
+
+    JitExecutableCode(const JitExecutableCode&) = delete;
+    JitExecutableCode& operator=(const JitExecutableCode&) = delete;
+
+    [[nodiscard]] const uint8_t* get() const {
+        return m_code;
+    }
+
+    [[nodiscard]] size_t size() const {
+        return m_size;
+    }
+
+private:
+    uint8_t* m_code = nullptr;
+    size_t m_size = 0;
+    size_t m_allocatedSize = 0;
+};
+
+using JitExecutableCodePtr = std::shared_ptr<const JitExecutableCode>;
+
+/**
+ * @brief Persistent store of the JIT generated machine code, which allows to skip the code generation on the next
+ * process start.
+ *
+ * The store is a single append-only file memory mapped on open. The file header contains the plugin version and the
+ * host ISA features, the file written by another plugin version or on another CPU is ignored. Every record contains
+ * the kernel key (serialized kernel parameters), the code, the relocation table and a checksum, which is verified
+ * before the code is loaded. The file exceeding the size cap is compacted on open, keeping the most recently added
+ * records.
+ *
+ * Only position independent kernels are stored: the kernel must be generated twice at different addresses, and the
+ * two copies may differ only in the 64-bit absolute addresses pointing inside the code itself (they are turned into
+ * relocations). A kernel containing any value which points to the process memory (e.g. a called function or a
+ * constant table outside the code) is rejected.
+ *
+ * Trust model: the checksum detects the torn or damaged records only, it does not protect against a malicious
+ * modification of the file. The loaded code is executed, so the store is trusted as much as the user running the
+ * process: the directory must be owned by the user and must not be accessible by the others (it is created with
+ * such permissions if does not exist), and the file must be owned by the user and must not be writable by the others.
+ * Otherwise the store is disabled.
+ *
+ * @note The store is thread safe. Concurrent processes may append to the same file, the appends and the compaction are
+ * serialized with the lock file next to the store file. A torn record fails the checksum and is dropped on the next
+ * compaction. Persistence is supported on Linux only, the store is a no-op elsewhere.
+ */
+class JitKernelStore {
+public:
+    using Ptr = std::shared_ptr<JitKernelStore>;
+
+    /**
+     * @brief Returns the store associated with the directory, the store is shared by all the compiled models of the
+     * process
+     * @param dir directory of the store file, created if does not exist
+     * @param sizeCap maximum size of the store file in bytes
+     */
+    static Ptr get(const std::string& dir, size_t sizeCap);
+
+    JitKernelStore(std::string path, size_t sizeCap);
+
+    /**
+     * @brief Loads the code associated with the key into an executable memory
+     * @return nullptr if the store does not contain the key or the record is corrupted
+     */
+    JitExecutableCodePtr load(const std::string& key);
+
+    /**
+     * @brief Appends the code to the store if the code is position independent
+     * @param key serialized kernel parameters, the ISA features and the plugin version are added by the store
+     * @param code machine code of the kernel
+     * @param sameCode the same kernel generated at another address, used to find the relocations
+     * @param size size of the code in bytes
+     * @return true if the code is stored
+     */
+    bool store(const std::string& key, const uint8_t* code, const uint8_t* sameCode, size_t size);
+
+    [[nodiscard]] uint64_t hits() const {
+        return m_hits.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t misses() const {
+        return m_misses.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] const std::string& path() const {
+        return m_path;
+    }
+
+    /**
+     * @brief Finds the offsets of the 64-bit absolute addresses pointing inside the code, comparing two copies of the
+     * code generated at different addresses.
+     * @return false if the copies have other differences or the code contains values pointing to the process memory,
+     * so the code is not position independent
+     */
+    static bool findRelocations(const uint8_t* code,
+                                const uint8_t* sameCode,
+                                size_t size,
+                                std::vector<uint32_t>& relocations);
+
+private:
+    struct RecordView {
+        const uint8_t* begin;
+        size_t size;
+    };
+
+    void open();
+    void compact(const std::vector<RecordView>& records);
+
+    const std::string m_path;
+    const size_t m_sizeCap;
+    std::mutex m_mutex;
+    std::shared_ptr<ov::MappedMemory> m_mapped;
+    std::unordered_map<std::string, RecordView> m_index;
+    size_t m_fileSize = 0;
+    // the store is disabled if the file can not be opened or is not trusted
+    bool m_enabled = false;
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+};
+
+}  // namespace ov::intel_cpu
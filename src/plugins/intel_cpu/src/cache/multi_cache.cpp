@@ -5,9 +5,18 @@
 #include "multi_cache.h"
 
 #include <atomic>
+#include <mutex>
 
 namespace ov::intel_cpu {
 
 std::atomic_size_t MultiCache::_typeIdCounter{0};
 
+MultiCache::MultiCache(const MultiCache& other)
+    : _capacity(other._capacity),
+      _budget(other._budget),
+      _statistics(other._statistics) {
+    std::lock_guard<std::mutex> lock(other._mutex);
+    _storage = other._storage;
+}
+
 }  // namespace ov::intel_cpu
@@ -7,9 +7,12 @@
 #include <atomic>
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <type_traits>
 #include <unordered_map>
+#include <utility>
 
+#include "cache_budget.h"
 #include "cache_entry.h"
 
 namespace ov::intel_cpu {
@@ -17,7 +20,8 @@ namespace ov::intel_cpu {
 /**
  * @brief Class that represent a preemptive cache for different key/value pair types.
  *
- * @attention This implementation IS NOT THREAD SAFE!
+ * @note The cache is thread safe. The cost of all the records is charged to the byte budget, which may be shared by
+ * several caches (i.e. the runtime caches of a graph context).
  */
 
 class MultiCache {
@@ -32,7 +36,16 @@ public:
      * @param capacity here means maximum records limit FOR EACH entry specified by a pair of Key/Value types.
      * @note zero capacity means empty cache so no records are stored and no entries are created
      */
-    explicit MultiCache(size_t capacity) : _capacity(capacity) {}
+    explicit MultiCache(size_t capacity, CacheMemoryBudget::Ptr budget = nullptr)
+        : _capacity(capacity),
+          _budget(budget ? std::move(budget) : std::make_shared<CacheMemoryBudget>()),
+          _statistics(std::make_shared<CacheStatistics>()) {}
+
+    /**
+     * @note The copy shares the already created entries and the statistics with the origin
+     */
+    MultiCache(const MultiCache& other);
+    MultiCache& operator=(const MultiCache&) = delete;
 
     /**
      * @brief Searches a value of ValueType in the cache using the provided key or creates a new ValueType instance (if
@@ -51,6 +64,25 @@ public:
         return entry->getOrCreate(key, std::move(builder));
     }
 
+    /**
+     * @brief Same as above, but the cost of the created record is evaluated by the provided callable object
+     * @param cost is a callable object that returns the cost in bytes of the ValueType object
+     */
+    template <typename KeyType,
+              typename BuilderType,
+              typename CostType,
+              typename ValueType = std::invoke_result_t<BuilderType&, const KeyType&>>
+    typename CacheEntry<KeyType, ValueType>::ResultType getOrCreate(const KeyType& key,
+                                                                    BuilderType builder,
+                                                                    CostType cost) {
+        auto entry = getEntry<KeyType, ValueType>();
+        return entry->getOrCreate(key, std::move(builder), std::move(cost));
+    }
+
+    [[nodiscard]] const CacheStatistics& getStatistics() const {
+        return *_statistics;
+    }
+
 private:
     template <typename T>
     size_t getTypeId();
@@ -59,6 +91,9 @@ private:
 
     static std::atomic_size_t _typeIdCounter;
     size_t _capacity;
+    CacheMemoryBudget::Ptr _budget;
+    CacheStatisticsPtr _statistics;
+    mutable std::mutex _mutex;
     std::unordered_map<size_t, EntryBasePtr> _storage;
 };
 
@@ -72,9 +107,10 @@ template <typename KeyType, typename ValueType>
 MultiCache::EntryPtr<KeyType, ValueType> MultiCache::getEntry() {
     using EntryType = EntryTypeT<KeyType, ValueType>;
     size_t id = getTypeId<EntryType>();
+    std::lock_guard<std::mutex> lock(_mutex);
     auto itr = _storage.find(id);
     if (itr == _storage.end()) {
-        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity)});
+        auto result = _storage.insert({id, std::make_shared<EntryType>(_capacity, _budget, _statistics)});
         itr = result.first;
     }
     return std::static_pointer_cast<EntryType>(itr->second);
@@ -5,15 +5,24 @@
 #include "compiled_model.h"
 
 #include <algorithm>
+#include <atomic>
+#include <cstdint>
 #include <cstring>
 #include <exception>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <ostream>
+#include <set>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "activation_arena.hpp"
+#include "adaptive_streams_executor.hpp"
 #include "async_infer_request.h"
+#include "cache/cache_budget.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "graph.h"
@@ -34,6 +43,7 @@
 #include "openvino/runtime/threading/cpu_streams_info.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
 #include "openvino/runtime/threading/itask_executor.hpp"
+#include "plugin.h"
 #include "sub_memory_manager.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -66,6 +76,10 @@ CompiledModel::~CompiledModel() {
         m_sub_compiled_models.clear();
         m_sub_memory_manager->_memorys_table.clear();
     }
+    if (m_adaptive_executor) {
+        // the executor outlives the compiled model while the tasks in flight complete
+        m_adaptive_executor->set_switch_callback({});
+    }
     auto streamsExecutor = std::dynamic_pointer_cast<ov::threading::IStreamsExecutor>(m_task_executor);
     if (streamsExecutor) {
         streamsExecutor->cpu_reset();
@@ -86,6 +100,9 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
       m_loaded_from_cache(loaded_from_cache),
       m_sub_memory_manager(std::move(sub_memory_manager)) {
     m_mutex = std::make_shared<std::mutex>();
+    if (const auto cpuPlugin = std::dynamic_pointer_cast<const Plugin>(m_plugin)) {
+        m_rtCacheBudget = cpuPlugin->getRuntimeCacheBudget();
+    }
     const auto& core = m_plugin->get_core();
     OPENVINO_ASSERT(core, "Unable to get API version. Core is unavailable");
 
@@ -119,13 +136,22 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
 
     m_optimized_single_stream = all_of(1, executor_config.get_streams(), executor_config.get_threads());
 
+    const auto& adaptive_configs = m_cfg.adaptiveStreamsConfigs;
+    const auto adaptive_current =
+        std::find_if(adaptive_configs.begin(), adaptive_configs.end(), [&](const IStreamsExecutor::Config& config) {
+            return config.get_streams() == executor_config.get_streams();
+        });
+    const bool adaptive_streams = !m_cfg.exclusiveAsyncRequests && m_cfg.numSubStreams == 0 &&
+                                  adaptive_configs.size() > 1 && adaptive_current != adaptive_configs.end();
+
     int streams = std::max(1, executor_config.get_streams());
     std::vector<Task> tasks;
     tasks.resize(streams);
-    m_graphs.resize(streams);
+    // the graphs of the other streams configurations are created on the first use
+    m_graphs.resize(adaptive_streams ? std::max(streams, adaptive_configs.back().get_streams()) : streams);
     if (executor_config.get_streams() != 0) {
         auto all_graphs_ready = [&] {
-            return std::all_of(m_graphs.begin(), m_graphs.end(), [&](Graph& graph) {
+            return std::all_of(m_graphs.begin(), m_graphs.begin() + streams, [&](Graph& graph) {
                 return graph.IsReady();
             });
         };
@@ -147,6 +173,25 @@ CompiledModel::CompiledModel(const std::shared_ptr<ov::Model>& model,
     } else {
         CompiledModel::get_graph();
     }
+    if (adaptive_streams) {
+        m_adaptive_executor = std::make_shared<AdaptiveStreamsExecutor>(
+            adaptive_configs,
+            static_cast<size_t>(std::distance(adaptive_configs.begin(), adaptive_current)),
+            std::dynamic_pointer_cast<IStreamsExecutor>(m_task_executor),
+            [plugin = m_plugin](const IStreamsExecutor::Config& config) {
+                return plugin->get_executor_manager()->get_idle_cpu_streams_executor(config);
+            });
+        // no task is executed during the switch, so the graphs are not locked by the infer requests
+        m_adaptive_executor->set_switch_callback([this] {
+            for (auto& graph : m_graphs) {
+                GraphGuard::Lock lock(graph);
+                graph.Reset();
+            }
+        });
+        m_task_executor = m_adaptive_executor;
+        set_task_executor(m_task_executor);
+        m_optimized_single_stream = false;
+    }
     if (m_cfg.numSubStreams > 0) {
         m_has_sub_compiled_models = true;
         auto sub_cfg = m_cfg;
@@ -202,17 +247,31 @@ CompiledModel::GraphGuard::Lock CompiledModel::get_graph() const {
                     auto isQuantizedFlag = (m_cfg.lpTransformsMode == Config::On) &&
                                            ov::pass::low_precision::LowPrecision::isFunctionQuantized(m_model);
                     auto cpuParallel = std::make_shared<CpuParallel>(m_cfg.tbbPartitioner);
+                    // the graph is created by the stream threads, so the replica of their NUMA node is used
+                    auto weightsCache = m_socketWeights[socketId];
+                    if (m_cfg.enableWeightsNumaReplication && streamsExecutor) {
+                        // the socket weights are used for the NUMA node missing in the CPU map
+                        if (auto numaWeightsCache = m_socketWeights.numaNode(streamsExecutor->get_numa_node_id())) {
+                            weightsCache = std::move(numaWeightsCache);
+                        }
+                    }
                     ctx = std::make_shared<GraphContext>(m_cfg,
-                                                         m_socketWeights[socketId],
+                                                         weightsCache,
                                                          isQuantizedFlag,
                                                          streamsExecutor,
                                                          cpuParallel,
-                                                         m_sub_memory_manager);
+                                                         m_sub_memory_manager,
+                                                         m_rtCacheBudget);
                 }
 
                 const std::shared_ptr<const ov::Model> model = m_model;
                 graphLock._graph.Init(model, ctx);
-                graphLock._graph.Activate();
+                graphLock._graph.Activate(m_cfg.enableLazyWeightsRepacking);
+                // the memory is leased again by the first inference.
+                // The deferred primitives creation may still refer to it, so it is released after the first inference
+                if (!m_cfg.enableLazyWeightsRepacking) {
+                    ctx->releaseLeasedMemory();
+                }
             } catch (...) {
                 exception = std::current_exception();
             }
@@ -411,6 +470,81 @@ ov::Any CompiledModel::get_property(const std::string& name) const {
     if (name == ov::weights_path) {
         return static_cast<decltype(ov::weights_path)::value_type>("");
     }
+    if (name == ov::intel_cpu::dynamic_shapes_cache_stats) {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        for (auto& streamGraph : m_graphs) {
+            // the graph may be reset meanwhile by the streams configuration switch
+            GraphGuard::Lock lock(streamGraph);
+            if (const auto& shapesCache = streamGraph.getDynamicShapesCache()) {
+                hits += shapesCache->hits();
+                misses += shapesCache->misses();
+            }
+        }
+        return decltype(ov::intel_cpu::dynamic_shapes_cache_stats)::value_type{{"hits", hits}, {"misses", misses}};
+    }
+    if (name == ov::intel_cpu::cpu_runtime_cache_stats) {
+        decltype(ov::intel_cpu::cpu_runtime_cache_stats)::value_type stats{{"hits", 0},
+                                                                           {"misses", 0},
+                                                                           {"evictions", 0},
+                                                                           {"bytes", 0}};
+        for (auto& streamGraph : m_graphs) {
+            GraphGuard::Lock lock(streamGraph);
+            const auto ctx = streamGraph.getGraphContext();
+            if (!ctx) {
+                continue;
+            }
+            for (const auto& cache : {ctx->getParamsCache(), ctx->getSnippetsParamsCache()}) {
+                const auto& cacheStats = cache->getStatistics();
+                stats["hits"] += cacheStats.hits.load(std::memory_order_relaxed);
+                stats["misses"] += cacheStats.misses.load(std::memory_order_relaxed);
+                stats["evictions"] += cacheStats.evictions.load(std::memory_order_relaxed);
+                stats["bytes"] += cacheStats.bytes.load(std::memory_order_relaxed);
+            }
+        }
+        return stats;
+    }
+    if (name == ov::intel_cpu::cpu_adaptive_streams_decisions) {
+        if (!m_adaptive_executor) {
+            return decltype(ov::intel_cpu::cpu_adaptive_streams_decisions)::value_type{};
+        }
+        return decltype(ov::intel_cpu::cpu_adaptive_streams_decisions)::value_type{
+            m_adaptive_executor->get_decisions()};
+    }
+    if (name == ov::intel_cpu::cpu_weights_numa_stats) {
+        decltype(ov::intel_cpu::cpu_weights_numa_stats)::value_type stats;
+        for (const auto& [numaNodeId, totalSize] : m_socketWeights.numaNodesTotalSize()) {
+            stats["numa_node_" + std::to_string(numaNodeId)] = totalSize;
+        }
+        return stats;
+    }
+    if (name == ov::intel_cpu::cpu_shared_activation_arena_stats) {
+        decltype(ov::intel_cpu::cpu_shared_activation_arena_stats)::value_type stats{{"leases", 0},
+                                                                                     {"overcommits", 0},
+                                                                                     {"arena_allocated_bytes", 0},
+                                                                                     {"arena_peak_leased_bytes", 0}};
+        std::set<ActivationArena::Ptr> arenas;
+        for (auto& streamGraph : m_graphs) {
+            GraphGuard::Lock lock(streamGraph);
+            const auto ctx = streamGraph.getGraphContext();
+            if (!ctx) {
+                continue;
+            }
+            const auto& memoryControl = ctx->getAuxiliaryNetworkMemoryControl();
+            if (!memoryControl->activationArena()) {
+                continue;
+            }
+            arenas.insert(memoryControl->activationArena());
+            const auto& arenaStats = *memoryControl->activationArenaStatistics();
+            stats["leases"] += arenaStats.leases.load(std::memory_order_relaxed);
+            stats["overcommits"] += arenaStats.overcommits.load(std::memory_order_relaxed);
+        }
+        for (const auto& arena : arenas) {
+            stats["arena_allocated_bytes"] += arena->allocated();
+            stats["arena_peak_leased_bytes"] += arena->peakLeased();
+        }
+        return stats;
+    }
     OPENVINO_THROW("Unsupported property: ", name);
 }
 
@@ -426,7 +560,12 @@ void CompiledModel::release_memory() {
         OPENVINO_ASSERT(lock.owns_lock(),
                         "Attempt to call release_memory() on a compiled model in a busy state. Please ensure that all "
                         "infer requests are completed before releasing memory.");
+        graph.WaitForConstants();
         auto ctx = graph.getGraphContext();
+        // the graphs of the other adaptive streams configurations may be not created
+        if (!ctx) {
+            continue;
+        }
         ctx->releaseMemory();
     }
 }
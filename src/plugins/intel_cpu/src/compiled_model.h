@@ -13,6 +13,8 @@
 #include <utility>
 #include <vector>
 
+#include "adaptive_streams_executor.hpp"
+#include "cache/cache_budget.h"
 #include "config.h"
 #include "graph.h"
 #include "openvino/core/any.hpp"
@@ -34,6 +36,10 @@ public:
 
     struct GraphGuard : public Graph {
         std::mutex _mutex;
+        // the graph is created again on the next use, e.g. for the new streams configuration
+        void Reset() {
+            ForgetGraphData();
+        }
         struct Lock : public std::unique_lock<std::mutex> {
             explicit Lock(GraphGuard& graph) : std::unique_lock<std::mutex>(graph._mutex), _graph(graph) {}
             GraphGuard& _graph;
@@ -75,6 +81,7 @@ private:
     const std::shared_ptr<const ov::IPlugin> m_plugin;
     std::shared_ptr<ov::threading::ITaskExecutor> m_task_executor = nullptr;      //!< Holds a task executor
     std::shared_ptr<ov::threading::ITaskExecutor> m_callback_executor = nullptr;  //!< Holds a callback executor
+    std::shared_ptr<AdaptiveStreamsExecutor> m_adaptive_executor = nullptr;       //!< Set if the streams are adaptive
 
     // Generic synchronization primitive on CompiledModel level.
     // Usage example: helps to avoid data races during CPU Graph initialization in multi-streams scenario
@@ -87,6 +94,8 @@ private:
     // WARNING: Do not use m_graphs directly.
     mutable std::deque<GraphGuard> m_graphs;
     mutable SocketsWeights m_socketWeights;
+    // the runtime caches of all the compiled models of the plugin are charged to the same budget
+    CacheMemoryBudget::Ptr m_rtCacheBudget;
 
     /* WARNING: Use get_graph() function to get access to graph in current stream.
      * NOTE: Main thread is interpreted as master thread of external stream so use this function to get access to graphs
@@ -24,6 +24,7 @@
 #include "openvino/runtime/weightless_properties_utils.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
+#include "utils/kv_cache_precision_policy.hpp"
 #include "utils/precision_support.h"
 
 #if defined(OPENVINO_ARCH_ARM64)
@@ -286,6 +287,99 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             // as zero that means disabling the cache
             rtCacheCapacity = std::max(val_i, 0);
             snippetsCacheCapacity = std::max(val_i, 0);
+        } else if (ov::intel_cpu::cpu_jit_kernel_cache_dir.name() == key) {
+            try {
+                jitKernelCacheDir = val.as<std::string>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_jit_kernel_cache_dir.name(),
+                               ". Expected a directory path");
+            }
+        } else if (ov::intel_cpu::cpu_jit_kernel_cache_size.name() == key) {
+            try {
+                jitKernelCacheSize = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_jit_kernel_cache_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_runtime_cache_byte_budget.name() == key) {
+            try {
+                rtCacheByteBudget = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_runtime_cache_byte_budget.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::memory_solver.name() == key) {
+            try {
+                memorySolverType = val.as<ov::intel_cpu::MemorySolverType>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::memory_solver.name(),
+                               ". Expected values: ov::intel_cpu::MemorySolverType::DEFAULT/INTERVAL_GRAPH");
+            }
+        } else if (ov::intel_cpu::cpu_shared_activation_arena.name() == key) {
+            try {
+                enableSharedActivationArena = val.as<bool>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_shared_activation_arena.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_shared_activation_arena_size.name() == key) {
+            try {
+                sharedActivationArenaSizeSetExplicitly = true;
+                sharedActivationArenaSize = val.as<uint64_t>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value for property key ",
+                               ov::intel_cpu::cpu_shared_activation_arena_size.name(),
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (ov::intel_cpu::cpu_stage_perf_counters.name() == key) {
+            try {
+                collectStagePerfCounters = val.as<bool>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_stage_perf_counters.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_weights_numa_replication.name() == key) {
+            try {
+                enableWeightsNumaReplication = val.as<bool>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_weights_numa_replication.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_lazy_weights_repacking.name() == key) {
+            try {
+                enableLazyWeightsRepacking = val.as<bool>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_lazy_weights_repacking.name(),
+                               ". Expected only true/false");
+            }
+        } else if (ov::intel_cpu::cpu_adaptive_streams.name() == key) {
+            try {
+                enableAdaptiveStreams = val.as<bool>();
+            } catch (const ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::cpu_adaptive_streams.name(),
+                               ". Expected only true/false");
+            }
         } else if (ov::intel_cpu::denormals_optimization.name() == key) {
             try {
                 denormalsOptMode = val.as<bool>() ? DenormalsOptMode::DO_On : DenormalsOptMode::DO_Off;
@@ -405,6 +499,45 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             if (alg == ov::internal::CacheQuantAlgorithm::TURBO && !valueCachePrecisionSetExplicitly) {
                 valueCachePrecision = ov::element::u4;
             }
+        } else if (key == ov::intel_cpu::kv_cache_precision_policy.name()) {
+            try {
+                kvCachePrecisionPolicy = val.as<std::string>();
+                // validates the policy
+                (void)KVCachePrecisionPolicy(kvCachePrecisionPolicy);
+            } catch (const ov::Exception& ex) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_precision_policy.name(),
+                               ": ",
+                               ex.what());
+            }
+        } else if (key == ov::intel_cpu::kv_cache_window_size.name() ||
+                   key == ov::intel_cpu::kv_cache_sink_size.name()) {
+            try {
+                const auto size = val.as<uint64_t>();
+                if (key == ov::intel_cpu::kv_cache_window_size.name()) {
+                    kvCacheWindowSize = size;
+                } else {
+                    kvCacheSinkSize = size;
+                }
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               key,
+                               ". Expected only unsigned integer numbers");
+            }
+        } else if (key == ov::intel_cpu::kv_cache_raw_state_access.name()) {
+            try {
+                kvCacheRawStateAccess = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::kv_cache_raw_state_access.name(),
+                               ". Expected only true/false.");
+            }
         } else if (key == ov::key_cache_group_size.name() || key == ov::value_cache_group_size.name()) {
             try {
                 const auto groupSize = val.as<uint64_t>();
@@ -496,6 +629,16 @@ void Config::readProperties(const ov::AnyMap& prop, const ModelType modelType) {
             } catch (ov::Exception&) {
                 OPENVINO_THROW("Wrong value for property key ", ov::intel_cpu::enable_sage_attn.name());
             }
+        } else if (key == ov::intel_cpu::enable_inter_op_parallelism.name()) {
+            try {
+                enableInterOpParallelism = val.as<bool>();
+            } catch (ov::Exception&) {
+                OPENVINO_THROW("Wrong value ",
+                               val.as<std::string>(),
+                               " for property key ",
+                               ov::intel_cpu::enable_inter_op_parallelism.name(),
+                               ". Expected only true/false");
+            }
         } else if (key == ov::enable_weightless.name()) {
             try {
                 enableWeightless = val.as<bool>();
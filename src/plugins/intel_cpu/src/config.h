@@ -14,6 +14,7 @@
 #include <string>
 #include <vector>
 
+#include "internal_properties.hpp"
 #include "openvino/core/any.hpp"
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/type/element_type.hpp"
@@ -53,6 +54,7 @@ struct Config {
     enum class ModelType : uint8_t { CNN, LLM, Unknown };
 
     bool collectPerfCounters = false;
+    bool collectStagePerfCounters = false;
     bool exclusiveAsyncRequests = false;
     SnippetsMode snippetsMode = SnippetsMode::Enable;
     std::string dumpToDot;
@@ -75,6 +77,16 @@ struct Config {
     size_t rtCacheCapacity = 5000UL;
 #endif
     size_t snippetsCacheCapacity = 5000UL;
+    uint64_t rtCacheByteBudget = 0;
+    std::string jitKernelCacheDir;
+    uint64_t jitKernelCacheSize = 128UL * 1024UL * 1024UL;
+    ov::intel_cpu::MemorySolverType memorySolverType = ov::intel_cpu::MemorySolverType::DEFAULT;
+    bool enableSharedActivationArena = false;
+    uint64_t sharedActivationArenaSize = 0;
+    bool sharedActivationArenaSizeSetExplicitly = false;
+    bool enableWeightsNumaReplication = false;
+    bool enableLazyWeightsRepacking = false;
+    bool enableAdaptiveStreams = false;
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_ARM64)
     ov::element::Type kvCachePrecision = ov::element::u8;
     ov::element::Type keyCachePrecision = ov::element::u8;
@@ -92,8 +104,18 @@ struct Config {
     // For TURBO: bits derived from cachePrecision (u3→3, u4→4).
     ov::internal::CacheQuantAlgorithm keyCacheQuantAlg = ov::internal::CacheQuantAlgorithm::SCALAR;
     ov::internal::CacheQuantAlgorithm valueCacheQuantAlg = ov::internal::CacheQuantAlgorithm::SCALAR;
+    // per layer key/value cache precisions, see ov::intel_cpu::kv_cache_precision_policy
+    std::string kvCachePrecisionPolicy;
+    // KV cache eviction of the stateful SDPA, see ov::intel_cpu::kv_cache_window_size
+    size_t kvCacheWindowSize = 0UL;
+    size_t kvCacheSinkSize = 4UL;
+    // see ov::intel_cpu::kv_cache_raw_state_access
+    bool kvCacheRawStateAccess = false;
     bool enableSageAttn = false;
+    bool enableInterOpParallelism = false;
     ov::threading::IStreamsExecutor::Config streamExecutorConfig;
+    // configurations the adaptive streams controller switches between, sorted by the number of streams
+    std::vector<ov::threading::IStreamsExecutor::Config> adaptiveStreamsConfigs;
     int streams = 1;
     bool streamsChanged = false;
     int threads = 0;
@@ -1446,9 +1446,66 @@ std::vector<std::vector<int>> generate_stream_info(const int streams,
                                                            std::move(streams_info_table),
                                                            {},
                                                            false};
+    if (config.enableAdaptiveStreams && config.numSubStreams == 0 && !config.enableCpuReservation) {
+        config.adaptiveStreamsConfigs = get_adaptive_streams_configs(config, proc_type_table);
+    }
     return proc_type_table;
 }
 
+std::vector<IStreamsExecutor::Config> get_adaptive_streams_configs(
+    const Config& config,
+    const std::vector<std::vector<int>>& proc_type_table) {
+    std::vector<int> streams_candidates;
+    if (config.streamExecutorConfig.get_streams() > 0) {
+        streams_candidates.push_back(config.streamExecutorConfig.get_streams());
+    }
+    for (int streams = 1; streams <= proc_type_table[0][ALL_PROC]; streams *= 2) {
+        streams_candidates.push_back(streams);
+    }
+
+    std::vector<IStreamsExecutor::Config> configs;
+    for (const auto streams : streams_candidates) {
+        auto streams_info_table = get_streams_info_table(streams,
+                                                         true,
+                                                         config.threads,
+                                                         0,
+                                                         0,
+                                                         false,
+                                                         ov::util::to_string(ov::hint::PerformanceMode::THROUGHPUT),
+                                                         config.modelDistributionPolicy,
+                                                         proc_type_table);
+        // the sub streams are not switched at runtime
+        if (streams_info_table.empty() || std::any_of(streams_info_table.begin(),
+                                                      streams_info_table.end(),
+                                                      [](const std::vector<int>& row) {
+                                                          return row[NUMBER_OF_STREAMS] < 0;
+                                                      })) {
+            continue;
+        }
+        IStreamsExecutor::Config candidate{"CPUStreamsExecutor",
+                                           streams,
+                                           1,
+                                           ov::hint::SchedulingCoreType::ANY_CORE,
+                                           false,
+                                           config.enableCpuPinning,
+                                           true,
+                                           std::move(streams_info_table),
+                                           {},
+                                           false};
+        const bool duplicate = std::any_of(configs.begin(), configs.end(), [&](const IStreamsExecutor::Config& c) {
+            return c.get_streams() == candidate.get_streams();
+        });
+        if (!duplicate && candidate.get_streams() > 0) {
+            configs.push_back(std::move(candidate));
+        }
+    }
+
+    std::sort(configs.begin(), configs.end(), [](const IStreamsExecutor::Config& a, const IStreamsExecutor::Config& b) {
+        return a.get_streams() < b.get_streams();
+    });
+    return configs;
+}
+
 void get_num_streams(const int streams, const std::shared_ptr<ov::Model>& model, Config& config) {
     {
         std::lock_guard<std::mutex> lock{_streams_executor_mutex};
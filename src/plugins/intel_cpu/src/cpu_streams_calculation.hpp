@@ -107,6 +107,17 @@ std::vector<std::vector<int>> generate_stream_info(int streams,
                                                    std::vector<std::vector<int>>& proc_type_table,
                                                    int preferred_nthreads_per_stream = -1);
 
+/**
+ * @brief      Generate the streams configurations the adaptive streams controller can switch between at runtime
+ * @param[in]  config intel cpu configuration with the streams executor configuration selected at compile time
+ * @param[in]  proc_type_table candidate processors generated for the compile time configuration
+ * @return     configurations with the power of two numbers of streams and the compile time one, sorted by the number of
+ * streams. All the configurations use the same processors
+ */
+std::vector<ov::threading::IStreamsExecutor::Config> get_adaptive_streams_configs(
+    const Config& config,
+    const std::vector<std::vector<int>>& proc_type_table);
+
 /**
  * @brief      Get information about number of streams, threads and pinning threads on different processors
  * @param[in]  streams number of streams
@@ -223,6 +223,13 @@ size_t DnnlExtensionUtils::getMemSizeForDnnlDesc(const dnnl::memory::desc& desc)
     return size;
 }
 
+size_t DnnlExtensionUtils::getPrimitiveMemoryConsumption(const dnnl::primitive_desc& desc) {
+    if (!desc) {
+        return 0;
+    }
+    return static_cast<size_t>(std::max<dnnl::memory::dim>(desc.query_s64(dnnl::query::memory_consumption_s64), 0));
+}
+
 std::shared_ptr<DnnlBlockedMemoryDesc> DnnlExtensionUtils::makeUndefinedDesc(const memory::desc& desc,
                                                                              const Shape& shape) {
     if (desc.get_format_kind() == memory::format_kind::blocked) {
@@ -71,6 +71,11 @@ public:
 
     static std::shared_ptr<DnnlBlockedMemoryDesc> makeUndefinedDesc(const dnnl::memory::desc& desc, const Shape& shape);
     static size_t getMemSizeForDnnlDesc(const dnnl::memory::desc& desc);
+    /**
+     * @brief Returns the amount of memory consumed by the primitive created from the primitive descriptor (including the
+     * JIT generated code), zero if the descriptor is empty
+     */
+    static size_t getPrimitiveMemoryConsumption(const dnnl::primitive_desc& desc);
 
     static std::shared_ptr<DnnlMemoryDesc> query_md(const const_dnnl_primitive_desc_t& pd,
                                                     const dnnl::query& what,
@@ -6,6 +6,7 @@
 
 #include <cstddef>
 #include <memory>
+#include <mutex>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
 
@@ -19,15 +20,36 @@ class DnnlScratchPad {
     MemoryBlockPtr blockPtr;
     MemoryBlockWithReuse* baseBlockPtr = nullptr;
     dnnl::engine eng;
+    int numaNode;
+    bool growByNewBlock;
+    std::mutex mutex;
 
-public:
-    explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1) : eng(std::move(eng)) {
-        auto baseMemoryBlock = std::make_unique<MemoryBlockWithReuse>(numa_node);
+    void createBlock() {
+        auto baseMemoryBlock = std::make_unique<MemoryBlockWithReuse>(numaNode);
         baseBlockPtr = baseMemoryBlock.get();
         blockPtr = std::make_shared<DnnlMemoryBlock>(std::move(baseMemoryBlock));
     }
 
+public:
+    /**
+     * @param growByNewBlock if the requested memory doesn't fit the current block, a new block is allocated instead of
+     * reallocating the current one, so the memory created before stays valid while it is used by another thread
+     */
+    explicit DnnlScratchPad(dnnl::engine eng, int numa_node = -1, bool growByNewBlock = false)
+        : eng(std::move(eng)),
+          numaNode(numa_node),
+          growByNewBlock(growByNewBlock) {
+        createBlock();
+    }
+
     MemoryPtr createScratchPadMem(const MemoryDescPtr& md) {
+        if (!growByNewBlock) {
+            return std::make_shared<Memory>(eng, md, blockPtr);
+        }
+        std::lock_guard<std::mutex> lock(mutex);
+        if (size() > 0 && md->getCurrentMemSize() > size()) {
+            createBlock();
+        }
         return std::make_shared<Memory>(eng, md, blockPtr);
     }
 
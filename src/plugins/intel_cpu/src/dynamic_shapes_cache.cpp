@@ -0,0 +1,46 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dynamic_shapes_cache.h"
+
+#include <common/utils.hpp>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "common/primitive_hashing_utils.hpp"
+#include "cpu_types.h"
+
+namespace ov::intel_cpu {
+
+size_t DynamicShapesCache::Key::hash() const {
+    using namespace dnnl::impl;
+    using namespace dnnl::impl::primitive_hashing;
+
+    size_t seed = 0;
+    for (const auto& shape : inputShapes) {
+        seed = get_vector_hash(seed, shape);
+    }
+    return seed;
+}
+
+DynamicShapesCache::DynamicShapesCache(size_t capacity, std::vector<bool> cacheable)
+    : m_cacheable(std::make_shared<const std::vector<bool>>(std::move(cacheable))),
+      m_records(capacity) {}
+
+DynamicShapesCache::RecordPtr DynamicShapesCache::lookUp(const std::vector<VectorDims>& inputShapes) {
+    Key key{inputShapes};
+    if (auto record = m_records.get(key)) {
+        m_hits.fetch_add(1, std::memory_order_relaxed);
+        return record;
+    }
+
+    m_misses.fetch_add(1, std::memory_order_relaxed);
+    auto record = std::make_shared<Record>(m_cacheable);
+    m_records.put(key, record);
+    return record;
+}
+
+}  // namespace ov::intel_cpu
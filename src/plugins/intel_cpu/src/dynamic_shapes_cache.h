@@ -0,0 +1,88 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "cache/lru_cache.h"
+#include "cpu_types.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Memoizes the output shapes of the graph nodes per tuple of the graph input shapes,
+ * so the shape inference of the nodes can be skipped when the input shapes repeat.
+ *
+ * Only the nodes which output shapes are fully defined by the graph input shapes are cached (see
+ * Graph::IdentifyShapesCacheableNodes).
+ *
+ * @attention Lookups are not thread safe, the hit / miss counters can be read concurrently.
+ */
+class DynamicShapesCache {
+public:
+    using Ptr = std::shared_ptr<DynamicShapesCache>;
+
+    class Record {
+    public:
+        explicit Record(std::shared_ptr<const std::vector<bool>> cacheable)
+            : m_cacheable(std::move(cacheable)),
+              m_outputShapes(m_cacheable->size()) {}
+
+        /**
+         * @brief Returns the memoized output shapes of the node with index \p nodeIdx
+         * @return nullptr if the node is not cacheable, empty vector if the shapes are not known yet
+         */
+        std::vector<VectorDims>* outputShapes(size_t nodeIdx) {
+            return (*m_cacheable)[nodeIdx] ? &m_outputShapes[nodeIdx] : nullptr;
+        }
+
+    private:
+        std::shared_ptr<const std::vector<bool>> m_cacheable;
+        std::vector<std::vector<VectorDims>> m_outputShapes;
+    };
+
+    using RecordPtr = std::shared_ptr<Record>;
+
+    /**
+     * @param capacity maximum number of the input shapes tuples to be stored
+     * @param cacheable mask of the cacheable nodes
+     */
+    DynamicShapesCache(size_t capacity, std::vector<bool> cacheable);
+
+    /**
+     * @brief Searches the record associated with the graph \p inputShapes or creates an empty one
+     */
+    RecordPtr lookUp(const std::vector<VectorDims>& inputShapes);
+
+    [[nodiscard]] uint64_t hits() const {
+        return m_hits.load(std::memory_order_relaxed);
+    }
+
+    [[nodiscard]] uint64_t misses() const {
+        return m_misses.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct Key {
+        std::vector<VectorDims> inputShapes;
+
+        [[nodiscard]] size_t hash() const;
+        bool operator==(const Key& rhs) const {
+            return inputShapes == rhs.inputShapes;
+        }
+    };
+
+    std::shared_ptr<const std::vector<bool>> m_cacheable;
+    LruCache<Key, RecordPtr> m_records;
+    std::atomic<uint64_t> m_hits{0};
+    std::atomic<uint64_t> m_misses{0};
+};
+
+}  // namespace ov::intel_cpu
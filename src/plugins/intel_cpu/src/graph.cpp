@@ -9,8 +9,10 @@
 #include <oneapi/dnnl/dnnl_types.h>
 
 #include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <chrono>
+#include <condition_variable>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
@@ -21,11 +23,13 @@
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <set>
 #include <string>
+#include <thread>
 #include <tuple>
 #include <unordered_map>
 #include <unordered_set>
@@ -35,6 +39,7 @@
 #include "allocation_context.hpp"
 #include "cpu_memory.h"
 #include "cpu_types.h"
+#include "dynamic_shapes_cache.h"
 #include "edge.h"
 #include "graph_context.h"
 #include "graph_dumper.h"
@@ -69,6 +74,7 @@
 #include "openvino/runtime/so_ptr.hpp"
 #include "perf_count.h"
 #include "proxy_mem_blk.h"
+#include "shape_inference/shape_inference_cpu.hpp"
 #include "thread_pool_imp.hpp"
 #include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
@@ -79,13 +85,10 @@
 #    include "openvino/core/partial_shape.hpp"
 #endif
 
-#if (OV_THREAD == OV_THREAD_TBB || OV_THREAD == OV_THREAD_TBB_AUTO || OV_THREAD == OV_THREAD_TBB_ADAPTIVE || \
-     OV_THREAD == OV_THREAD_OMP)
-#    include <atomic>
-#endif
-
 #if OV_THREAD_USE_TBB
 #    include <tbb/task.h>
+#    include <tbb/task_arena.h>
+#    include <tbb/task_group.h>
 #endif
 
 #if defined(OPENVINO_ARCH_X86_64) && defined(__linux__)
@@ -392,20 +395,24 @@ void Graph::Init(const std::shared_ptr<const ov::Model>& model,
     Configure();
 }
 
-void Graph::Activate() {
+void Graph::Activate(bool deferConstants) {
     // @todo It is possible that execution graph is already created in scope of
     // the allocation context collection from the outer graph so the state for inner graph is "Ready"
     // We probably want to avoid such uncertainty
     // OPENVINO_ASSERT(status == Status::Initialized, "Invalid graph status: ", static_cast<int>(status));
     Allocate();
 
-    CreatePrimitivesAndExecConstants();
+    if (deferConstants) {
+        PrefetchConstants();
+    } else {
+        CreatePrimitivesAndExecConstants();
 
 #ifndef CPU_DEBUG_CAPS
-    for (auto& graphNode : graphNodes) {
-        graphNode->cleanup();
-    }
+        for (auto& graphNode : graphNodes) {
+            graphNode->cleanup();
+        }
 #endif
+    }
 
     CPU_DEBUG_CAP_ENABLE(serialize(*this));
 }
@@ -534,57 +541,158 @@ void Graph::InitOptimalPrimitiveDescriptors() {
     }
 }
 
-void Graph::CreatePrimitivesAndExecConstants() const {
-    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
-    using shared_memory_ptr = WeightsSharing::SharedMemory::Ptr;
-
-    auto acquireSharedOutputs = [this](const NodePtr& node) {
-        std::vector<shared_memory_ptr> outputs;
-        bool hasLocalAllocatedEdges = false;
-        bool hasExternalInvalidEdges = false;
-
-        for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
-            auto edgePtr = node->getChildEdgeAt(i);
-            if (edgePtr) {
-                if (edgePtr->isUseExternalMemory()) {
-                    auto ptr = m_context->getWeightsCache()->get(edgePtr->hash());
-                    outputs.emplace_back(ptr);
-                    if (!ptr->isValid()) {
-                        hasExternalInvalidEdges = true;
-                    }
-                } else {
-                    hasLocalAllocatedEdges = true;
+void Graph::CreatePrimitiveAndExecConstant(const NodePtr& node, const dnnl::stream& strm) const {
+    // the scratch pad memory requested by the node primitives belongs to the lane of the node
+    GraphContext::ScratchPadLaneScope laneScope(node->getExecIndex(), node->isConstant());
+    {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
+        DEBUG_LOG(*node);
+        node->createPrimitive();
+    }
+
+    if (!node->isConstant() || !node->isExecutable()) {
+        return;
+    }
+
+    if (!m_context->getWeightsCache()) {
+        ExecuteNodeWithCatch(node, strm, nullptr, -1);
+        return;
+    }
+
+    std::vector<WeightsSharing::SharedMemory::Ptr> sharedOutputs;
+    bool hasLocalAllocatedEdges = false;
+    bool hasExternalInvalidEdges = false;
+
+    for (size_t i = 0; i < node->getChildEdges().size(); ++i) {
+        auto edgePtr = node->getChildEdgeAt(i);
+        if (edgePtr) {
+            if (edgePtr->isUseExternalMemory()) {
+                auto ptr = m_context->getWeightsCache()->get(edgePtr->hash());
+                sharedOutputs.emplace_back(ptr);
+                if (!ptr->isValid()) {
+                    hasExternalInvalidEdges = true;
                 }
+            } else {
+                hasLocalAllocatedEdges = true;
             }
         }
+    }
 
-        return std::make_tuple(hasExternalInvalidEdges, hasLocalAllocatedEdges, outputs);
-    };
+    if (hasExternalInvalidEdges || hasLocalAllocatedEdges) {
+        ExecuteNodeWithCatch(node, strm, nullptr, -1);
+
+        for (auto& output : sharedOutputs) {
+            output->valid(true);
+        }
+    }
+}
+
+void Graph::CreatePrimitivesAndExecConstants() const {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::CreatePrimitivesAndExecConstants");
 
     for (const auto& node : graphNodes) {
+        CreatePrimitiveAndExecConstant(node, m_stream);
+    }
+}
+
+struct Graph::ConstantsPrefetch {
+    ~ConstantsPrefetch() {
+        canceled = true;
+        if (worker.joinable()) {
+            worker.join();
+        }
+    }
+
+    // blocks until the first \p count graph nodes are ready
+    void wait(size_t count) {
+        if (ready.load(std::memory_order_acquire) >= count) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&] {
+            return ready.load(std::memory_order_relaxed) >= count || exception;
+        });
+        if (exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+
+    void setReady(size_t count) {
         {
-            OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, node->profiling.createPrimitive);
-            DEBUG_LOG(*node);
-            node->createPrimitive();
+            std::lock_guard<std::mutex> lock(mutex);
+            ready.store(count, std::memory_order_release);
         }
+        cv.notify_all();
+    }
 
-        if (!node->isConstant() || !node->isExecutable()) {
-            continue;
+    void setException(std::exception_ptr exp) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            exception = std::move(exp);
         }
+        cv.notify_all();
+    }
 
-        if (m_context->getWeightsCache()) {
-            auto sharedOutputs = acquireSharedOutputs(node);
+    std::mutex mutex;
+    std::condition_variable cv;
+    // number of the graph nodes (in execution order) which primitives are created and constants are executed
+    std::atomic<size_t> ready{0};
+    std::exception_ptr exception;
+    std::atomic<bool> canceled{false};
+    // number of the graph nodes to be ready before the corresponding executable node can be executed
+    std::vector<size_t> readyCounts;
+    std::thread worker;
+};
 
-            if (std::get<0>(sharedOutputs) || std::get<1>(sharedOutputs)) {
-                ExecuteNodeWithCatch(node);
+void Graph::PrefetchConstants() {
+    OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::PrefetchConstants");
+    auto prefetch = std::make_shared<ConstantsPrefetch>();
 
-                for (auto& output : std::get<2>(sharedOutputs)) {
-                    output->valid(true);
-                }
+    // the graph nodes are sorted topologically, so once a node is ready, all its (constant) parents are ready too
+    prefetch->readyCounts.reserve(m_executableGraphNodes.size());
+    for (size_t i = 0, j = 0; i < graphNodes.size() && j < m_executableGraphNodes.size(); i++) {
+        if (graphNodes[i] == m_executableGraphNodes[j]) {
+            prefetch->readyCounts.push_back(i + 1);
+            j++;
+        }
+    }
+
+#if OV_THREAD_USE_TBB
+    // the task is executed within the arena of the stream creating the graph to keep it on the stream cores
+    auto arena = std::make_shared<tbb::task_arena>(tbb::task_arena::attach());
+#endif
+    auto task = [this, prefetch = prefetch.get()] {
+        try {
+            m_context->getCpuParallel()->activate();
+            const auto strm = make_stream(getEngine(), m_context->getCpuParallel()->get_thread_pool());
+            for (size_t i = 0; i < graphNodes.size() && !prefetch->canceled; i++) {
+                CreatePrimitiveAndExecConstant(graphNodes[i], strm);
+#ifndef CPU_DEBUG_CAPS
+                // release the source constants as soon as the node is ready instead of waiting for the whole graph
+                graphNodes[i]->cleanup();
+#endif
+                prefetch->setReady(i + 1);
             }
-        } else {
-            ExecuteNodeWithCatch(node);
+        } catch (...) {
+            prefetch->setException(std::current_exception());
         }
+    };
+
+#if OV_THREAD_USE_TBB
+    prefetch->worker = std::thread([arena, task] {
+        arena->execute(task);
+    });
+#else
+    prefetch->worker = std::thread(task);
+#endif
+
+    m_constantsPrefetch = std::move(prefetch);
+}
+
+void Graph::WaitForConstants() {
+    if (m_constantsPrefetch) {
+        m_constantsPrefetch->wait(graphNodes.size());
+        m_constantsPrefetch.reset();
     }
 }
 
@@ -897,6 +1005,35 @@ static void AllocatedReferencingEdges(const EdgeClusters& clusters) {
     }
 }
 
+/**
+ * Execution plan of a static graph split into branches.
+ * A branch is a chain of executable nodes, which are executed sequentially,
+ * while independent branches can be executed concurrently.
+ */
+struct Graph::InterOpSchedule {
+    struct Branch {
+        std::vector<size_t> nodes;       // indices of the executable nodes in execution order
+        std::vector<size_t> successors;  // branches which can be started only after the current one is done
+        size_t numPredecessors = 0;
+        PerfCount perfCounter;
+    };
+
+    struct MemoryAccess {
+        uintptr_t begin;
+        uintptr_t end;
+        size_t nodeIdx;
+        bool write;
+    };
+
+    std::vector<Branch> branches;
+    std::vector<size_t> roots;
+    // data pointers the schedule was built for, the schedule is rebuilt when the memory is relocated
+    std::vector<void*> memorySignature;
+    std::vector<MemoryAccess> accesses;
+    // dnnl streams per arena slot
+    std::vector<dnnl::stream> streams;
+};
+
 std::vector<size_t> Graph::CreateExecutionGraph() {
     const bool hasDynNodes = ProcessDynNodes();
     auto syncNodesInds = hasDynNodes ? IdentifySyncPoints(graphNodes) : std::vector<size_t>{};
@@ -915,13 +1052,89 @@ std::vector<size_t> Graph::CreateExecutionGraph() {
         if (exec2sync < 10 || parallel_get_max_threads() < 2) {
             status = Status::ReadyDynamicSeq;
         }
+
+        // the number of distinct input shapes tuples is expected to be small (i.e. sequence length buckets)
+        constexpr size_t shapesCacheCapacity = 64;
+        if (getConfig().rtCacheCapacity > 0) {
+            auto cacheable = IdentifyShapesCacheableNodes();
+            if (std::any_of(cacheable.begin(), cacheable.end(), [](bool value) {
+                    return value;
+                })) {
+                m_shapesCache = std::make_shared<DynamicShapesCache>(shapesCacheCapacity, std::move(cacheable));
+            }
+        }
     } else {
         status = Status::ReadyStatic;
+#if OV_THREAD_USE_TBB
+        if (getConfig().enableInterOpParallelism && parallel_get_max_threads() > 1) {
+            m_interOpSchedule = std::make_shared<InterOpSchedule>();
+        }
+#endif
     }
 
     return syncNodesInds;
 }
 
+/**
+ * Identifies the executable nodes which output shapes are fully defined by the graph input shapes,
+ * so they can be memoized per graph input shapes. Only the nodes which opt in via canReuseInferredShapes() are
+ * memoized, since skipping shapeInfer() also skips its side effects.
+ * Output shapes of a node are defined by the graph input shapes if the shapes of all its inputs are,
+ * and the input data the shape inference depends on is a function of shapes only (i.e. ShapeOf subgraphs).
+ */
+std::vector<bool> Graph::IdentifyShapesCacheableNodes() const {
+    // output data of the node depends on the graph input shapes only
+    std::unordered_map<const Node*, bool> shapeOnlyData;
+    // output shapes of the node depend on the graph input shapes only
+    std::unordered_map<const Node*, bool> shapeOnlyShapes;
+
+    auto parentsOf = [](const NodePtr& node) {
+        std::vector<std::pair<size_t, const Node*>> parents;
+        for (size_t i = 0; i < node->getParentEdges().size(); i++) {
+            const auto edge = node->getParentEdgeAt(i);
+            parents.emplace_back(static_cast<size_t>(edge->getOutputNum()), edge->getParent().get());
+        }
+        return parents;
+    };
+
+    for (const auto& node : graphNodes) {
+        const auto parents = parentsOf(node);
+        const auto type = node->getType();
+
+        bool dataIsShapeOnly = false;
+        if (node->isConstant() || type == Type::ShapeOf) {
+            dataIsShapeOnly = true;
+        } else if (none_of(type, Type::Input, Type::MemoryInput, Type::RandomUniform, Type::Multinomial)) {
+            dataIsShapeOnly = std::all_of(parents.begin(), parents.end(), [&](const auto& parent) {
+                return shapeOnlyData[parent.second];
+            });
+        }
+        shapeOnlyData[node.get()] = dataIsShapeOnly;
+
+        bool shapesAreShapeOnly = false;
+        if (node->isConstant() || type == Type::Input) {
+            shapesAreShapeOnly = true;
+        } else if (node->shapeInference &&
+                   node->shapeInference->get_port_mask() != FULL_PORT_MASK &&  // internal dynamism
+                   none_of(type, Type::MemoryInput, Type::If, Type::TensorIterator, Type::SubModel)) {
+            const auto portMask = node->shapeInference->get_port_mask();
+            shapesAreShapeOnly = std::all_of(parents.begin(), parents.end(), [&](const auto& parent) {
+                const auto [port, parentNode] = parent;
+                const bool dataDependency = port >= 32 || (portMask & (1U << port)) != 0U;
+                return shapeOnlyShapes[parentNode] && (!dataDependency || shapeOnlyData[parentNode]);
+            });
+        }
+        shapeOnlyShapes[node.get()] = shapesAreShapeOnly;
+    }
+
+    std::vector<bool> cacheable(m_executableGraphNodes.size(), false);
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        const auto& node = m_executableGraphNodes[i];
+        cacheable[i] = node->isDynamicNode() && node->canReuseInferredShapes() && shapeOnlyShapes[node.get()];
+    }
+    return cacheable;
+}
+
 static void ResolveInOutInPlaceEdges(const std::vector<EdgePtr>& edges) {
     for (const auto& edge : edges) {
         if (edge->getStatus() == Edge::Status::Uninitialized) {
@@ -954,6 +1167,9 @@ int Graph::RegisterToAllocationContext(int offset, AllocationContext& context) {
         // an offset is the number of nodes in the internal graph minus the current node (-1)
         offset = node->registerToAllocationContext(inputExecIndex, context);
         const auto outputExecIndex = offset;
+        if (outputExecIndex != inputExecIndex) {
+            m_nodesWithInnerGraphs.insert(node);
+        }
         offset++;
         context.execIndex[node] = {inputExecIndex, outputExecIndex};
     }
@@ -1362,23 +1578,294 @@ VecMemoryDescs Graph::getOutputMemoryDescriptors() const {
 }
 
 void Graph::InferStatic(SyncInferRequest* request, int numaId) {
+    if (m_constantsPrefetch) {
+        // the constants are still being prepared, so every node is executed as soon as it is ready
+        for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+            m_constantsPrefetch->wait(m_constantsPrefetch->readyCounts[i]);
+            ExecuteNodeWithCatch(m_executableGraphNodes[i], request, numaId);
+        }
+        return;
+    }
+
     for (const auto& node : m_executableGraphNodes) {
         ExecuteNodeWithCatch(node, request, numaId);
     }
 }
 
+#if OV_THREAD_USE_TBB
 namespace {
 
+using InterOpDependencies = std::vector<std::vector<size_t>>;
+
+// Nodes with an internal state or with inner graphs access memory, which is not visible through the graph edges,
+// so they are executed exclusively
+bool isInterOpBarrier(const NodePtr& node, const std::unordered_set<NodePtr>& nodesWithInnerGraphs) {
+    return nodesWithInnerGraphs.count(node) != 0 || any_of(node->getType(),
+                                                           Type::MemoryInput,
+                                                           Type::MemoryOutput,
+                                                           Type::If,
+                                                           Type::TensorIterator,
+                                                           Type::SubModel,
+                                                           Type::LoRA,
+                                                           Type::ScaledDotProductAttention,
+                                                           Type::PagedAttention,
+                                                           Type::PaKVReorder,
+                                                           Type::GatedDeltaNet,
+                                                           Type::PagedGatedDeltaNet,
+                                                           Type::PagedCausalConv1D);
+}
+
+void addDataDependencies(const std::vector<NodePtr>& executableNodes, InterOpDependencies& predecessors) {
+    std::unordered_map<const Node*, size_t> executableIdx;
+    for (size_t i = 0; i < executableNodes.size(); i++) {
+        executableIdx[executableNodes[i].get()] = i;
+    }
+
+    for (size_t i = 0; i < executableNodes.size(); i++) {
+        // walk through the non executable parents (i.e. inplace Reshape) up to the executable ones
+        std::vector<NodePtr> toVisit{executableNodes[i]};
+        std::unordered_set<const Node*> visited;
+        while (!toVisit.empty()) {
+            auto node = toVisit.back();
+            toVisit.pop_back();
+            for (size_t j = 0; j < node->getParentEdges().size(); j++) {
+                const auto parent = node->getParentEdgeAt(j)->getParent();
+                if (parent->isConstant() || !visited.insert(parent.get()).second) {
+                    continue;
+                }
+                if (auto it = executableIdx.find(parent.get()); it != executableIdx.end()) {
+                    predecessors[i].push_back(it->second);
+                } else {
+                    toVisit.push_back(parent);
+                }
+            }
+        }
+    }
+}
+
+void addBarrierDependencies(const std::vector<NodePtr>& executableNodes,
+                            const std::unordered_set<NodePtr>& nodesWithInnerGraphs,
+                            InterOpDependencies& predecessors) {
+    constexpr auto noBarrier = std::numeric_limits<size_t>::max();
+    size_t lastBarrier = noBarrier;
+    for (size_t i = 0; i < executableNodes.size(); i++) {
+        if (isInterOpBarrier(executableNodes[i], nodesWithInnerGraphs)) {
+            for (size_t j = lastBarrier == noBarrier ? 0 : lastBarrier; j < i; j++) {
+                predecessors[i].push_back(j);
+            }
+            lastBarrier = i;
+        } else if (lastBarrier != noBarrier) {
+            predecessors[i].push_back(lastBarrier);
+        }
+    }
+}
+
+// The nodes of the same lane share the scratch pad memory, so they keep the sequential order
+void addScratchPadDependencies(const std::vector<NodePtr>& executableNodes,
+                               const GraphContext& context,
+                               InterOpDependencies& predecessors) {
+    if (context.getNumScratchPadLanes() == 0) {
+        return;
+    }
+    constexpr auto noNode = std::numeric_limits<size_t>::max();
+    std::vector<size_t> lastInLane(context.getNumScratchPadLanes(), noNode);
+    for (size_t i = 0; i < executableNodes.size(); i++) {
+        auto& last = lastInLane[context.getScratchPadLane(executableNodes[i]->getExecIndex())];
+        if (last != noNode) {
+            predecessors[i].push_back(last);
+        }
+        last = i;
+    }
+}
+
+// Two nodes which access overlapping memory and at least one of them writes it must keep the sequential order.
+// This covers the memory reuse plan, inplace memory and data dependencies via non executable nodes.
+template <typename MemoryAccess>
+void addMemoryDependencies(std::vector<MemoryAccess> accesses, InterOpDependencies& predecessors) {
+    std::sort(accesses.begin(), accesses.end(), [](const MemoryAccess& lhs, const MemoryAccess& rhs) {
+        return lhs.begin < rhs.begin;
+    });
+
+    for (size_t i = 0; i < accesses.size(); i++) {
+        const auto& lhs = accesses[i];
+        for (size_t j = i + 1; j < accesses.size() && accesses[j].begin < lhs.end; j++) {
+            const auto& rhs = accesses[j];
+            if (lhs.nodeIdx == rhs.nodeIdx || (!lhs.write && !rhs.write)) {
+                continue;
+            }
+            const auto [first, second] = std::minmax(lhs.nodeIdx, rhs.nodeIdx);
+            predecessors[second].push_back(first);
+        }
+    }
+}
+
+}  // namespace
+#endif
+
+void Graph::InferInterOp(SyncInferRequest* request, int numaId) {
+#if OV_THREAD_USE_TBB
+    auto& schedule = *m_interOpSchedule;
+    using MemoryAccess = InterOpSchedule::MemoryAccess;
+
+    std::vector<void*> memorySignature;
+    memorySignature.reserve(schedule.memorySignature.size());
+    std::vector<MemoryAccess> accesses;
+    accesses.reserve(schedule.accesses.size());
+
+    for (size_t i = 0; i < m_executableGraphNodes.size(); i++) {
+        const auto& node = m_executableGraphNodes[i];
+        auto collect = [&](const EdgePtr& edge, bool write) {
+            if (none_of(edge->getStatus(), Edge::Status::Allocated, Edge::Status::Validated)) {
+                return;
+            }
+            const auto& memory = edge->getMemoryPtr();
+            auto* data = memory->getData();
+            memorySignature.push_back(data);
+            const auto size = memory->getSize();
+            if (data == nullptr || size == 0) {
+                return;
+            }
+            const auto begin = reinterpret_cast<uintptr_t>(data);
+            accesses.push_back({begin, begin + size, i, write});
+        };
+
+        for (size_t j = 0; j < node->getParentEdges().size(); j++) {
+            collect(node->getParentEdgeAt(j), false);
+        }
+        for (size_t j = 0; j < node->getChildEdges().size(); j++) {
+            collect(node->getChildEdgeAt(j), true);
+        }
+    }
+
+    // the memory may be relocated between the inferences (i.e. user tensors or released memory),
+    // so the branches are rebuilt only when the data pointers are changed
+    if (schedule.branches.empty() || memorySignature != schedule.memorySignature) {
+        OV_ITT_SCOPE(FIRST_INFERENCE, itt::domains::ov_intel_cpu_LT, "Graph::BuildInterOpSchedule");
+        const auto numNodes = m_executableGraphNodes.size();
+        InterOpDependencies predecessors(numNodes);
+        addDataDependencies(m_executableGraphNodes, predecessors);
+        addBarrierDependencies(m_executableGraphNodes, m_nodesWithInnerGraphs, predecessors);
+        addMemoryDependencies(accesses, predecessors);
+        addScratchPadDependencies(m_executableGraphNodes, *m_context, predecessors);
+
+        InterOpDependencies successors(numNodes);
+        for (size_t i = 0; i < numNodes; i++) {
+            auto& preds = predecessors[i];
+            std::sort(preds.begin(), preds.end());
+            preds.erase(std::unique(preds.begin(), preds.end()), preds.end());
+            for (auto pred : preds) {
+                successors[pred].push_back(i);
+            }
+        }
+
+        // a node continues the branch of its predecessor if they form a chain
+        std::vector<size_t> branchOf(numNodes);
+        std::vector<InterOpSchedule::Branch> branches;
+        for (size_t i = 0; i < numNodes; i++) {
+            const auto& preds = predecessors[i];
+            if (preds.size() == 1 && successors[preds[0]].size() == 1) {
+                branchOf[i] = branchOf[preds[0]];
+            } else {
+                branchOf[i] = branches.size();
+                branches.emplace_back();
+                for (auto pred : preds) {
+                    branches[branchOf[pred]].successors.push_back(branchOf[i]);
+                }
+            }
+            branches[branchOf[i]].nodes.push_back(i);
+        }
+
+        for (auto& branch : branches) {
+            // several predecessors of the same node may belong to the same branch
+            std::sort(branch.successors.begin(), branch.successors.end());
+            branch.successors.erase(std::unique(branch.successors.begin(), branch.successors.end()),
+                                    branch.successors.end());
+        }
+        for (const auto& branch : branches) {
+            for (auto successor : branch.successors) {
+                branches[successor].numPredecessors++;
+            }
+        }
+        std::vector<size_t> roots;
+        for (size_t i = 0; i < branches.size(); i++) {
+            if (branches[i].numPredecessors == 0) {
+                roots.push_back(i);
+            }
+        }
+
+        DEBUG_LOG("Graph: ", GetName(), " inter-op schedule: ", numNodes, " nodes, ", branches.size(), " branches");
+
+        schedule.branches = std::move(branches);
+        schedule.roots = std::move(roots);
+        schedule.memorySignature = std::move(memorySignature);
+        schedule.accesses = std::move(accesses);
+    }
+
+    if (schedule.streams.empty()) {
+        const auto numSlots = static_cast<size_t>(tbb::this_task_arena::max_concurrency());
+        for (size_t i = 0; i < numSlots; i++) {
+            schedule.streams.push_back(make_stream(getEngine(), m_context->getCpuParallel()->get_thread_pool()));
+        }
+    }
+
+    const auto& config = getConfig();
+    std::vector<std::atomic<size_t>> pending(schedule.branches.size());
+    for (size_t i = 0; i < schedule.branches.size(); i++) {
+        pending[i].store(schedule.branches[i].numPredecessors, std::memory_order_relaxed);
+    }
+
+    tbb::task_group group;
+    std::function<void(size_t)> runBranch = [&](size_t branchIdx) {
+        auto& branch = schedule.branches[branchIdx];
+        {
+            auto pc = config.collectPerfCounters ? std::make_unique<PerfHelper>(branch.perfCounter) : nullptr;
+            const auto slot = static_cast<size_t>(tbb::this_task_arena::current_thread_index());
+            const auto& strm = schedule.streams[slot < schedule.streams.size() ? slot : 0];
+            for (auto nodeIdx : branch.nodes) {
+                const auto& node = m_executableGraphNodes[nodeIdx];
+                GraphContext::ScratchPadLaneScope laneScope(node->getExecIndex());
+                ExecuteNodeWithCatch(node, strm, request, numaId);
+            }
+        }
+        for (auto successor : branch.successors) {
+            if (pending[successor].fetch_sub(1, std::memory_order_acq_rel) == 1) {
+                group.run([&runBranch, successor] {
+                    runBranch(successor);
+                });
+            }
+        }
+    };
+
+    for (auto root : schedule.roots) {
+        group.run([&runBranch, root] {
+            runBranch(root);
+        });
+    }
+    // rethrows the first exception thrown by a branch
+    group.wait();
+#else
+    InferStatic(request, numaId);
+#endif
+}
+
+namespace {
+
+std::vector<VectorDims>* cachedOutputShapes(DynamicShapesCache::Record* shapesRecord, size_t nodeIdx) {
+    return shapesRecord ? shapesRecord->outputShapes(nodeIdx) : nullptr;
+}
+
 class UpdateNodesSeq {
 public:
-    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesSeq(std::vector<NodePtr>& executableGraphNodes,
+                            DynamicShapesCache::Record* shapesRecord = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapesRecord(shapesRecord) {}
 
     void operator()(size_t stopIndx) {
         for (; prepareCounter < stopIndx; ++prepareCounter) {
             const auto& node = m_executableGraphNodes[prepareCounter];
             if (node->isDynamicNode()) {
-                node->updateShapes();
+                node->updateShapes(cachedOutputShapes(m_shapesRecord, prepareCounter));
                 node->updateDynamicParams();
             }
         }
@@ -1387,6 +1874,7 @@ public:
 private:
     size_t prepareCounter = 0;
     std::vector<NodePtr>& m_executableGraphNodes;
+    DynamicShapesCache::Record* m_shapesRecord;
 };
 
 #if (OV_THREAD == OV_THREAD_SEQ)
@@ -1398,14 +1886,16 @@ using UpdateNodes = UpdateNodesSeq;
 
 class UpdateNodesBase {
 public:
-    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes)
-        : m_executableGraphNodes(executableGraphNodes) {}
+    explicit UpdateNodesBase(std::vector<NodePtr>& executableGraphNodes,
+                             DynamicShapesCache::Record* shapesRecord = nullptr)
+        : m_executableGraphNodes(executableGraphNodes),
+          m_shapesRecord(shapesRecord) {}
     void updateShapes(size_t node_indx, size_t stop_indx) {
         try {
             for (size_t i = node_indx; i < stop_indx; i++) {
                 const auto& node = m_executableGraphNodes[i];
                 if (node->isDynamicNode()) {
-                    node->updateShapes();
+                    node->updateShapes(cachedOutputShapes(m_shapesRecord, i));
                 }
                 m_prepareCounter.store(i, std::memory_order_release);
             }
@@ -1438,6 +1928,7 @@ protected:
     std::atomic<size_t> m_prepareCounter{0};
     std::atomic<bool> m_completion{false};
     std::vector<NodePtr>& m_executableGraphNodes;
+    DynamicShapesCache::Record* m_shapesRecord;
 };
 
 // NOLINTBEGIN(misc-include-cleaner) tbb has multiple implicit includes, which are not supposed to be included directly
@@ -1610,18 +2101,32 @@ public:
     DEBUG_LOG(*(node));
 
 inline void Graph::ExecuteNode(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNode(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNode(const NodePtr& node,
+                               const dnnl::stream& strm,
+                               SyncInferRequest* request,
+                               int numaId) const {
     if (request) {
         request->throw_if_canceled();
     }
 
-    node->execute(m_stream, numaId);
+    node->execute(strm, numaId);
 }
 
 inline void Graph::ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request, int numaId) const {
+    ExecuteNodeWithCatch(node, m_stream, request, numaId);
+}
+
+inline void Graph::ExecuteNodeWithCatch(const NodePtr& node,
+                                        const dnnl::stream& strm,
+                                        SyncInferRequest* request,
+                                        int numaId) const {
     VERBOSE_PERF_DUMP_ITT_DEBUG_LOG(itt::domains::ov_op_cpu_exec, node, getConfig());
 
     try {
-        ExecuteNode(node, request, numaId);
+        ExecuteNode(node, strm, request, numaId);
     } catch (const ov::Cancelled&) {
         throw;
     } catch (const std::exception& exp) {
@@ -1660,15 +2165,36 @@ void Graph::Infer(SyncInferRequest* request) {
 
     m_context->allocateMemory();
 
+    if (m_constantsPrefetch && (status != Status::ReadyStatic || m_interOpSchedule)) {
+        // the nodes are updated or scheduled ahead of their execution, so all of them must be ready
+        WaitForConstants();
+    }
+
+    DynamicShapesCache::RecordPtr shapesRecord;
+    if (m_shapesCache) {
+        std::vector<VectorDims> inputShapes;
+        inputShapes.reserve(inputNodes.size());
+        for (const auto& inputNode : inputNodes) {
+            if (!inputNode->getChildEdges().empty()) {
+                inputShapes.push_back(inputNode->getDstMemoryAtPort(0)->getStaticDims());
+            }
+        }
+        shapesRecord = m_shapesCache->lookUp(inputShapes);
+    }
+
     switch (status) {
     case Status::ReadyDynamic:
-        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes));
+        InferDynamic(request, numaId, UpdateNodes(m_executableGraphNodes, shapesRecord.get()));
         break;
     case Status::ReadyDynamicSeq:
-        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes));
+        InferDynamic(request, numaId, UpdateNodesSeq(m_executableGraphNodes, shapesRecord.get()));
         break;
     case Status::ReadyStatic:
-        InferStatic(request, numaId);
+        if (m_interOpSchedule) {
+            InferInterOp(request, numaId);
+        } else {
+            InferStatic(request, numaId);
+        }
         break;
     default:
         OPENVINO_ASSERT(IsReady(),
@@ -1676,6 +2202,8 @@ void Graph::Infer(SyncInferRequest* request) {
                         static_cast<int>(status));
     }
 
+    WaitForConstants();
+
     if (infer_count != -1) {
         infer_count++;
     }
@@ -1765,6 +2293,7 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
             pc.exec_type = node->getPrimitiveDescriptorType();
             pc.node_type = node->typeStr;
             perfMap.emplace_back(pc);
+            node->appendStagePerfCounters(perfMap);
 
             for (const auto& fusedNode : node->fusedWith) {
                 getPerfMapFor(perfMap, fusedNode);
@@ -1777,6 +2306,29 @@ void Graph::GetPerfData(std::vector<ov::ProfilingInfo>& perfMap) const {
         }
         getPerfMapFor(perfMap, graphNode);
     }
+
+    if (!m_interOpSchedule) {
+        return;
+    }
+    // report the wall time of the branches executed concurrently, the cpu time is a sum of the branch nodes times
+    for (size_t i = 0; i < m_interOpSchedule->branches.size(); i++) {
+        const auto& branch = m_interOpSchedule->branches[i];
+        ov::ProfilingInfo pc;
+        pc.node_name = "inter_op_branch_" + std::to_string(i);
+        pc.node_type = "InterOpBranch";
+        pc.exec_type = "undef";
+        pc.real_time = std::chrono::microseconds(branch.perfCounter.avg());
+        pc.cpu_time = std::chrono::microseconds::zero();
+        for (auto nodeIdx : branch.nodes) {
+            pc.cpu_time += std::chrono::microseconds(m_executableGraphNodes[nodeIdx]->PerfCounter().avg());
+        }
+        pc.start_time = branch.perfCounter.count() > 0 ? std::chrono::duration_cast<std::chrono::microseconds>(
+                                                             branch.perfCounter.start().time_since_epoch())
+                                                       : std::chrono::microseconds::zero();
+        pc.status = branch.perfCounter.avg() > 0 ? ov::ProfilingInfo::Status::EXECUTED
+                                                 : ov::ProfilingInfo::Status::NOT_RUN;
+        perfMap.emplace_back(pc);
+    }
 }
 
 void Graph::CreateEdge(const NodePtr& parent, const NodePtr& child, int parentPort, int childPort) {
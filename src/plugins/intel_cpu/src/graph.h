@@ -15,6 +15,7 @@
 
 #include "allocation_context.hpp"
 #include "config.h"
+#include "dynamic_shapes_cache.h"
 #include "edge.h"
 #include "graph_context.h"
 #include "memory_desc/cpu_memory_desc.h"
@@ -260,8 +261,17 @@ public:
 
     /**
      * Activate execution graph
+     *
+     * @params deferConstants  Create the primitives and execute the constants in the background in the execution
+     *                         order instead of doing it in place. The first inference waits only for the nodes it is
+     *                         about to execute. The graph must not be moved while the constants are being prepared.
      */
-    void Activate();
+    void Activate(bool deferConstants = false);
+
+    /**
+     * Blocks until the primitives and the constants deferred by Activate() are ready
+     */
+    void WaitForConstants();
 
     /**
      * Register the graph in the global allocation context by transforming
@@ -286,10 +296,19 @@ public:
         return m_outputNodesMemBlocks;
     }
 
+    /**
+     * Returns the cache of the dynamic nodes output shapes or nullptr if the graph does not use it
+     */
+    const DynamicShapesCache::Ptr& getDynamicShapesCache() const {
+        return m_shapesCache;
+    }
+
     friend class GraphOptimizer;
 
 protected:
     void ForgetGraphData() {
+        // stop the background task first, since it accesses the nodes
+        m_constantsPrefetch.reset();
         status = Status::NotReady;
 
         inputNodes.clear();
@@ -297,6 +316,9 @@ protected:
         graphNodes.clear();
         graphEdges.clear();
         m_executableSyncNodesInds.clear();
+        m_nodesWithInnerGraphs.clear();
+        m_interOpSchedule.reset();
+        m_shapesCache.reset();
     }
     Status status{Status::NotReady};
 
@@ -327,7 +349,10 @@ protected:
     bool ProcessDynNodes() const;
     void AllocateWithReuse(const std::vector<size_t>& syncNodesInds, GlobalExecutionIndex globalExecIndex);
     void CreatePrimitivesAndExecConstants() const;
+    void CreatePrimitiveAndExecConstant(const NodePtr& node, const dnnl::stream& strm) const;
+    void PrefetchConstants();
     std::vector<size_t> CreateExecutionGraph();
+    std::vector<bool> IdentifyShapesCacheableNodes() const;
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -338,6 +363,10 @@ protected:
      * @params numaId   Numa Id to be used for an execution
      */
     void ExecuteNodeWithCatch(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNodeWithCatch(const NodePtr& node,
+                              const dnnl::stream& strm,
+                              SyncInferRequest* request,
+                              int numaId) const;
 
     /**
      * Execute a given \p node within \p request using \p numaId
@@ -347,8 +376,18 @@ protected:
      * @params numaId   Numa Id to be used for an execution
      */
     void ExecuteNode(const NodePtr& node, SyncInferRequest* request = nullptr, int numaId = -1) const;
+    void ExecuteNode(const NodePtr& node, const dnnl::stream& strm, SyncInferRequest* request, int numaId) const;
 
     void InferStatic(SyncInferRequest* request, int numaId);
+    /**
+     * Execute a static graph dispatching independent branches concurrently onto the current task arena.
+     * Branch dependencies are derived from the graph edges and from the memory regions the nodes
+     * read and write, so the memory reuse plan built for the sequential execution stays valid.
+     *
+     * @params request  Current inference request, which is checked for cancelation
+     * @params numaId   Numa Id to be used for an execution
+     */
+    void InferInterOp(SyncInferRequest* request, int numaId);
     template <typename UpdateStrategy>
     void InferDynamic(SyncInferRequest* request, int numaId, UpdateStrategy&& update);
 
@@ -372,8 +411,23 @@ private:
     std::vector<NodePtr> m_executableGraphNodes;
     std::vector<size_t> m_executableSyncNodesInds;
 
+    // nodes owning inner graphs, which memory is planned together with the current graph
+    std::unordered_set<NodePtr> m_nodesWithInnerGraphs;
+
+    struct InterOpSchedule;
+    // execution plan of the independent branches, is used only if inter-op parallelism is enabled
+    std::shared_ptr<InterOpSchedule> m_interOpSchedule;
+
+    // memoized output shapes of the dynamic nodes per graph input shapes
+    DynamicShapesCache::Ptr m_shapesCache;
+
     GraphContext::CPtr m_context;
     dnnl::stream m_stream;
+
+    struct ConstantsPrefetch;
+    // background preparation of the primitives and the constants, is reset once all of them are ready.
+    // Is declared last to stop the background task before the rest of the graph data is destroyed
+    std::shared_ptr<ConstantsPrefetch> m_constantsPrefetch;
 };
 
 using GraphPtr = std::shared_ptr<Graph>;
@@ -8,12 +8,16 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <utility>
 
+#include "activation_arena.hpp"
+#include "cache/cache_budget.h"
+#include "cache/jit_kernel_store.h"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
 #include "dnnl_scratch_pad.h"
 #include "memory_control.hpp"
 #include "nodes/memory.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "openvino/runtime/threading/cpu_streams_executor.hpp"
 #include "openvino/runtime/threading/istreams_executor.hpp"
@@ -22,24 +26,44 @@
 
 namespace ov::intel_cpu {
 
+static ActivationArena::Ptr makeActivationArena(const Config& config,
+                                                const ov::threading::IStreamsExecutor::Ptr& streamExecutor) {
+    if (!config.enableSharedActivationArena) {
+        return nullptr;
+    }
+    auto cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(streamExecutor);
+    auto arena = ActivationArena::get(cpuStreamExecutor ? cpuStreamExecutor->get_numa_node_id() : -1);
+    if (config.sharedActivationArenaSizeSetExplicitly) {
+        arena->requestCapacity(config.sharedActivationArenaSize);
+    }
+    return arena;
+}
+
 GraphContext::GraphContext(Config config,
                            WeightsSharing::Ptr w_cache,
                            bool isGraphQuantized,
                            ov::threading::IStreamsExecutor::Ptr streamExecutor,
                            std::shared_ptr<CpuParallel> cpuParallel,
-                           std::shared_ptr<SubMemoryManager> sub_memory_manager)
+                           std::shared_ptr<SubMemoryManager> sub_memory_manager,
+                           CacheMemoryBudget::Ptr rtCacheBudget)
     : m_config(std::move(config)),
       m_weightsCache(std::move(w_cache)),
-      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity)),
-      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity)),
+      m_rtCacheBudget(rtCacheBudget ? std::move(rtCacheBudget)
+                                    : std::make_shared<CacheMemoryBudget>(m_config.rtCacheByteBudget)),
+      m_rtParamsCache(std::make_shared<MultiCache>(m_config.rtCacheCapacity, m_rtCacheBudget)),
+      m_snippetsParamsCache(std::make_shared<MultiCache>(m_config.snippetsCacheCapacity, m_rtCacheBudget)),
       m_isGraphQuantizedFlag(isGraphQuantized),
       m_streamExecutor(std::move(streamExecutor)),
       m_cpuParallel(std::move(cpuParallel)),
       m_subMemoryManager(std::move(sub_memory_manager)),
 
       m_memoryStatesRegister(std::make_shared<node::MemoryStatesRegister>()),
-      m_auxiliaryNetworkMemoryControl(std::make_shared<NetworkMemoryControl>()),
-      m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main")) {
+      m_auxiliaryNetworkMemoryControl(
+          std::make_shared<NetworkMemoryControl>(makeActivationArena(m_config, m_streamExecutor))),
+      m_memoryControl(m_auxiliaryNetworkMemoryControl->createMemoryControlUnit("main", m_config.memorySolverType)) {
+    if (!m_config.jitKernelCacheDir.empty()) {
+        m_jitKernelStore = JitKernelStore::get(m_config.jitKernelCacheDir, m_config.jitKernelCacheSize);
+    }
     if (m_streamExecutor) {
         m_cpuStreamExecutor = std::dynamic_pointer_cast<ov::threading::CPUStreamsExecutor>(m_streamExecutor);
         m_numaNodeId = m_cpuStreamExecutor ? std::max(0, m_cpuStreamExecutor->get_numa_node_id()) : 0;
@@ -50,9 +74,17 @@ GraphContext::GraphContext(Config config,
     }
     // primitive/executors can be shared across sub-stream
     // but scratch pad cannot be shared.
+    // with lazy weights repacking the nodes are executed while the next ones are created
+    const bool growByNewBlock = m_config.enableLazyWeightsRepacking;
     int numaNum = std::max(m_numaNodeId + 1, m_numNumaNodes);
     for (int i = 0; i < numaNum; i++) {
-        m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i));
+        m_rtScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), i, growByNewBlock));
+    }
+    if (m_config.enableInterOpParallelism) {
+        const auto numLanes = std::max(1, parallel_get_max_threads());
+        for (int i = 0; i < numLanes; i++) {
+            m_laneScratchPads.push_back(std::make_shared<DnnlScratchPad>(getEngine(), m_numaNodeId, growByNewBlock));
+        }
     }
 
     if (!m_cpuParallel) {
@@ -60,6 +92,35 @@ GraphContext::GraphContext(Config config,
     }
 }
 
+namespace {
+// execution index of the node which is created or executed by the current thread
+thread_local int currentNodeExecIndex = -1;
+thread_local bool currentNodeIsConstant = false;
+}  // namespace
+
+GraphContext::ScratchPadLaneScope::ScratchPadLaneScope(int execIndex, bool isConstant)
+    : m_prevExecIndex(currentNodeExecIndex),
+      m_prevIsConstant(currentNodeIsConstant) {
+    currentNodeExecIndex = execIndex;
+    currentNodeIsConstant = isConstant;
+}
+
+GraphContext::ScratchPadLaneScope::~ScratchPadLaneScope() {
+    currentNodeExecIndex = m_prevExecIndex;
+    currentNodeIsConstant = m_prevIsConstant;
+}
+
+DnnlScratchPadPtr GraphContext::getScratchPad() const {
+    if (currentNodeIsConstant && m_config.enableLazyWeightsRepacking) {
+        return std::make_shared<DnnlScratchPad>(getEngine(), m_numaNodeId);
+    }
+    if (m_laneScratchPads.empty() || currentNodeExecIndex < 0) {
+        // the executors created out of scope of a node execution (e.g. by prepareParams of dynamic nodes) share the pad
+        return m_rtScratchPads[m_numaNodeId];
+    }
+    return m_laneScratchPads[getScratchPadLane(currentNodeExecIndex)];
+}
+
 const dnnl::engine& GraphContext::getEngine() {
     static const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
     return eng;
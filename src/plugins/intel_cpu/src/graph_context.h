@@ -8,6 +8,8 @@
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <vector>
 
+#include "cache/cache_budget.h"
+#include "cache/jit_kernel_store.h"
 #include "cache/multi_cache.h"
 #include "config.h"
 #include "cpu_parallel.hpp"
@@ -37,7 +39,8 @@ public:
                  bool isGraphQuantized,
                  ov::threading::IStreamsExecutor::Ptr streamExecutor = nullptr,
                  std::shared_ptr<CpuParallel> cpuParallel = nullptr,
-                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr);
+                 std::shared_ptr<SubMemoryManager> sub_memory_manager = nullptr,
+                 CacheMemoryBudget::Ptr rtCacheBudget = nullptr);
 
     [[nodiscard]] const Config& getConfig() const {
         return m_config;
@@ -55,10 +58,45 @@ public:
         return m_snippetsParamsCache;
     }
 
-    [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
-        return m_rtScratchPads[m_numaNodeId];
+    /**
+     * @brief Persistent store of the JIT kernels code, null if disabled
+     */
+    [[nodiscard]] const JitKernelStore::Ptr& getJitKernelStore() const {
+        return m_jitKernelStore;
     }
 
+    [[nodiscard]] DnnlScratchPadPtr getScratchPad() const;
+
+    /**
+     * @brief Number of the scratch pad lanes, 0 if all the nodes share the same scratch pad
+     * With inter-op parallelism the nodes get the scratch pad of their lane (by the execution index),
+     * so the nodes of the same lane must not be executed concurrently
+     */
+    [[nodiscard]] size_t getNumScratchPadLanes() const {
+        return m_laneScratchPads.size();
+    }
+
+    [[nodiscard]] size_t getScratchPadLane(int execIndex) const {
+        return static_cast<size_t>(execIndex) % m_laneScratchPads.size();
+    }
+
+    /**
+     * @brief Binds the scratch pad lane of the node to the current thread while the node is created or executed
+     * The constant nodes are executed once during the graph preparation, which with lazy weights repacking runs
+     * concurrently with the inference, so they get a private scratch pad in this case
+     */
+    class ScratchPadLaneScope {
+    public:
+        explicit ScratchPadLaneScope(int execIndex, bool isConstant = false);
+        ~ScratchPadLaneScope();
+        ScratchPadLaneScope(const ScratchPadLaneScope&) = delete;
+        ScratchPadLaneScope& operator=(const ScratchPadLaneScope&) = delete;
+
+    private:
+        int m_prevExecIndex;
+        bool m_prevIsConstant;
+    };
+
     [[nodiscard]] const std::vector<DnnlScratchPadPtr>& getScratchPads() const {
         return m_rtScratchPads;
     }
@@ -101,6 +139,10 @@ public:
         m_auxiliaryNetworkMemoryControl->releaseMemory();
     }
 
+    void releaseLeasedMemory() const {
+        m_auxiliaryNetworkMemoryControl->releaseLeasedMemory();
+    }
+
     void allocateMemory() const {
         for (const auto& controlUnit : m_auxiliaryNetworkMemoryControl->controlUnits()) {
             if (!controlUnit->allocated()) {
@@ -114,15 +156,20 @@ private:
     Config m_config;
     // per NUMA node caches for sharing weights data
     WeightsSharing::Ptr m_weightsCache;
+    // byte budget shared by the runtime caches of all the compiled models of the plugin
+    CacheMemoryBudget::Ptr m_rtCacheBudget;
     // primitive cache
     MultiCachePtr m_rtParamsCache;
     MultiCachePtr m_snippetsParamsCache;
+    JitKernelStore::Ptr m_jitKernelStore;
     // global scratch pad
     DnnlScratchPadPtr m_rtScratchPad;
 
     bool m_isGraphQuantizedFlag = false;
     // scratch pad per sub-stream
     std::vector<DnnlScratchPadPtr> m_rtScratchPads;
+    // scratch pads of the nodes which may be executed concurrently, one per worker
+    std::vector<DnnlScratchPadPtr> m_laneScratchPads;
     // stream executor for current graph
     ov::threading::IStreamsExecutor::Ptr m_streamExecutor;
     // cpu stream executor for current graph
@@ -22,7 +22,9 @@
 #include "cpu_types.h"
 #include "dnnl_extension_utils.h"
 #include "edge.h"
+#include "graph_context.h"
 #include "itt.h"
+#include "memory_state.h"
 #include "memory_desc/cpu_blocked_memory_desc.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "memory_desc/cpu_memory_desc_utils.h"
@@ -99,6 +101,22 @@ void SyncInferRequest::update_external_tensor_ptrs() {
     }
 }
 
+namespace {
+// returns the memory leased from the shared activation arena once the outputs are pulled, even on failure
+class LeasedMemoryGuard {
+public:
+    explicit LeasedMemoryGuard(GraphContext::CPtr context) : m_context(std::move(context)) {}
+    LeasedMemoryGuard(const LeasedMemoryGuard&) = delete;
+    LeasedMemoryGuard& operator=(const LeasedMemoryGuard&) = delete;
+    ~LeasedMemoryGuard() {
+        m_context->releaseLeasedMemory();
+    }
+
+private:
+    GraphContext::CPtr m_context;
+};
+}  // namespace
+
 void SyncInferRequest::infer() {
     OV_ITT_SCOPED_TASK_BASE(itt::domains::ov_cpu_inference, m_profiling_task);
     auto graphLock = m_compiled_model.lock();
@@ -133,6 +151,8 @@ void SyncInferRequest::infer() {
 
     push_input_data(graph);
 
+    LeasedMemoryGuard leasedMemoryGuard(graph.getGraphContext());
+
     graph.Infer(this);
 
     throw_if_canceled();
@@ -323,7 +343,22 @@ std::vector<ov::SoPtr<ov::IVariableState>> SyncInferRequest::query_state() const
         }
         return states;
     }
-    return {m_memory_states.begin(), m_memory_states.end()};
+    std::vector<ov::SoPtr<ov::IVariableState>> states{m_memory_states.begin(), m_memory_states.end()};
+    if (m_compiled_model.graph().getConfig().kvCacheRawStateAccess) {
+        using RawPart = VariableStateKVcache::RawPart;
+        for (const auto& state : m_memory_states) {
+            auto kv_state = std::dynamic_pointer_cast<VariableStateKVcache>(state);
+            if (!kv_state) {
+                continue;
+            }
+            states.emplace_back(std::make_shared<VariableStateKVcacheRawPart>(kv_state, RawPart::CACHE));
+            states.emplace_back(std::make_shared<VariableStateKVcacheRawPart>(kv_state, RawPart::BEAM_TABLE));
+            if (kv_state->has_raw_scale_zp()) {
+                states.emplace_back(std::make_shared<VariableStateKVcacheRawPart>(kv_state, RawPart::SCALE_ZP));
+            }
+        }
+    }
+    return states;
 }
 
 void SyncInferRequest::set_async_request(AsyncInferRequest* asyncRequest) {
@@ -6,8 +6,10 @@
 
 #include <cstdint>
 #include <istream>
+#include <map>
 #include <ostream>
 #include <string>
+#include <vector>
 
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/properties.hpp"
@@ -20,6 +22,35 @@ namespace ov::intel_cpu {
  */
 static constexpr Property<int32_t, PropertyMutability::RW> cpu_runtime_cache_capacity{"CPU_RUNTIME_CACHE_CAPACITY"};
 
+/**
+ * @brief Defines how many bytes can be occupied by the records of the CPU runtime caches of all the compiled models of
+ * the plugin. Once the budget is exceeded, the least recently used records of all the caches are evicted.
+ * The budget is a plugin level property, so it can be set by ov::Core::set_property only.
+ * @param 0 - unlimited (default)
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_runtime_cache_byte_budget{
+    "CPU_RUNTIME_CACHE_BYTE_BUDGET"};
+
+/**
+ * @brief Directory of the persistent store of the JIT generated kernels. The kernels are loaded from the store
+ * instead of being generated on the next process start. The loaded code is executed, so the directory must be owned
+ * by the current user and must not be accessible by the others, otherwise the store is disabled.
+ * @param "" - the store is disabled (default)
+ */
+static constexpr Property<std::string, PropertyMutability::RW> cpu_jit_kernel_cache_dir{"CPU_JIT_KERNEL_CACHE_DIR"};
+
+/**
+ * @brief Maximum size in bytes of the persistent JIT kernels store file, 128MB by default
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_jit_kernel_cache_size{"CPU_JIT_KERNEL_CACHE_SIZE"};
+
+/**
+ * @brief Read-only statistics of the CPU runtime caches of the compiled model.
+ * Contains "hits", "misses", "evictions" and "bytes" (cost of the stored records) counters summed over all the streams.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_runtime_cache_stats{
+    "CPU_RUNTIME_CACHE_STATS"};
+
 /**
  * @brief Enum to define possible snippets mode hints.
  */
@@ -80,4 +111,173 @@ static constexpr Property<bool, PropertyMutability::RW> enable_tensor_parallel{"
  */
 static constexpr Property<bool, PropertyMutability::RW> enable_sage_attn{"ENABLE_SAGE_ATTN"};
 
+/**
+ * @brief Define whether independent branches of a static graph can be executed concurrently
+ * @param true - dispatch ready nodes of the graph onto the stream task arena as soon as their dependencies are done
+ * @param false - execute nodes one by one in topological order (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> enable_inter_op_parallelism{"ENABLE_INTER_OP_PARALLELISM"};
+
+/**
+ * @brief Define whether the nodes report the performance counters of their internal execution stages, e.g.
+ * the PagedAttention nodes report the KV cache update and the attention as "<node>/<stage>" entries with the times of
+ * the last execution. Takes effect with ov::enable_profiling only.
+ * @param true - report the stages after the counter of the node
+ * @param false - report the nodes only (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_stage_perf_counters{"CPU_STAGE_PERF_COUNTERS"};
+
+/**
+ * @brief Enum to define the solver of the static memory regions reuse.
+ */
+enum class MemorySolverType : uint8_t {
+    DEFAULT = 0,         //!<  Greedy solver common for all the plugins (ov::MemorySolver)
+    INTERVAL_GRAPH = 1,  //!<  Interval graph solver with best-fit placement of the regions
+};
+
+/** @cond INTERNAL */
+inline std::ostream& operator<<(std::ostream& os, const MemorySolverType& type) {
+    switch (type) {
+    case MemorySolverType::DEFAULT:
+        return os << "DEFAULT";
+    case MemorySolverType::INTERVAL_GRAPH:
+        return os << "INTERVAL_GRAPH";
+    default:
+        OPENVINO_THROW("Unsupported memory solver type value");
+    }
+}
+
+inline std::istream& operator>>(std::istream& is, MemorySolverType& type) {
+    std::string str;
+    is >> str;
+    if (str == "DEFAULT") {
+        type = MemorySolverType::DEFAULT;
+    } else if (str == "INTERVAL_GRAPH") {
+        type = MemorySolverType::INTERVAL_GRAPH;
+    } else {
+        OPENVINO_THROW("Unsupported memory solver type: ", str);
+    }
+    return is;
+}
+/** @endcond */
+
+/**
+ * @brief Define the solver used to place the static intermediate tensors of the compiled model into a common memory
+ * blob.
+ * @param DEFAULT - greedy solver (default)
+ * @param INTERVAL_GRAPH - interval graph solver with best-fit, fragmentation aware placement
+ */
+static constexpr Property<MemorySolverType, PropertyMutability::RW> memory_solver{"CPU_MEMORY_SOLVER"};
+
+/**
+ * @brief Define whether the compiled model leases the memory of its intermediate tensors from the process wide arena
+ * shared by the compiled models running on the same NUMA node
+ * @param true - the memory is leased for the duration of an inference and returned to the arena afterwards
+ * @param false - the memory is owned by the compiled model (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_shared_activation_arena{"CPU_SHARED_ACTIVATION_ARENA"};
+
+/**
+ * @brief Maximum number of bytes pooled by the shared activation arena of a NUMA node, zero means unlimited (default).
+ * The arena is process wide, so the largest value set by the compiled models is applied. A lease which does not fit
+ * is allocated over the capacity rather than waiting for the other compiled models.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> cpu_shared_activation_arena_size{
+    "CPU_SHARED_ACTIVATION_ARENA_SIZE"};
+
+/**
+ * @brief Read-only statistics of the shared activation arena usage by the compiled model.
+ * Contains "leases" and "overcommits" counters summed over all the streams as well as
+ * "arena_allocated_bytes" and "arena_peak_leased_bytes" of the arenas used by the compiled model.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_shared_activation_arena_stats{
+    "CPU_SHARED_ACTIVATION_ARENA_STATS"};
+
+/**
+ * @brief Define whether the repacked weights are replicated per NUMA node
+ * @param true - every NUMA node keeps its own copy of the repacked weights bound to the node memory, the streams use
+ * the copy of the node they are running on
+ * @param false - the repacked weights are shared by all the streams running on the same socket (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_weights_numa_replication{"CPU_WEIGHTS_NUMA_REPLICATION"};
+
+/**
+ * @brief Read-only size in bytes of the repacked weights replicas of the compiled model per NUMA node,
+ * e.g. "numa_node_0". The replicas are shared by all the streams of the compiled model running on the node.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> cpu_weights_numa_stats{
+    "CPU_WEIGHTS_NUMA_STATS"};
+
+/**
+ * @brief Define whether the constant subgraphs (i.e. the weights repacking) are executed lazily
+ * @param true - compile_model returns as soon as the graphs are created, the primitives and the constants are prepared
+ * in the background in the execution order, the first inference waits only for the nodes it is about to execute
+ * @param false - the primitives and the constants are prepared in scope of compile_model (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_lazy_weights_repacking{"CPU_LAZY_WEIGHTS_REPACKING"};
+
+/**
+ * @brief Define whether the streams configuration of the compiled model is adapted to the load at runtime
+ * @param true - the queue depth, the latency and the utilization of the streams are sampled, the model switches to the
+ * configuration with more streams when the requests are queued on the saturated streams and to the configuration with
+ * fewer wider streams when the streams are mostly idle. The graphs are re-created for the new streams without
+ * recompiling the model
+ * @param false - the streams configuration is fixed at compile time (default)
+ */
+static constexpr Property<bool, PropertyMutability::RW> cpu_adaptive_streams{"CPU_ADAPTIVE_STREAMS"};
+
+/**
+ * @brief Read-only log of the streams configuration changes made by the adaptive streams controller, the latest last.
+ * Every record contains the old and the new "streams x threads per stream" configuration and the telemetry the
+ * decision was based on.
+ */
+static constexpr Property<std::vector<std::string>, PropertyMutability::RO> cpu_adaptive_streams_decisions{
+    "CPU_ADAPTIVE_STREAMS_DECISIONS"};
+
+/**
+ * @brief Per layer KV cache precisions overriding ov::key_cache_precision and ov::value_cache_precision, e.g.
+ * "*:u4;0-1:f16" keeps the caches of the first two attention layers in f16 and compresses the other ones to 4 bits.
+ * The rules are "<layers>:<precision>" or "<layers>:key=<precision>,value=<precision>" separated by ';', the later
+ * rules override the earlier ones. The layer is the index of the SDPA or PagedAttention operation in the topological
+ * order, the precisions are f32, f16, bf16, u8, u4 and tbq4/tbq3 for the TurboQuant caches. The precisions set in the
+ * "key_cache_precision"/"value_cache_precision" rt_info of an attention operation take priority over the policy.
+ * Empty string (default) means the same precisions for all the layers.
+ */
+static constexpr Property<std::string, PropertyMutability::RW> kv_cache_precision_policy{
+    "CPU_KV_CACHE_PRECISION_POLICY"};
+
+/**
+ * @brief The number of the most recent tokens kept in the KV cache states of the stateful SDPA, the older tokens
+ * (except the ov::intel_cpu::kv_cache_sink_size first ones) are evicted in place, so the memory of the endless
+ * generation is bounded. The evictions are batched: the cache holds up to a quarter of the window more tokens before
+ * it is compacted, every query still sees at least the window of the recent tokens.
+ * 0 (default) disables the eviction.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> kv_cache_window_size{"CPU_KV_CACHE_WINDOW_SIZE"};
+
+/**
+ * @brief The number of the first (sink) tokens which are never evicted from the KV cache states by the
+ * ov::intel_cpu::kv_cache_window_size eviction. It is rounded up to the quantization group size of the by-channel
+ * quantized caches. Default is 4.
+ */
+static constexpr Property<uint64_t, PropertyMutability::RW> kv_cache_sink_size{"CPU_KV_CACHE_SINK_SIZE"};
+
+/**
+ * @brief Exposes the KV cache states of the stateful SDPA in their internal representation. For every KV cache
+ * state "<name>", ov::InferRequest::query_state() additionally returns the states "<name>/raw/cache",
+ * "<name>/raw/beam_table" and, for the u8/u4 cache, "<name>/raw/scale_zp". Their get_state() returns the views over
+ * the internal buffers, which are never changed afterwards: the next inference moves the state to the new buffers.
+ * Their set_state() adopts the tensors in the same format without copying them, once all the parts of the state are
+ * set, the adopted tensors are only read.
+ * Default is false.
+ */
+static constexpr Property<bool, PropertyMutability::RW> kv_cache_raw_state_access{"CPU_KV_CACHE_RAW_STATE_ACCESS"};
+
+/**
+ * @brief Read-only statistics of the dynamic nodes output shapes cache of the compiled model.
+ * Contains "hits" and "misses" counters summed over all the streams.
+ */
+static constexpr Property<std::map<std::string, uint64_t>, PropertyMutability::RO> dynamic_shapes_cache_stats{
+    "CPU_DYNAMIC_SHAPES_CACHE_STATS"};
+
 }  // namespace ov::intel_cpu
@@ -0,0 +1,190 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "interval_memory_solver.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "utils/general_utils.h"
+
+namespace ov::intel_cpu {
+
+IntervalMemorySolver::IntervalMemorySolver(const std::vector<Box>& boxes, size_t alignment)
+    : m_boxes(boxes),
+      m_alignment(alignment) {
+    OPENVINO_ASSERT(m_alignment > 0, "IntervalMemorySolver: alignment must be positive");
+
+    int maxTs = 0;
+    for (const auto& box : m_boxes) {
+        maxTs = std::max({maxTs, box.start, box.finish});
+    }
+
+    std::map<std::pair<int, int>, size_t> clusterByLifetime;
+    for (size_t i = 0; i < m_boxes.size(); i++) {
+        auto& box = m_boxes[i];
+        if (box.finish == -1) {
+            box.finish = maxTs;
+        }
+        OPENVINO_ASSERT(box.start >= 0 && box.start <= box.finish,
+                        "IntervalMemorySolver: wrong lifetime of the box ",
+                        box.id);
+        OPENVINO_ASSERT(box.size >= 0, "IntervalMemorySolver: undefined size of the box ", box.id);
+        box.size = static_cast<int64_t>(div_up(static_cast<size_t>(box.size), m_alignment) * m_alignment);
+
+        auto res = clusterByLifetime.emplace(std::make_pair(box.start, box.finish), m_clusters.size());
+        if (res.second) {
+            m_clusters.push_back({box.start, box.finish, 0, {}});
+        }
+        auto& cluster = m_clusters[res.first->second];
+        cluster.size += box.size;
+        cluster.boxes.push_back(i);
+    }
+
+    for (auto& cluster : m_clusters) {
+        std::stable_sort(cluster.boxes.begin(), cluster.boxes.end(), [this](size_t l, size_t r) {
+            return m_boxes[l].size > m_boxes[r].size;
+        });
+    }
+}
+
+int64_t IntervalMemorySolver::place(const std::vector<Cluster>& clusters,
+                                    const std::vector<size_t>& order,
+                                    std::vector<int64_t>& offsets) {
+    offsets.assign(clusters.size(), 0);
+    std::vector<size_t> placed;
+    placed.reserve(clusters.size());
+    std::vector<std::pair<int64_t, int64_t>> busy;
+
+    int64_t total = 0;
+    for (const auto idx : order) {
+        const auto& cluster = clusters[idx];
+        if (cluster.size == 0) {
+            continue;
+        }
+
+        busy.clear();
+        for (const auto other : placed) {
+            const auto& placedCluster = clusters[other];
+            if (placedCluster.start <= cluster.finish && cluster.start <= placedCluster.finish) {
+                busy.emplace_back(offsets[other], offsets[other] + placedCluster.size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+
+        // the best fit gap is the smallest one which can hold the cluster, the top of the memory otherwise
+        int64_t top = 0;
+        int64_t bestOffset = -1;
+        int64_t bestWaste = std::numeric_limits<int64_t>::max();
+        for (const auto& [begin, end] : busy) {
+            const auto gap = begin - top;
+            if (gap >= cluster.size && gap - cluster.size < bestWaste) {
+                bestWaste = gap - cluster.size;
+                bestOffset = top;
+            }
+            top = std::max(top, end);
+        }
+        if (bestOffset < 0) {
+            bestOffset = top;
+        }
+
+        offsets[idx] = bestOffset;
+        total = std::max(total, bestOffset + cluster.size);
+        placed.push_back(idx);
+    }
+
+    return total;
+}
+
+int64_t IntervalMemorySolver::solve() {
+    auto lifetime = [this](size_t idx) {
+        return m_clusters[idx].finish - m_clusters[idx].start;
+    };
+    auto bySize = [&](size_t l, size_t r) {
+        const auto& lc = m_clusters[l];
+        const auto& rc = m_clusters[r];
+        if (lc.size != rc.size) {
+            return lc.size > rc.size;
+        }
+        return lifetime(l) > lifetime(r);
+    };
+    auto byLifetime = [&](size_t l, size_t r) {
+        if (lifetime(l) != lifetime(r)) {
+            return lifetime(l) > lifetime(r);
+        }
+        return m_clusters[l].size > m_clusters[r].size;
+    };
+    auto byArea = [&](size_t l, size_t r) {
+        const auto la = m_clusters[l].size * (lifetime(l) + 1);
+        const auto ra = m_clusters[r].size * (lifetime(r) + 1);
+        if (la != ra) {
+            return la > ra;
+        }
+        return bySize(l, r);
+    };
+
+    std::vector<size_t> order(m_clusters.size());
+    std::vector<int64_t> offsets;
+    std::vector<int64_t> bestOffsets;
+    int64_t bestTotal = std::numeric_limits<int64_t>::max();
+
+    auto tryOrder = [&](const auto& cmp) {
+        std::iota(order.begin(), order.end(), 0);
+        std::stable_sort(order.begin(), order.end(), cmp);
+        const auto total = place(m_clusters, order, offsets);
+        if (total < bestTotal) {
+            bestTotal = total;
+            std::swap(bestOffsets, offsets);
+        }
+    };
+
+    tryOrder(bySize);
+    tryOrder(byLifetime);
+    tryOrder(byArea);
+
+    m_offsets.clear();
+    for (size_t i = 0; i < m_clusters.size(); i++) {
+        auto offset = bestOffsets[i];
+        for (const auto boxIdx : m_clusters[i].boxes) {
+            m_offsets[m_boxes[boxIdx].id] = offset;
+            offset += m_boxes[boxIdx].size;
+        }
+    }
+
+    return m_clusters.empty() ? 0 : bestTotal;
+}
+
+int64_t IntervalMemorySolver::getOffset(int64_t id) const {
+    auto res = m_offsets.find(id);
+    OPENVINO_ASSERT(res != m_offsets.end(), "IntervalMemorySolver: there is no box with id ", id);
+    return res->second;
+}
+
+int64_t IntervalMemorySolver::lowerBound() const {
+    // the box is alive in [start, finish], so it is released at finish + 1, before the boxes starting at that index
+    std::vector<std::pair<int, int64_t>> events;
+    events.reserve(m_boxes.size() * 2);
+    for (const auto& box : m_boxes) {
+        events.emplace_back(box.start, box.size);
+        events.emplace_back(box.finish + 1, -box.size);
+    }
+    std::sort(events.begin(), events.end());
+
+    int64_t current = 0;
+    int64_t result = 0;
+    for (const auto& event : events) {
+        current += event.second;
+        result = std::max(result, current);
+    }
+    return result;
+}
+
+}  // namespace ov::intel_cpu
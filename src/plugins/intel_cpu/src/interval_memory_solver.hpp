@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "openvino/runtime/memory_solver.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Static memory solver which treats the boxes lifetimes as an interval graph and assigns the offsets with the
+ * best-fit policy.
+ *
+ * The solver works in three steps:
+ * - alignment aware packing: every box size is rounded up to the alignment, so all the offsets are aligned and the
+ *   gaps between the boxes are never smaller than the alignment;
+ * - clustering: the boxes with exactly the same lifetime (e.g. the in-place edge clusters of a node or the outputs of
+ *   a multi-output node) always interfere with the same set of boxes, so they are packed contiguously and placed as
+ *   a single box, which avoids fragmenting the memory between them;
+ * - best-fit offset assignment: the clusters are placed one by one into the smallest gap left by the already placed
+ *   clusters interfering with it in time, the top of the memory is used only if no gap fits.
+ *   The placement is done for several orders of the clusters (greedy by size and greedy by lifetime) and the most
+ *   compact one is kept.
+ *
+ * The boxes use the same notation as ov::MemorySolver, but the size is measured in bytes and the finish index is
+ * inclusive, -1 means till the end of the execution.
+ */
+class IntervalMemorySolver {
+public:
+    using Box = ov::MemorySolver::Box;
+
+    static constexpr size_t defaultAlignment = 64;
+
+    explicit IntervalMemorySolver(const std::vector<Box>& boxes, size_t alignment = defaultAlignment);
+
+    /**
+     * @brief Solves the memory placement
+     * @return size in bytes of the common memory blob required for storing all the boxes
+     */
+    int64_t solve();
+
+    /**
+     * @brief Provides the calculated offset in bytes for the specified box id
+     */
+    [[nodiscard]] int64_t getOffset(int64_t id) const;
+
+    /**
+     * @brief The maximum size of the aligned boxes alive at the same time, no placement can use less memory
+     */
+    [[nodiscard]] int64_t lowerBound() const;
+
+private:
+    struct Cluster {
+        int start;
+        int finish;
+        int64_t size;
+        std::vector<size_t> boxes;  // indices of the boxes in the descending size order
+    };
+
+    static int64_t place(const std::vector<Cluster>& clusters,
+                         const std::vector<size_t>& order,
+                         std::vector<int64_t>& offsets);
+
+    std::vector<Box> m_boxes;
+    std::vector<Cluster> m_clusters;
+    std::unordered_map<int64_t, int64_t> m_offsets;
+    size_t m_alignment;
+};
+
+}  // namespace ov::intel_cpu
@@ -8,7 +8,10 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <istream>
 #include <memory>
+#include <ostream>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -20,7 +23,10 @@
 #    include <unordered_set>
 #endif
 
+#include "activation_arena.hpp"
 #include "cpu_memory.h"
+#include "internal_properties.hpp"
+#include "interval_memory_solver.hpp"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/memory_solver.hpp"
 #include "utils/debug_capabilities.h"
@@ -160,6 +166,9 @@ public:
     virtual const MemoryControl::MemorySolution& lastSolution() = 0;
     virtual void allocate() = 0;
     virtual void release() = 0;
+    virtual void releaseLease() {
+        // nothing to do
+    }
 };
 
 using MemoryManagerPtr = std::shared_ptr<IMemoryManager>;
@@ -207,6 +216,13 @@ private:
 
 class MemoryManagerStatic : public IMemoryManager {
 public:
+    MemoryManagerStatic(MemorySolverType solverType,
+                        ActivationArena::Ptr arena,
+                        ActivationArenaStatisticsPtr arenaStats)
+        : m_arena(std::move(arena)),
+          m_arenaStats(std::move(arenaStats)),
+          m_solverType(solverType) {}
+
     void insert(const MemoryRegion& reg, [[maybe_unused]] const std::vector<size_t>& syncInds) override {
         OPENVINO_ASSERT(reg.size >= 0, getClassName(), ": got undefined block size");
         m_boxes.emplace_back(MemorySolver::Box{reg.start, reg.finish, reg.size, reg.id});
@@ -223,6 +239,18 @@ public:
 
 private:
     void solve() {
+        m_workspace = std::make_shared<MemoryBlockWithRelease>();
+        if (MemorySolverType::INTERVAL_GRAPH == m_solverType) {
+            IntervalMemorySolver intervalMemSolver(m_boxes);
+            m_totalSize = static_cast<size_t>(intervalMemSolver.solve());
+            for (const auto& box : m_boxes) {
+                auto memoryBlock =
+                    std::make_shared<StaticPartitionMemoryBlock>(m_workspace, intervalMemSolver.getOffset(box.id));
+                m_blocks[box.id] = std::move(memoryBlock);
+            }
+            return;
+        }
+
         auto boxes_to_process = m_boxes;
         constexpr size_t alignment = 32;
         std::for_each(boxes_to_process.begin(), boxes_to_process.end(), [=](MemorySolver::Box& box) {
@@ -232,8 +260,6 @@ private:
         ov::MemorySolver staticMemSolver(boxes_to_process);
         m_totalSize = static_cast<size_t>(staticMemSolver.solve()) * alignment;
 
-        m_workspace = std::make_shared<MemoryBlockWithRelease>();
-
         for (const auto& box : boxes_to_process) {
             int64_t offset = staticMemSolver.get_offset(static_cast<int>(box.id));
             auto memoryBlock = std::make_shared<StaticPartitionMemoryBlock>(m_workspace, offset * alignment);
@@ -242,24 +268,44 @@ private:
     }
 
     void allocate() override {
-        if (m_workspace) {
-            m_workspace->resize(m_totalSize);
+        if (!m_workspace) {
+            return;
+        }
+        if (m_arena && m_totalSize > 0) {
+            if (!m_lease) {
+                m_lease = m_arena->lease(m_totalSize, m_arenaStats.get());
+                m_workspace->setExtBuff(m_lease.data(), m_totalSize);
+            }
+            return;
         }
+        m_workspace->resize(m_totalSize);
     }
     void release() override {
         if (m_workspace) {
             m_workspace->free();
         }
+        m_lease.reset();
+    }
+    void releaseLease() override {
+        if (m_lease) {
+            m_workspace->free();
+            m_lease.reset();
+        }
     }
 
-    static const char* getClassName() {
-        return "MemoryManagerStatic";
+    [[nodiscard]] const char* getClassName() const {
+        return MemorySolverType::INTERVAL_GRAPH == m_solverType ? "MemoryManagerStaticIntervalGraph"
+                                                                : "MemoryManagerStatic";
     }
 
     MemoryControl::MemorySolution m_blocks;
     std::vector<MemorySolver::Box> m_boxes;
     std::shared_ptr<MemoryBlockWithRelease> m_workspace;
+    ActivationArena::Ptr m_arena;
+    ActivationArenaStatisticsPtr m_arenaStats;
+    ActivationArena::Lease m_lease;
     size_t m_totalSize = 0;
+    MemorySolverType m_solverType;
     bool reset_flag = true;
     CPU_DEBUG_CAP_ENABLE(friend MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj);)
 };
@@ -414,7 +460,7 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerStatic& obj) {
         return calculateOptimalMemorySize(obj.m_boxes);
     }();
 
-    return {MemoryManagerStatic::getClassName(),
+    return {obj.getClassName(),
             obj.m_boxes.size(),
             1,  // in fact there is only one unique block
             obj.m_totalSize,
@@ -458,6 +504,40 @@ MemoryStatisticsRecord dumpStatisticsImpl(const MemoryManagerNonOverlappingSets&
 
 }  // namespace
 
+void writeMemoryRegions(std::ostream& os, const MemoryRegions& regions) {
+    os << "# start finish size id type alloc_type\n";
+    for (const auto& reg : regions) {
+        os << reg.start << ' ' << reg.finish << ' ' << reg.size << ' ' << reg.id << ' '
+           << static_cast<int>(reg.type) << ' ' << static_cast<int>(reg.alloc_type) << '\n';
+    }
+}
+
+MemoryRegions readMemoryRegions(std::istream& is) {
+    MemoryRegions regions;
+    std::string line;
+    while (std::getline(is, line)) {
+        if (line.empty() || line.front() == '#') {
+            continue;
+        }
+        std::istringstream lineStream(line);
+        MemoryRegion reg{};
+        int type = 0;
+        int allocType = 0;
+        lineStream >> reg.start >> reg.finish >> reg.size >> reg.id >> type >> allocType;
+        OPENVINO_ASSERT(!lineStream.fail(), "Cannot parse the memory region: ", line);
+        OPENVINO_ASSERT(type >= 0 && type <= static_cast<int>(MemoryRegion::RegionType::IO),
+                        "Unexpected memory region type: ",
+                        line);
+        OPENVINO_ASSERT(allocType >= 0 && allocType <= static_cast<int>(MemoryRegion::AllocType::UNKNOWN),
+                        "Unexpected memory region allocation type: ",
+                        line);
+        reg.type = static_cast<MemoryRegion::RegionType>(type);
+        reg.alloc_type = static_cast<MemoryRegion::AllocType>(allocType);
+        regions.push_back(reg);
+    }
+    return regions;
+}
+
 class MemoryControl::RegionHandler {
 public:
     using Condition = std::function<bool(const MemoryRegion&)>;
@@ -487,6 +567,10 @@ public:
         m_memManager->release();
     }
 
+    void releaseLease() {
+        m_memManager->releaseLease();
+    }
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] MemoryStatisticsRecord dumpStatistics() const {
         return m_statDumper(m_memManager);
@@ -525,12 +609,20 @@ MemoryControl::RegionHandlerPtr buildHandler(F&& f, Args&&... args) {
 
 }  // namespace
 
-MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
+MemoryControl::MemoryControl(std::string id,
+                             MemorySolverType solverType,
+                             const ActivationArena::Ptr& arena,
+                             const ActivationArenaStatisticsPtr& arenaStats)
+    : m_id(std::move(id)) {
     // init handlers
-    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>([](const MemoryRegion& reg) {
-        return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
-               MemoryRegion::AllocType::POD == reg.alloc_type;
-    }));
+    m_handlers.emplace_back(buildHandler<MemoryManagerStatic>(
+        [](const MemoryRegion& reg) {
+            return reg.size >= 0 && MemoryRegion::RegionType::VARIABLE == reg.type &&
+                   MemoryRegion::AllocType::POD == reg.alloc_type;
+        },
+        solverType,
+        arena,
+        arenaStats));
 
     // handler for static tensors
     m_handlers.emplace_back(buildHandler<MemoryManagerNonOverlappingSets>([](const MemoryRegion& reg) {
@@ -545,6 +637,7 @@ MemoryControl::MemoryControl(std::string id) : m_id(std::move(id)) {
 }
 
 void MemoryControl::insert(const MemoryRegion& region, const std::vector<size_t>& syncInds) {
+    CPU_DEBUG_CAP_ENABLE(m_regions.push_back(region);)
     for (auto&& handler : m_handlers) {
         if (handler->insert(region, syncInds)) {
             return;
@@ -587,6 +680,13 @@ void MemoryControl::releaseMemory() {
     m_allocated = false;
 }
 
+void MemoryControl::releaseLeasedMemory() {
+    for (auto&& handler : m_handlers) {
+        handler->releaseLease();
+    }
+    m_allocated = false;
+}
+
 #ifdef CPU_DEBUG_CAPS
 MemoryStatistics MemoryControl::dumpStatistics() const {
     MemoryStatistics profileData;
@@ -597,8 +697,13 @@ MemoryStatistics MemoryControl::dumpStatistics() const {
 }
 #endif  // CPU_DEBUG_CAPS
 
-MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id) {
-    m_controlUnits.emplace_back(std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id))));
+NetworkMemoryControl::NetworkMemoryControl(ActivationArena::Ptr arena)
+    : m_arena(std::move(arena)),
+      m_arenaStats(m_arena ? std::make_shared<ActivationArenaStatistics>() : nullptr) {}
+
+MemoryControl::Ptr NetworkMemoryControl::createMemoryControlUnit(std::string id, MemorySolverType solverType) {
+    m_controlUnits.emplace_back(
+        std::shared_ptr<MemoryControl>(new MemoryControl(std::move(id), solverType, m_arena, m_arenaStats)));
     return m_controlUnits.back();
 }
 
@@ -614,6 +719,15 @@ void NetworkMemoryControl::releaseMemory() {
     }
 }
 
+void NetworkMemoryControl::releaseLeasedMemory() {
+    if (!m_arena) {
+        return;
+    }
+    for (auto&& item : m_controlUnits) {
+        item->releaseLeasedMemory();
+    }
+}
+
 std::vector<std::pair<std::string, MemoryStatistics>> NetworkMemoryControl::dumpStatistics() const {
 #ifdef CPU_DEBUG_CAPS
     std::vector<std::pair<std::string, MemoryStatistics>> retVal;
@@ -6,14 +6,17 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <iosfwd>
 #include <memory>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
+#include "activation_arena.hpp"
 #include "cpu_memory.h"
 #include "edge.h"
+#include "internal_properties.hpp"
 
 namespace ov::intel_cpu {
 
@@ -31,6 +34,13 @@ struct MemoryRegion {
 };
 
 using MemoryRegions = std::vector<MemoryRegion>;
+
+/**
+ * @brief Serializes the memory regions as a text, one region per line, e.g. to benchmark the memory solvers offline
+ */
+void writeMemoryRegions(std::ostream& os, const MemoryRegions& regions);
+MemoryRegions readMemoryRegions(std::istream& is);
+
 struct MemoryStatisticsRecord {
     const char* id;
     size_t total_regions;        // number of regions
@@ -61,13 +71,26 @@ public:
 
     void allocateMemory();
     void releaseMemory();
+    /**
+     * @brief Returns the memory leased from the activation arena, it is leased again on the next allocation
+     */
+    void releaseLeasedMemory();
 
     [[nodiscard]] const std::string& getId() const {
         return m_id;
     }
 
+#ifdef CPU_DEBUG_CAPS
+    [[nodiscard]] const MemoryRegions& getRegions() const {
+        return m_regions;
+    }
+#endif  // CPU_DEBUG_CAPS
+
 private:
-    explicit MemoryControl(std::string id);
+    MemoryControl(std::string id,
+                  MemorySolverType solverType,
+                  const ActivationArena::Ptr& arena,
+                  const ActivationArenaStatisticsPtr& arenaStats);
     void insert(const MemoryRegion& region, const std::vector<size_t>& syncInds);
     [[nodiscard]] MemoryStatistics dumpStatistics() const;
 
@@ -76,24 +99,43 @@ private:
     std::string m_id;
     std::vector<RegionHandlerPtr> m_handlers;
     bool m_allocated = false;
+#ifdef CPU_DEBUG_CAPS
+    MemoryRegions m_regions;
+#endif  // CPU_DEBUG_CAPS
 };
 
 class NetworkMemoryControl {
 public:
-    NetworkMemoryControl() = default;
-    MemoryControl::Ptr createMemoryControlUnit(std::string id);
+    /**
+     * @param arena shared arena to lease the static intermediate tensors memory from for the duration of an inference,
+     * nullptr means the memory is owned by the control units
+     */
+    explicit NetworkMemoryControl(ActivationArena::Ptr arena = nullptr);
+    MemoryControl::Ptr createMemoryControlUnit(std::string id,
+                                               MemorySolverType solverType = MemorySolverType::DEFAULT);
 
     void allocateMemory();
     void releaseMemory();
+    void releaseLeasedMemory();
 
     [[nodiscard]] std::vector<std::pair<std::string, MemoryStatistics>> dumpStatistics() const;
 
+    [[nodiscard]] const ActivationArena::Ptr& activationArena() const {
+        return m_arena;
+    }
+
+    [[nodiscard]] const ActivationArenaStatisticsPtr& activationArenaStatistics() const {
+        return m_arenaStats;
+    }
+
     [[nodiscard]] const std::vector<MemoryControl::Ptr>& controlUnits() const {
         return m_controlUnits;
     }
 
 private:
     std::vector<MemoryControl::Ptr> m_controlUnits;
+    ActivationArena::Ptr m_arena;
+    ActivationArenaStatisticsPtr m_arenaStats;
 };
 
 }  // namespace ov::intel_cpu
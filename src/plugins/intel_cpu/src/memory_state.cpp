@@ -9,7 +9,9 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
 #include <utility>
@@ -38,6 +40,38 @@ using namespace ov::Extensions::Cpu::XARCH;
 
 namespace ov::intel_cpu {
 
+namespace {
+
+bool is_quantized_kv_cache(const ov::element::Type& precision) {
+    return any_of(precision, element::u8, element::u4);
+}
+
+VectorDims plain_order(size_t rank) {
+    VectorDims order(rank);
+    std::iota(order.begin(), order.end(), 0);
+    return order;
+}
+
+// strides of the external tensor in elements, the sub-byte tensors are expected to be dense
+VectorDims element_strides(const ov::SoPtr<ov::ITensor>& tensor) {
+    const auto& shape = tensor->get_shape();
+    VectorDims strides(shape.size(), 1);
+    if (tensor->is_continuous()) {
+        for (size_t i = shape.size() - 1; i > 0; i--) {
+            strides[i - 1] = strides[i] * shape[i];
+        }
+        return strides;
+    }
+    const auto& byte_strides = tensor->get_strides();
+    const auto element_size = tensor->get_element_type().size();
+    std::transform(byte_strides.begin(), byte_strides.end(), strides.begin(), [&](size_t stride) {
+        return stride / element_size;
+    });
+    return strides;
+}
+
+}  // namespace
+
 VariableStateBase::VariableStateBase(const std::string& name, MemoryDescPtr external_desc)
     : IVariableState{name},
       m_external_desc{std::move(external_desc)} {}
@@ -322,6 +356,8 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
                     "owned by the SDPA node; external state cannot be injected directly.");
     // 1. reset the memory object
     m_state = state;  // simply to extend the lifetime
+    m_imported_state = {};
+    m_pending_state = {};
     auto state_desc = MemoryDescUtils::generateCpuBlockedMemoryDesc(m_state);
 
     // May be optimized by reusing the state tensor underlining memory pointer, but corner cases should be considered
@@ -347,6 +383,9 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
         auto S = internal.size(3);
         auto nthr = parallel_get_max_threads();
         std::vector<PlainTensor> buffers(nthr);
+        if (m_shared_buffers) {
+            m_scale_zp = {};  // the raw state views keep the shared buffer
+        }
         if (m_spec.by_channel) {
             size_t group_nums = div_up(L0, m_spec.group_size);
             m_scale_zp.resize<float>({group_nums * 2, B, H, S});
@@ -406,16 +445,304 @@ void VariableStateKVcache::set_state_impl(const ov::SoPtr<ov::ITensor>& state) {
     }
     m_internal_mem_max_size = dense_internal_desc->getCurrentMemSize() / dense_internal_desc->getPrecision().size();
     m_hidden_state_max_size = mem_desc->getCurrentMemSize() / mem_desc->getPrecision().size();
+    m_shared_buffers = false;
 }
 
 void VariableStateKVcache::reset_impl() {
-    // nothing to do
+    m_pending_state = {};
 }
 
 void VariableStateKVcache::commit_impl() {
     // nothing to do
 }
 
+void VariableStateKVcache::evict(size_t begin, size_t count) {
+    if (count == 0) {
+        return;
+    }
+    OPENVINO_ASSERT(m_internal_mem && m_hidden_state, "KV cache state ", get_name(), " is not initialized");
+    if (m_shared_buffers) {
+        unshare_buffers();
+    }
+    auto desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    const auto& order = desc->getOrder();
+    const auto& strides = desc->getStrides();
+    auto dims = desc->getShape().getStaticDims();
+    // the tokens are the outermost dimension of the cache, so every token is a contiguous block
+    const size_t L = dims[order[0]];
+    OPENVINO_ASSERT(begin + count <= L, "Cannot evict tokens [", begin, ", ", begin + count, ") of ", L);
+    OPENVINO_ASSERT(!m_spec.by_channel || (begin % m_spec.group_size == 0 && count % m_spec.group_size == 0),
+                    "Evicted tokens must be aligned to the quantization groups of the by-channel cache ",
+                    get_name());
+    const size_t tail = L - begin - count;
+
+    const auto precision = desc->getPrecision();
+    const size_t token_bytes = strides[0] * precision.bitwidth() / 8;
+    auto* data = m_internal_mem->getDataAs<uint8_t>();
+    std::memmove(data + begin * token_bytes, data + (begin + count) * token_bytes, tail * token_bytes);
+    dims[order[0]] = L - count;
+    auto block_dims = desc->getBlockDims();
+    block_dims[0] = L - count;
+    m_internal_mem->redefineDesc(
+        std::make_shared<CpuBlockedMemoryDesc>(precision, Shape(dims), block_dims, order, 0, VectorDims{}, strides));
+
+    if (m_scale_zp) {
+        // the scales and zero points are stored per token or in the pairs of rows per group of tokens (by channel)
+        const size_t rows_per_token = m_spec.by_channel ? 2 : 1;
+        const size_t group = m_spec.by_channel ? m_spec.group_size : 1;
+        const size_t moved_rows = (div_up(L, group) - (begin + count) / group) * rows_per_token;
+        std::memmove(m_scale_zp.ptr<float>(begin / group * rows_per_token),
+                     m_scale_zp.ptr<float>((begin + count) / group * rows_per_token),
+                     moved_rows * m_scale_zp.stride(0) * sizeof(float));
+    }
+
+    auto hidden_desc = m_hidden_state->getDescWithType<BlockedMemoryDesc>();
+    const auto& hidden_strides = hidden_desc->getStrides();
+    const size_t B = hidden_desc->getShape().getStaticDims()[0];
+    auto* beam_table = m_hidden_state->getDataAs<int32_t>();
+    for (size_t b = 0; b < B; b++) {
+        auto* row = beam_table + b * hidden_strides[0];
+        std::memmove(row + begin, row + begin + count, tail * sizeof(int32_t));
+    }
+    std::vector<size_t> hidden_dims{B, L - count};
+    m_hidden_state->redefineDesc(std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                                        Shape(hidden_dims),
+                                                                        hidden_dims,
+                                                                        VectorDims{0, 1},
+                                                                        0,
+                                                                        VectorDims{},
+                                                                        hidden_strides));
+}
+
+void VariableStateKVcache::unshare_buffers() {
+    auto copy_memory = [&](const MemoryPtr& mem) {
+        auto copy = std::make_shared<Memory>(get_engine(), mem->getDescPtr());
+        std::memcpy(copy->getData(), mem->getData(), mem->getSize());
+        return copy;
+    };
+    m_internal_mem = copy_memory(m_internal_mem);
+    m_hidden_state = copy_memory(m_hidden_state);
+    if (m_scale_zp) {
+        PlainTensor scale_zp;
+        scale_zp.resize<float>(m_scale_zp.shape());
+        for (size_t m = 0; m < m_scale_zp.size(0); m++) {
+            for (size_t b = 0; b < m_scale_zp.size(1); b++) {
+                for (size_t h = 0; h < m_scale_zp.size(2); h++) {
+                    std::memcpy(scale_zp.ptr<float>(m, b, h),
+                                m_scale_zp.ptr<float>(m, b, h),
+                                m_scale_zp.size(3) * sizeof(float));
+                }
+            }
+        }
+        m_scale_zp = scale_zp;
+    }
+    auto desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    m_internal_mem_max_size =
+        std::min(desc->getCurrentMemSize() / desc->getPrecision().size(), desc->getShape().getElementsCount());
+    m_hidden_state_max_size = m_hidden_state->getShape().getElementsCount();
+    m_imported_state = {};
+    m_shared_buffers = false;
+}
+
+VariableStateKVcache::RawState VariableStateKVcache::export_raw_state() {
+    OPENVINO_ASSERT(m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO,
+                    "Raw state export is not supported for KV cache with TURBO quantization: the per-token norm "
+                    "metadata is owned by the SDPA node.");
+    OPENVINO_ASSERT(m_internal_mem && m_hidden_state && !is_reset_state(),
+                    "KV cache state ",
+                    get_name(),
+                    " is not initialized");
+    RawState state;
+    // the physical layout is exposed as the plain one, so the view shares the cache memory as is
+    auto desc = m_internal_mem->getDescWithType<BlockedMemoryDesc>();
+    const auto& block_dims = desc->getBlockDims();
+    auto cache_desc = std::make_shared<CpuBlockedMemoryDesc>(desc->getPrecision(),
+                                                             Shape(block_dims),
+                                                             block_dims,
+                                                             plain_order(block_dims.size()),
+                                                             0,
+                                                             VectorDims{},
+                                                             desc->getStrides());
+    state.cache =
+        std::make_shared<Tensor>(std::make_shared<Memory>(get_engine(), cache_desc, m_internal_mem->getMemoryBlock()));
+    state.beam_table = std::make_shared<Tensor>(
+        std::make_shared<Memory>(get_engine(), m_hidden_state->getDescPtr(), m_hidden_state->getMemoryBlock()));
+
+    if (is_quantized_kv_cache(desc->getPrecision())) {
+        // the scales and zero points buffer has the spare rows for the next tokens, only the used ones are exposed
+        const size_t L = block_dims[0];
+        VectorDims dims(m_scale_zp.m_dims, m_scale_zp.m_dims + m_scale_zp.m_rank);
+        VectorDims strides(m_scale_zp.m_strides, m_scale_zp.m_strides + m_scale_zp.m_rank);
+        dims[0] = m_spec.by_channel ? div_up(L, m_spec.group_size) * 2 : L;
+        auto scale_zp_desc = std::make_shared<CpuBlockedMemoryDesc>(element::f32,
+                                                                    Shape(dims),
+                                                                    dims,
+                                                                    plain_order(dims.size()),
+                                                                    0,
+                                                                    VectorDims{},
+                                                                    strides);
+        // the view holds the buffer, as the state drops it when the cache is moved to the new buffers
+        state.scale_zp = {
+            std::make_shared<Tensor>(std::make_shared<Memory>(get_engine(), scale_zp_desc, m_scale_zp.ptr<float>())),
+            std::make_shared<PlainTensor>(m_scale_zp)};
+    }
+    // no spare capacity is left, so the SDPA node moves the state to the new buffers before writing to it and the views
+    // stay unchanged
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    m_shared_buffers = true;
+    return state;
+}
+
+void VariableStateKVcache::import_raw_state(const RawState& state) {
+    OPENVINO_ASSERT(m_spec.alg != ov::internal::CacheQuantAlgorithm::TURBO,
+                    "Raw state import is not supported for KV cache with TURBO quantization: the per-token norm "
+                    "metadata is owned by the SDPA node.");
+    OPENVINO_ASSERT(state.cache && state.beam_table, "KV cache state ", get_name(), " misses the cache or beam table");
+
+    const auto precision = m_dense_internal_desc->getPrecision();
+    const auto& order = m_dense_internal_desc->getOrder();
+    OPENVINO_ASSERT(state.cache->get_element_type() == precision,
+                    "KV cache state ",
+                    get_name(),
+                    " expects the raw cache of ",
+                    precision,
+                    " precision, got ",
+                    state.cache->get_element_type());
+    const auto& cache_shape = state.cache->get_shape();
+    OPENVINO_ASSERT(cache_shape.size() == order.size(), "Unexpected raw KV cache rank ", cache_shape.size());
+    OPENVINO_ASSERT(state.cache->is_continuous() || precision.bitwidth() >= 8,
+                    "The raw KV cache of ",
+                    precision,
+                    " precision must be dense");
+
+    VectorDims block_dims(cache_shape.begin(), cache_shape.end());
+    VectorDims dims(order.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        dims[order[i]] = block_dims[i];
+    }
+    const size_t L = block_dims[0];
+    const size_t B = block_dims[1];
+
+    const auto& beam_shape = state.beam_table->get_shape();
+    OPENVINO_ASSERT(state.beam_table->get_element_type() == element::i32 && beam_shape == ov::Shape{B, L},
+                    "Unexpected raw KV cache beam table ",
+                    state.beam_table->get_element_type(),
+                    " ",
+                    beam_shape,
+                    ", expected i32 ",
+                    ov::Shape{B, L});
+
+    PlainTensor scale_zp;
+    if (is_quantized_kv_cache(precision)) {
+        OPENVINO_ASSERT(state.scale_zp && state.scale_zp->get_element_type() == element::f32,
+                        "The quantized KV cache state ",
+                        get_name(),
+                        " requires the f32 scales and zero points");
+        const auto& scale_zp_shape = state.scale_zp->get_shape();
+        const size_t rows = m_spec.by_channel ? div_up(L, m_spec.group_size) * 2 : L;
+        OPENVINO_ASSERT(scale_zp_shape.size() == 4 && scale_zp_shape[0] == rows,
+                        "Unexpected raw KV cache scales and zero points shape ",
+                        scale_zp_shape);
+        auto strides = element_strides(state.scale_zp);
+        OPENVINO_ASSERT(strides.back() == 1,
+                        "The raw KV cache scales and zero points must be dense in the last dimension");
+        scale_zp.resize<float>(VectorDims(scale_zp_shape.begin(), scale_zp_shape.end()),
+                               static_cast<float*>(state.scale_zp->data()),
+                               strides.data());
+    }
+
+    auto cache_desc = std::make_shared<CpuBlockedMemoryDesc>(precision,
+                                                             Shape(dims),
+                                                             block_dims,
+                                                             order,
+                                                             0,
+                                                             VectorDims{},
+                                                             element_strides(state.cache));
+    auto hidden_desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::i32,
+                                                              Shape(VectorDims{B, L}),
+                                                              VectorDims{B, L},
+                                                              VectorDims{0, 1},
+                                                              0,
+                                                              VectorDims{},
+                                                              element_strides(state.beam_table));
+    m_internal_mem = std::make_shared<Memory>(get_engine(), cache_desc, state.cache->data());
+    m_hidden_state = std::make_shared<Memory>(get_engine(), hidden_desc, state.beam_table->data());
+    m_scale_zp = scale_zp;
+    m_imported_state = state;
+    m_state = {};
+
+    // the caller buffers are never written: the SDPA node moves the state to the plugin memory before appending the
+    // next tokens or starting over after reset, the sliding window eviction copies it before compacting
+    m_internal_mem_max_size = 0;
+    m_hidden_state_max_size = 0;
+    m_shared_buffers = true;
+    m_pending_state = {};
+    clear_reset_state_flag();
+}
+
+bool VariableStateKVcache::has_raw_scale_zp() const {
+    return is_quantized_kv_cache(m_dense_internal_desc->getPrecision());
+}
+
+void VariableStateKVcache::import_raw_part(RawPart part, const ov::SoPtr<ov::ITensor>& tensor) {
+    switch (part) {
+    case RawPart::CACHE:
+        m_pending_state.cache = tensor;
+        break;
+    case RawPart::BEAM_TABLE:
+        m_pending_state.beam_table = tensor;
+        break;
+    case RawPart::SCALE_ZP:
+        m_pending_state.scale_zp = tensor;
+        break;
+    }
+    if (m_pending_state.cache && m_pending_state.beam_table && (m_pending_state.scale_zp || !has_raw_scale_zp())) {
+        import_raw_state(m_pending_state);
+    }
+}
+
+namespace {
+std::string raw_part_name(const std::string& name, VariableStateKVcache::RawPart part) {
+    switch (part) {
+    case VariableStateKVcache::RawPart::CACHE:
+        return name + "/raw/cache";
+    case VariableStateKVcache::RawPart::BEAM_TABLE:
+        return name + "/raw/beam_table";
+    case VariableStateKVcache::RawPart::SCALE_ZP:
+        return name + "/raw/scale_zp";
+    }
+    OPENVINO_THROW("Unexpected raw KV cache state part");
+}
+}  // namespace
+
+VariableStateKVcacheRawPart::VariableStateKVcacheRawPart(std::shared_ptr<VariableStateKVcache> state,
+                                                         VariableStateKVcache::RawPart part)
+    : ov::IVariableState(raw_part_name(state->get_name(), part)),
+      m_kv_state(std::move(state)),
+      m_part(part) {}
+
+void VariableStateKVcacheRawPart::set_state(const ov::SoPtr<ov::ITensor>& state) {
+    m_kv_state->import_raw_part(m_part, state);
+}
+
+ov::SoPtr<ov::ITensor> VariableStateKVcacheRawPart::get_state() const {
+    auto state = m_kv_state->export_raw_state();
+    switch (m_part) {
+    case VariableStateKVcache::RawPart::CACHE:
+        return state.cache;
+    case VariableStateKVcache::RawPart::BEAM_TABLE:
+        return state.beam_table;
+    case VariableStateKVcache::RawPart::SCALE_ZP:
+        return state.scale_zp;
+    }
+    OPENVINO_THROW("Unexpected raw KV cache state part");
+}
+
+void VariableStateKVcacheRawPart::reset() {
+    m_kv_state->reset();
+}
+
 MemoryPtr VariableStateKVcache::input_mem() {
     return m_internal_mem;
 }
@@ -434,6 +761,7 @@ MemoryPtr VariableStateKVcache::internal_state_mem() const {
 
 void VariableStateKVcache::assign_internal_state(const MemoryPtr& mem) {
     m_internal_mem = mem;
+    m_shared_buffers = false;  // the SDPA node moved the state to the new buffers
 }
 
 MemoryPtr VariableStateKVcache::hidden_state_mem() const {
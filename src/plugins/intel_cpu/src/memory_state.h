@@ -6,6 +6,7 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
@@ -57,6 +58,10 @@ protected:
         return m_external_desc;
     }
 
+    void clear_reset_state_flag() {
+        reset_state_flag = false;
+    }
+
 private:
     MemoryDescPtr m_external_desc;
     bool reset_state_flag = true;
@@ -121,6 +126,18 @@ private:
 
 class VariableStateKVcache : public VariableStateBase {
 public:
+    /**
+     * @brief The KV cache state in the internal representation: the cache in its internal (possibly quantized)
+     * precision and the physical [L, B, H, S] layout, the beam table [B, L] and, for the quantized cache, the
+     * quantization scales and zero points.
+     */
+    struct RawState {
+        ov::SoPtr<ov::ITensor> cache;
+        ov::SoPtr<ov::ITensor> beam_table;
+        ov::SoPtr<ov::ITensor> scale_zp;
+    };
+    enum class RawPart : uint8_t { CACHE, BEAM_TABLE, SCALE_ZP };
+
     VariableStateKVcache(const std::string& name,
                          MemoryDescPtr external_desc,
                          BlockedMemoryDescPtr dense_internal_desc,
@@ -166,12 +183,43 @@ public:
         return m_spec;
     }
 
+    /**
+     * @brief Removes the tokens [begin, begin + count) from the cache in place: the following tokens (with their
+     * quantization parameters and beam table entries) are moved to the freed slots, the allocated buffers are reused
+     * by the next tokens. The by-channel quantized cache can only evict the whole quantization groups.
+     */
+    void evict(size_t begin, size_t count);
+
+    /**
+     * @brief Returns the views over the internal buffers of the state without copying or converting them.
+     * The views hold the buffers and never change: the state is copied to the new buffers before it is written
+     * again, i.e. by the next inference, which makes exporting the state of a running request cost a cache copy.
+     */
+    RawState export_raw_state();
+
+    /**
+     * @brief Adopts the buffers in the format returned by export_raw_state() as the state without copying or
+     * converting them. The state holds the tensors and only reads them, it is copied to the plugin memory before it is
+     * written, i.e. when the next tokens are appended or evicted.
+     */
+    void import_raw_state(const RawState& state);
+
+    // whether the raw state has the scales and zero points part
+    bool has_raw_scale_zp() const;
+    /**
+     * @brief Sets one part of the raw state, the state is imported by import_raw_state() once all its parts are set.
+     */
+    void import_raw_part(RawPart part, const ov::SoPtr<ov::ITensor>& tensor);
+
 private:
     // ov::intel_cpu::VariableStateBase
     void set_state_impl(const ov::SoPtr<ov::ITensor>& state) override;
     void reset_impl() override;
     void commit_impl() override;
 
+    // copies the state shared with the raw state views or the caller to the plugin memory
+    void unshare_buffers();
+
     MemoryPtr m_internal_mem;  // kv cache
     MemoryPtr m_hidden_state;  // beam access table
     size_t m_internal_mem_max_size = 0;
@@ -183,6 +231,29 @@ private:
     // for u8 kv cache: [B, H, L, 2], 0 for scale, 1 for zp
     PlainTensor m_scale_zp;
     ov::Extensions::Cpu::CacheSpec m_spec;
+
+    RawState m_imported_state;  // extends the lifetime of the adopted buffers
+    // the buffers are exported or adopted, so they are not written in place
+    bool m_shared_buffers = false;
+    RawState m_pending_state;   // the parts set by import_raw_part() before the state is complete
+};
+
+/**
+ * @brief One part of the raw KV cache state exposed by ov::InferRequest::query_state(), see
+ * ov::intel_cpu::kv_cache_raw_state_access.
+ */
+class VariableStateKVcacheRawPart : public ov::IVariableState {
+public:
+    VariableStateKVcacheRawPart(std::shared_ptr<VariableStateKVcache> state, VariableStateKVcache::RawPart part);
+
+    void set_state(const ov::SoPtr<ov::ITensor>& state) override;
+    ov::SoPtr<ov::ITensor> get_state() const override;
+    // resets the whole KV cache state
+    void reset() override;
+
+private:
+    std::shared_ptr<VariableStateKVcache> m_kv_state;
+    VariableStateKVcache::RawPart m_part;
 };
 
 using MemStatePtr = std::shared_ptr<IVariableState>;
@@ -754,7 +754,7 @@ static void fetchRawMemory(const MemoryPtr& mem) {
     }
 }
 
-void Node::updateShapes() {
+void Node::updateShapes(std::vector<VectorDims>* cachedOutputShapes) {
     OPENVINO_ASSERT(isDynamicNode(),
                     "Node::updateShapes() is called to a static shape node of type: ",
                     getTypeStr(),
@@ -762,9 +762,16 @@ void Node::updateShapes() {
                     getName());
     try {
         if (needShapeInfer()) {
+            if (cachedOutputShapes && !cachedOutputShapes->empty()) {
+                redefineOutputMemory(*cachedOutputShapes);
+                return;
+            }
             auto result = shapeInfer();
             if (ShapeInferStatus::success == result.status) {
                 redefineOutputMemory(result.dims);
+                if (cachedOutputShapes) {
+                    *cachedOutputShapes = std::move(result.dims);
+                }
             }
         } else {
             // guard check for internal dynamic nodes to avoid possible overestimation of the required memory size
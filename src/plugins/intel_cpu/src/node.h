@@ -40,6 +40,7 @@
 #include "openvino/core/node.hpp"
 #include "openvino/core/partial_shape.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/profiling_info.hpp"
 #include "perf_count.h"
 #include "utils/bit_util.hpp"
 #include "utils/debug_capabilities.h"
@@ -339,6 +340,11 @@ public:
     virtual bool isExecutable() const {
         return !hasEmptyInputTensors();
     }
+    // the graph may reuse the output shapes inferred for the same input shapes instead of calling shapeInfer(),
+    // so only the nodes which shape inference has no side effects opt in
+    virtual bool canReuseInferredShapes() const {
+        return false;
+    }
 
     enum class ConstantType : uint8_t {
         Const,          // Node is placed in a constant subgraph
@@ -484,13 +490,25 @@ public:
         return perfCounter;
     }
 
+    /**
+     * @brief Appends the performance counters of the internal execution stages of the node, reported right after
+     * the counter of the node itself with the cpu_stage_perf_counters property enabled. Nothing is reported by default.
+     */
+    virtual void appendStagePerfCounters([[maybe_unused]] std::vector<ov::ProfilingInfo>& perfMap) const {}
+
     virtual void resolveInPlaceEdges(Edge::LOOK look);
 
     // @todo this supposed to be 'execute + executeImpl' instead of 'executeStatic + execute'
     // but this requires changes in all the nodes. Since moving to a numa node right before an execute
     // is a temprorary solution, do it this way for now.
     void executeStatic(const dnnl::stream& strm, int numaId = -1);
-    void updateShapes();
+    /**
+     * Infer the output shapes and redefine the output memory accordingly
+     *
+     * @params cachedOutputShapes  Output shapes memoized for the current graph input shapes. If not empty,
+     *                             the shape inference is skipped, otherwise it is filled with the inferred shapes
+     */
+    void updateShapes(std::vector<VectorDims>* cachedOutputShapes = nullptr);
     void updateDynamicParams();
     void executeDynamic(const dnnl::stream& strm, int numaId = -1);
     virtual void redefineOutputMemory(const std::vector<VectorDims>& newOutputShapes);
@@ -29,6 +29,9 @@ public:
     void initOptimalPrimitiveDescriptor() override;
     void selectOptimalPrimitiveDescriptor() override;
     [[nodiscard]] bool created() const override;
+    [[nodiscard]] bool canReuseInferredShapes() const override {
+        return true;
+    }
     void execute(const dnnl::stream& strm) override;
     void executeDynamicImpl(const dnnl::stream& strm) override {
         execute(strm);
@@ -42,6 +42,9 @@ public:
     int registerToAllocationContext(int offset, AllocationContext& context) override;
     void createPrimitive() override;
     bool created() const override;
+    bool canReuseInferredShapes() const override {
+        return true;
+    }
     bool canBeInPlace() const override {
         return false;
     }
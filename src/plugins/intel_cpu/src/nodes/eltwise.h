@@ -39,6 +39,9 @@ public:
     void selectOptimalPrimitiveDescriptor() override;
     void execute(const dnnl::stream& strm) override;
     bool created() const override;
+    bool canReuseInferredShapes() const override {
+        return true;
+    }
     bool canBeInPlace() const override;
     bool canFuseConvert(const NodePtr& convertNode);
     bool canFuseParent(const NodePtr& parentNode) const;
@@ -1041,4 +1041,8 @@ DnnlConvolutionPrimitive::DnnlConvolutionPrimitive(const Key& key,
       m_prim(primitive(m_primDesc)),
       m_intermediateReorders(key, m_primDesc, engine) {}
 
+size_t DnnlConvolutionPrimitive::footprint() const {
+    return DnnlExtensionUtils::getPrimitiveMemoryConsumption(m_primDesc);
+}
+
 }  // namespace ov::intel_cpu
@@ -92,6 +92,11 @@ public:
         return m_implType;
     }
 
+    /**
+     * @brief Memory consumed by the primitive, used as the cost of the runtime cache record
+     */
+    [[nodiscard]] size_t footprint() const;
+
     static DnnlMemoryDescPtr makeTransposedWeightDescriptor(const DnnlMemoryDescPtr& srcDesc,
                                                             const DnnlMemoryDescPtr& dstDesc,
                                                             const ConvAttrs& attrs);
@@ -516,6 +516,10 @@ DnnlFCPrimitive::DnnlFCPrimitive(const Key& key,
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
       m_prim(primitive(m_primDesc)) {}
 
+size_t DnnlFCPrimitive::footprint() const {
+    return DnnlExtensionUtils::getPrimitiveMemoryConsumption(m_primDesc);
+}
+
 void DnnlFCPrimitive::execute(const dnnl_primitive_args& primArgs) const {
     m_prim.execute(m_stream, primArgs);
 }
@@ -65,6 +65,11 @@ public:
         return m_implType;
     }
 
+    /**
+     * @brief Memory consumed by the primitive, used as the cost of the runtime cache record
+     */
+    [[nodiscard]] size_t footprint() const;
+
     static DnnlShapeAgnosticDataPtr createShapeAgnosticData(const FCAttrs& attrs,
                                                             const MemoryArgs& memory,
                                                             const ExecutorContext::CPtr& context,
@@ -38,8 +38,10 @@
 #include "nodes/executors/memory_arguments.hpp"
 #include "onednn/iml_type_mapper.h"
 #include "openvino/core/except.hpp"
+#include "openvino/core/parallel.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "thread_pool_imp.hpp"
+#include "utils/debug_capabilities.h"
 #include "utils/general_utils.h"
 
 namespace ov::intel_cpu {
@@ -82,8 +84,13 @@ public:
     InnerProduct& operator=(const InnerProduct&) = delete;
     InnerProduct& operator=(InnerProduct&&) = delete;
 
-    InnerProduct(const dnnl::engine& eng, const std::shared_ptr<ThreadPool>& threadPool, const InnerProductKey& key)
-        : m_stream(make_stream(eng, threadPool)) {
+    InnerProduct(const dnnl::engine& eng,
+                 const std::shared_ptr<ThreadPool>& threadPool,
+                 const InnerProductKey& key,
+                 bool allowEmpty = false)
+        : m_engine(eng),
+          m_threadPool(threadPool),
+          m_stream(make_stream(eng, threadPool)) {
         const auto& src_md = key.src_md;
         const auto& weights_md = key.weights_md;
         auto scale_shape = key.scale_shape;
@@ -122,7 +129,11 @@ public:
                                                                         weights_md,
                                                                         bias_md,
                                                                         m_output_md,
-                                                                        m_attr);
+                                                                        m_attr,
+                                                                        allowEmpty);
+        if (!ip_prim_desc) {
+            return;
+        }
 
         m_impl_type = parse_impl_name(ip_prim_desc.impl_info_str());
         m_wei_md = ip_prim_desc.weights_desc();
@@ -147,21 +158,24 @@ public:
     }
 
     void exec(void* src, void* dst, void* weight, void* bias = nullptr, void* scale = nullptr, void* zp = nullptr) {
-        m_args[DNNL_ARG_SRC].set_data_handle(src);
-        m_args[DNNL_ARG_DST].set_data_handle(dst);
-        m_args[DNNL_ARG_WEIGHTS].set_data_handle(weight);
-        if (bias) {
-            m_args[DNNL_ARG_BIAS].set_data_handle(bias);
-        }
-        if (scale) {
-            m_args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS].set_data_handle(scale);
-        }
-        if (zp) {
-            m_args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS].set_data_handle(zp);
-        }
+        set_data_handles(m_args, src, dst, weight, bias, scale, zp);
         m_prim.execute(m_stream, m_args);
     }
 
+    [[nodiscard]] GemvThreadContext make_thread_context() const {
+        GemvThreadContext ctx{make_stream(m_engine, m_threadPool), {}};
+        for (const auto& [arg, memory] : m_args) {
+            ctx.args.emplace(arg, dnnl::memory(memory.get_desc(), m_engine, DNNL_MEMORY_NONE));
+        }
+        return ctx;
+    }
+
+    // may be called from several threads at once, each one with its own context
+    void exec(GemvThreadContext& ctx, void* src, void* dst, void* weight, void* bias, void* scale, void* zp) const {
+        set_data_handles(ctx.args, src, dst, weight, bias, scale, zp);
+        m_prim.execute(ctx.stream, ctx.args);
+    }
+
     [[nodiscard]] dnnl::memory::desc get_weights_md() const {
         return m_wei_md;
     }
@@ -174,6 +188,9 @@ public:
     [[nodiscard]] impl_desc_type get_impl_type() const {
         return m_impl_type;
     }
+    [[nodiscard]] bool created() const {
+        return static_cast<bool>(m_prim);
+    }
 
 private:
     void init_w_scales(const VectorDims& scale_shape) {
@@ -190,6 +207,27 @@ private:
         m_zp_md = dnnl::memory::desc(zp_dims, data_type, dnnl::memory::format_tag::ba);
     }
 
+    static void set_data_handles(std::unordered_map<int, dnnl::memory>& args,
+                                 void* src,
+                                 void* dst,
+                                 void* weight,
+                                 void* bias,
+                                 void* scale,
+                                 void* zp) {
+        args[DNNL_ARG_SRC].set_data_handle(src);
+        args[DNNL_ARG_DST].set_data_handle(dst);
+        args[DNNL_ARG_WEIGHTS].set_data_handle(weight);
+        if (bias) {
+            args[DNNL_ARG_BIAS].set_data_handle(bias);
+        }
+        if (scale) {
+            args[DNNL_ARG_ATTR_SCALES | DNNL_ARG_WEIGHTS].set_data_handle(scale);
+        }
+        if (zp) {
+            args[DNNL_ARG_ATTR_ZERO_POINTS | DNNL_ARG_WEIGHTS].set_data_handle(zp);
+        }
+    }
+
     static std::unordered_map<int, dnnl::memory> make_args(dnnl::memory& src,
                                                            dnnl::memory& dst,
                                                            dnnl::memory& weight,
@@ -212,6 +250,8 @@ private:
         return args;
     }
 
+    dnnl::engine m_engine;
+    std::shared_ptr<ThreadPool> m_threadPool;
     dnnl::stream m_stream;
     dnnl::primitive m_prim;
     dnnl::memory::desc m_input_md;
@@ -320,21 +360,41 @@ GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor([[maybe_unused]] const Gather
         }
     }
 
-    dnnl::memory::desc src_md({1, K},
-                              DnnlExtensionUtils::ElementTypeToDataType(src_precision),
-                              dnnl::memory::format_tag::ab);
     dnnl::memory::desc weights_md({N, K},
                                   DnnlExtensionUtils::ElementTypeToDataType(weights_precision),
                                   dnnl::memory::format_tag::any);
 
-    InnerProductKey key{src_md, weights_md, makeBiasMd(N, memory.at(ARG_BIAS)), scale_shape, zp_shape};
+    m_biasMd = makeBiasMd(N, memory.at(ARG_BIAS));
+    m_scaleShape = scale_shape;
+    m_zpShape = zp_shape;
+
+    m_gemvImpl = makeInnerProduct(1, src_precision, weights_md);
+    OPENVINO_ASSERT(m_gemvImpl, "Cannot create the GEMV implementation");
+
+    // AMX computes the padded rows almost for free, while without it the padding of a few rows to the GEMM block
+    // costs more than reading the expert weights once per row by GEMV
+    m_minGemmRows = m_bf16AmxMode ? 2 : 8;
+    // GEMM and GEMV share the packed expert weights, so the layout must be supported by both of them. The GEMM
+    // implementations may not accept the layout preferred by GEMV (e.g. for the compressed weights), then GEMV is
+    // created for the layout preferred by GEMM
+    const Dim minGemmM = normalizeM(static_cast<Dim>(m_minGemmRows));
+    auto gemmImpl = makeInnerProduct(minGemmM, src_precision, m_gemvImpl->get_weights_md());
+    if (!gemmImpl) {
+        gemmImpl = makeInnerProduct(minGemmM, src_precision, weights_md);
+        auto gemvImpl = gemmImpl ? makeInnerProduct(1, src_precision, gemmImpl->get_weights_md()) : nullptr;
+        if (gemvImpl) {
+            m_gemvImpl = gemvImpl;
+        } else {
+            gemmImpl = nullptr;
+            DEBUG_LOG("No common weights layout for GEMM and GEMV, all the rows are computed by GEMV");
+        }
+    }
+    m_groupedGemm = gemmImpl != nullptr;
+    m_gemmImpls.emplace(minGemmM, gemmImpl);
 
     const auto& eng = context->getEngine();
     const auto threadPool = context->getThreadPool();
     auto cache = context->getRuntimeCache();
-    std::tie(m_gemvImpl, std::ignore) = cache->getOrCreate(key, [&eng, &threadPool](const InnerProductKey& k) {
-        return std::make_shared<InnerProduct>(eng, threadPool, k);
-    });
 
     // Repack weights: convert from [G, K, N] to [G, (packed_N, K)] format expected by oneDNN
     auto gemvWeightsDesc =
@@ -401,10 +461,6 @@ GatherMatmulDnnlExecutor::GatherMatmulDnnlExecutor([[maybe_unused]] const Gather
 }
 
 bool GatherMatmulDnnlExecutor::update(const MemoryArgs& memory) {
-    if (!m_bf16AmxMode) {
-        return true;
-    }
-
     const auto& srcMem = memory.at(ARG_SRC);
     const auto& srcShape = srcMem->getStaticDims();
     // srcShape is [B, M, K]
@@ -412,59 +468,55 @@ bool GatherMatmulDnnlExecutor::update(const MemoryArgs& memory) {
         // If M is 1, we can skip the temporary buffer and execute GEMV in-place on the src buffer
         return true;
     }
+    // the rows of an expert are gathered to the buffer, so it fits all the rows of the largest possible group
     const Dim M = normalizeM(srcShape[1]);
-    const auto& creatorsMap = BlockedDescCreator::getCommonCreators();
-    const auto srcPrc = srcMem->getDesc().getPrecision();
-
-    const auto& dstMem = memory.at(ARG_DST);
-    const auto& dstShape = dstMem->getStaticDims();
-
-    m_tmpInputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({M, srcShape[2]}));
-    m_tmpOutputDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(srcPrc, Shape({M, dstShape[2]}));
+    const auto elementSize = srcMem->getDesc().getPrecision().size();
+    const auto& dstShape = memory.at(ARG_DST)->getStaticDims();
+    m_tmpOutputOffset = rnd_up(M * srcShape[2] * elementSize, 64);
+    const size_t totalSize = m_tmpOutputOffset + M * dstShape[2] * elementSize;
 
-    const size_t srcSize = rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);
-    const size_t totalSize = srcSize + m_tmpOutputDesc->getCurrentMemSize();
+    const auto& creatorsMap = BlockedDescCreator::getCommonCreators();
     auto scratchPadDesc = creatorsMap.at(LayoutType::ncsp)->createSharedDesc(ov::element::u8, Shape({totalSize}));
     m_tmpInpBuffer = m_context->getScratchPad()->createScratchPadMem(scratchPadDesc);
+    return true;
+}
 
-    OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
-
-    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), static_cast<dnnl::memory::dim>(srcShape[2])},
+GatherMatmulDnnlExecutor::InnerProductPtr GatherMatmulDnnlExecutor::makeInnerProduct(
+    Dim M,
+    ov::element::Type srcPrc,
+    const dnnl::memory::desc& weightsMd) {
+    const auto K = weightsMd.get_dims()[1];
+    dnnl::memory::desc src_md({static_cast<dnnl::memory::dim>(M), K},
                               DnnlExtensionUtils::ElementTypeToDataType(srcPrc),
                               dnnl::memory::format_tag::ab);
-    auto weights_md = m_gemvImpl->get_weights_md();
-
-    VectorDims scale_shape{};
-    VectorDims zp_shape{};
-    if (m_scalesMemory) {
-        const auto& fullScaleDims = m_scalesMemory->getStaticDims();
-        if (1 == fullScaleDims.size()) {
-            scale_shape.push_back(fullScaleDims[0]);
-        } else {
-            scale_shape.assign(fullScaleDims.begin() + 1, fullScaleDims.end());
-        }
-    }
-    if (m_zpMemory) {
-        const auto& fullZpDims = m_zpMemory->getStaticDims();
-        if (1 == fullZpDims.size()) {
-            zp_shape.push_back(fullZpDims[0]);
-        } else {
-            zp_shape.assign(fullZpDims.begin() + 1, fullZpDims.end());
-        }
-    }
+    InnerProductKey key{src_md, weightsMd, m_biasMd, m_scaleShape, m_zpShape};
 
-    InnerProductKey key{src_md,
-                        weights_md,
-                        makeBiasMd(static_cast<dnnl::memory::dim>(weights_md.get_dims()[0]), memory.at(ARG_BIAS)),
-                        scale_shape,
-                        zp_shape};
     const auto& eng = m_context->getEngine();
     const auto threadPool = m_context->getThreadPool();
     auto cache = m_context->getRuntimeCache();
-    std::tie(m_gemmImpl, std::ignore) = cache->getOrCreate(key, [&eng, &threadPool](const InnerProductKey& k) {
-        return std::make_shared<InnerProduct>(eng, threadPool, k);
-    });
-    return true;
+    InnerProductPtr impl;
+    std::tie(impl, std::ignore) =
+        cache->getOrCreate(key, [&eng, &threadPool](const InnerProductKey& k) -> InnerProductPtr {
+            auto impl = std::make_shared<InnerProduct>(eng, threadPool, k, true);
+            return impl->created() ? impl : nullptr;
+        });
+    return impl;
+}
+
+GatherMatmulDnnlExecutor::InnerProductPtr GatherMatmulDnnlExecutor::getGemmImpl(Dim M, ov::element::Type srcPrc) {
+    if (!m_groupedGemm) {
+        return nullptr;
+    }
+    if (auto it = m_gemmImpls.find(M); it != m_gemmImpls.end()) {
+        return it->second;
+    }
+    auto gemmImpl = makeInnerProduct(M, srcPrc, m_gemvImpl->get_weights_md());
+    if (!gemmImpl) {
+        // the layout is checked for the smallest bucket, the rows of the larger ones are unlikely to get here
+        DEBUG_LOG("GEMM for ", M, " rows does not support the weights layout, the rows are computed by GEMV");
+    }
+    m_gemmImpls.emplace(M, gemmImpl);
+    return gemmImpl;
 }
 
 void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
@@ -506,84 +558,72 @@ void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
             }
         }
 
-        if (m_bf16AmxMode) {
-            OPENVINO_ASSERT(m_tmpInpBuffer, "Temporary input/output memory is not created");
-            OPENVINO_ASSERT(m_tmpInputDesc, "Temporary input memory desc is not created");
-            OPENVINO_ASSERT(m_tmpOutputDesc, "Temporary output memory desc is not created");
-
-            const auto element_size = m_tmpInputDesc->getPrecision().size();
-            const auto K_size = m_tmpInputDesc->getShape().getStaticDims()[1];
-            const auto M_size = m_tmpInputDesc->getShape().getStaticDims()[0];
-            const auto N_size = dstMem->getStaticDims()[2];
-
-            auto* input_ptr = m_tmpInpBuffer->getDataAs<uint8_t>();
-            auto* output_ptr = input_ptr + rnd_up(m_tmpInputDesc->getCurrentMemSize(), 64);
-
-            Memory tmpInput(m_context->getEngine(), m_tmpInputDesc, input_ptr);
-            Memory tmpOutput(m_context->getEngine(), m_tmpOutputDesc, output_ptr);
-
-            auto tmp_input_offset = OffsetHelper::createOffsetHelper(tmpInput);
-            auto tmp_dst_offset = OffsetHelper::createOffsetHelper(tmpOutput);
-
-            OPENVINO_ASSERT(m_gemmImpl, "GEMM implementation is not created");
-            for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                const size_t num_valid_rows = elements_per_gather_indx[gather_axis_index];
-                if (0 == num_valid_rows) {
-                    continue;
-                }
-
-                cpu_parallel->parallel_for(M_size, [&](size_t m) {
-                    auto* dst_row = tmp_input_offset(m);
-                    if (m < num_valid_rows) {
-                        const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                        const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                        const auto* src_data = src_offset(batch_index, row_id);
-                        std::memcpy(dst_row, src_data, K_size * element_size);
-                    } else {
-                        std::memset(dst_row, 0, K_size * element_size);
-                    }
-                });
-
-                auto* src = tmp_input_offset.get_base();
-                auto* dst = tmp_dst_offset.get_base();
-                auto* wei = wei_offset(gather_axis_index);
-                auto* bias = bias_offset(gather_axis_index);
-                auto* scale = scale_offset(gather_axis_index);
-                auto* zp = zp_offset(gather_axis_index);
-                m_gemmImpl->exec(src, dst, wei, bias, scale, zp);
-
-                cpu_parallel->parallel_for(num_valid_rows, [&](size_t m) {
-                    const auto* src_row = tmp_dst_offset(m);
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                    auto* dst_row = dst_offset(batch_index, row_id);
-                    std::memcpy(dst_row, src_row, N_size * element_size);
-                });
+        OPENVINO_ASSERT(m_tmpInpBuffer, "Temporary input/output memory is not created");
+        OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
+        const auto srcPrc = srcMem->getDesc().getPrecision();
+        const auto element_size = srcPrc.size();
+        const auto K_size = srcMem->getStaticDims()[2];
+        const auto N_size = dstMem->getStaticDims()[2];
+        auto* input_ptr = m_tmpInpBuffer->getDataAs<uint8_t>();
+        auto* output_ptr = input_ptr + m_tmpOutputOffset;
+        // the rows of the experts with too few rows for GEMM, computed by GEMV
+        std::vector<GemvRow> gemv_rows;
+
+        for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
+            const int32_t num_valid_rows = elements_per_gather_indx[gather_axis_index];
+            if (0 == num_valid_rows) {
+                continue;
             }
-        } else {
-            OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
-            for (size_t gather_axis_index = 0; gather_axis_index < gather_axis_size; gather_axis_index++) {
-                if (0 == elements_per_gather_indx[gather_axis_index]) {
-                    continue;
-                }
-                auto* wei = wei_offset(gather_axis_index);
-                auto* bias = bias_offset(gather_axis_index);
-                auto* scale = scale_offset(gather_axis_index);
-                auto* zp = zp_offset(gather_axis_index);
-                for (int32_t m = 0; m < elements_per_gather_indx[gather_axis_index]; ++m) {
-                    const auto row_id = gather_idx_map[gather_axis_index * M + m].first;
-                    const auto batch_index = gather_idx_map[gather_axis_index * M + m].second;
-                    auto* src = src_offset(batch_index, row_id);
-                    auto* dst = dst_offset(batch_index, row_id);
-                    m_gemvImpl->exec(src, dst, wei, bias, scale, zp);
+            auto* wei = wei_offset(gather_axis_index);
+            auto* bias = bias_offset(gather_axis_index);
+            auto* scale = scale_offset(gather_axis_index);
+            auto* zp = zp_offset(gather_axis_index);
+            const auto* rows = &gather_idx_map[gather_axis_index * M];
+
+            // the rows routed to the expert are grouped into one GEMM over the expert weights, which is sized by
+            // the number of the rows of the expert rather than by the number of all the rows
+            const Dim M_size = normalizeM(num_valid_rows);
+            const auto gemmImpl = num_valid_rows >= m_minGemmRows ? getGemmImpl(M_size, srcPrc) : nullptr;
+            if (!gemmImpl) {
+                for (int32_t m = 0; m < num_valid_rows; ++m) {
+                    const auto [row_id, batch_index] = rows[m];
+                    gemv_rows.push_back({src_offset(batch_index, row_id),
+                                         dst_offset(batch_index, row_id),
+                                         wei,
+                                         bias,
+                                         scale,
+                                         zp});
                 }
+                continue;
             }
+
+            cpu_parallel->parallel_for(M_size, [&](size_t m) {
+                auto* dst_row = input_ptr + m * K_size * element_size;
+                if (m < static_cast<size_t>(num_valid_rows)) {
+                    const auto [row_id, batch_index] = rows[m];
+                    std::memcpy(dst_row, src_offset(batch_index, row_id), K_size * element_size);
+                } else {
+                    std::memset(dst_row, 0, K_size * element_size);
+                }
+            });
+
+            gemmImpl->exec(input_ptr, output_ptr, wei, bias, scale, zp);
+
+            cpu_parallel->parallel_for(num_valid_rows, [&](size_t m) {
+                const auto [row_id, batch_index] = rows[m];
+                std::memcpy(dst_offset(batch_index, row_id),
+                            output_ptr + m * N_size * element_size,
+                            N_size * element_size);
+            });
         }
+        execGemvRows(gemv_rows);
     } else {
         OPENVINO_ASSERT(m_gemvImpl, "GEMV implementation is not created");
 
         constexpr size_t m = 0;
         auto* gather_ids = static_cast<int32_t*>(index_offset(m));
+        std::vector<GemvRow> gemv_rows;
+        gemv_rows.reserve(indices_size);
         for (size_t i = 0; i < indices_size; i++) {
             int32_t gather_axis_index = gather_ids[i];
             OPENVINO_ASSERT(gather_axis_index >= 0 && static_cast<size_t>(gather_axis_index) < gather_axis_size,
@@ -591,19 +631,42 @@ void GatherMatmulDnnlExecutor::execute(const MemoryArgs& memory) {
                             gather_axis_index,
                             " for i ",
                             i);
-            auto* src = src_offset(i, m);
-            auto* dst = dst_offset(i, m);
-            auto* wei = wei_offset(gather_axis_index);
-            auto* bias = bias_offset(gather_axis_index);
-            auto* scale = scale_offset(gather_axis_index);
-            auto* zp = zp_offset(gather_axis_index);
-            m_gemvImpl->exec(src, dst, wei, bias, scale, zp);
+            gemv_rows.push_back({src_offset(i, m),
+                                 dst_offset(i, m),
+                                 wei_offset(gather_axis_index),
+                                 bias_offset(gather_axis_index),
+                                 scale_offset(gather_axis_index),
+                                 zp_offset(gather_axis_index)});
         }
+        execGemvRows(gemv_rows);
+    }
+}
+
+void GatherMatmulDnnlExecutor::execGemvRows(const std::vector<GemvRow>& rows) {
+    if (rows.size() == 1) {
+        const auto& row = rows.front();
+        m_gemvImpl->exec(row.src, row.dst, row.wei, row.bias, row.scale, row.zp);
+        return;
+    }
+    // a GEMV over the weights of a small expert does not occupy all the cores, so the rows of the different experts
+    // are computed concurrently, the nested oneDNN calls take the cores left idle
+    const auto threadsNum = static_cast<size_t>(parallel_get_max_threads());
+    while (m_gemvThreadContexts.size() < threadsNum) {
+        m_gemvThreadContexts.push_back(m_gemvImpl->make_thread_context());
     }
+    m_context->getCpuParallel()->parallel_for(rows.size(), [&](size_t i) {
+        const auto& row = rows[i];
+        auto& ctx = m_gemvThreadContexts[parallel_get_thread_num()];
+        m_gemvImpl->exec(ctx, row.src, row.dst, row.wei, row.bias, row.scale, row.zp);
+    });
 }
 
 impl_desc_type GatherMatmulDnnlExecutor::implType() const {
     return m_implType;
 }
 
+bool GatherMatmulDnnlExecutor::groupedGemm() const {
+    return m_groupedGemm;
+}
+
 }  // namespace ov::intel_cpu
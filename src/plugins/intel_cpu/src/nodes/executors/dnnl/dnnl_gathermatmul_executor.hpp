@@ -4,15 +4,21 @@
 
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <oneapi/dnnl/dnnl.hpp>
+#include <unordered_map>
+#include <vector>
 
 #include "cpu_memory.h"
+#include "cpu_types.h"
 #include "memory_desc/cpu_memory_desc.h"
 #include "nodes/executors/executor.hpp"
 #include "nodes/executors/gathermatmul_config.hpp"
 #include "nodes/executors/memory_arguments.hpp"
 #include "onednn/iml_type_mapper.h"
+#include "openvino/core/type/element_type.hpp"
 
 namespace ov::intel_cpu {
 
@@ -27,6 +33,8 @@ public:
     bool update(const MemoryArgs& memory) override;
     void execute(const MemoryArgs& memory) override;
     [[nodiscard]] impl_desc_type implType() const override;
+    // whether the rows routed to an expert are computed by one GEMM, otherwise every row is computed by GEMV
+    [[nodiscard]] bool groupedGemm() const;
 
 private:
     class InnerProduct;
@@ -38,14 +46,43 @@ private:
     MemoryPtr m_scalesMemory;
     MemoryPtr m_zpMemory;
 
+    // nullptr if the configuration is not supported
+    InnerProductPtr makeInnerProduct(Dim M, ov::element::Type srcPrc, const dnnl::memory::desc& weightsMd);
+    InnerProductPtr getGemmImpl(Dim M, ov::element::Type srcPrc);
+
+    // the pointers to the data of one row computed by GEMV
+    struct GemvRow {
+        void* src;
+        void* dst;
+        void* wei;
+        void* bias;
+        void* scale;
+        void* zp;
+    };
+    void execGemvRows(const std::vector<GemvRow>& rows);
+
+    // the stream and the arguments of a thread computing the GEMV rows, reused by the executions
+    struct GemvThreadContext {
+        dnnl::stream stream;
+        std::unordered_map<int, dnnl::memory> args;
+    };
+    std::vector<GemvThreadContext> m_gemvThreadContexts;
+
     InnerProductPtr m_gemvImpl;
-    InnerProductPtr m_gemmImpl;
+    // GEMM implementations by the number of the (padded) rows routed to an expert, nullptr if not supported
+    std::unordered_map<Dim, InnerProductPtr> m_gemmImpls;
+    dnnl::memory::desc m_biasMd;
+    VectorDims m_scaleShape;
+    VectorDims m_zpShape;
 
+    // the rows of an expert gathered for GEMM followed by the GEMM output
     MemoryPtr m_tmpInpBuffer;
-    MemoryDescPtr m_tmpInputDesc;
-    MemoryDescPtr m_tmpOutputDesc;
+    size_t m_tmpOutputOffset = 0;
 
     bool m_bf16AmxMode = false;
+    // the experts with fewer rows are computed by GEMV
+    int32_t m_minGemmRows = 0;
+    bool m_groupedGemm = false;
     impl_desc_type m_implType = impl_desc_type::unknown;
 };
 
@@ -629,6 +629,10 @@ DnnlMatMulPrimitive::DnnlMatMulPrimitive(const Key& key,
       m_scratchPadDesc(DnnlExtensionUtils::makeDescriptor(m_primDesc.scratchpad_desc())),
       m_prim(primitive(m_primDesc)) {}
 
+size_t DnnlMatMulPrimitive::footprint() const {
+    return DnnlExtensionUtils::getPrimitiveMemoryConsumption(m_primDesc);
+}
+
 void DnnlMatMulPrimitive::execute(const dnnl_primitive_args& primArgs) const {
     m_prim.execute(m_stream, primArgs);
 }
@@ -68,6 +68,11 @@ public:
         return m_implType;
     }
 
+    /**
+     * @brief Memory consumed by the primitive, used as the cost of the runtime cache record
+     */
+    [[nodiscard]] size_t footprint() const;
+
     static bool useWeightsDecompressionImpl(ov::element::Type inputType, ov::element::Type weightsType);
 
     static DnnlShapeAgnosticDataPtr createShapeAgnosticData(const MatMulAttrs& attrs,
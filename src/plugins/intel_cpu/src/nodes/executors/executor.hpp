@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include <algorithm>
 #include <cassert>
 #include <cstdint>
 #include <memory>
@@ -14,6 +13,7 @@
 #include <utility>
 #include <vector>
 
+#include "cache/jit_kernel_store.h"
 #include "cache/multi_cache.h"
 #include "cpu_memory.h"
 #include "dnnl_scratch_pad.h"
@@ -55,16 +55,14 @@ public:
                     std::vector<impl_desc_type> implPriorities,
                     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache = nullptr)
         : runtimeCache(graphContext->getParamsCache()),
-          scratchPads(graphContext->getScratchPads()),
+          graphContext(graphContext),
           weightsCache(graphContext->getWeightsCache()),
           engine(graphContext->getEngine()),
           implPriorities(std::move(implPriorities)),
           privateWeighCache(std::move(privateWeighCache)),
           numNumaNodes(graphContext->getNumNumaNodes()),
-          cpuParallel(graphContext->getCpuParallel()) {
-        auto cpuStreamsExecutor = graphContext->getCPUStreamExecutor();
-        curNumaNodeId = std::max(0, cpuStreamsExecutor ? cpuStreamsExecutor->get_numa_node_id() : curNumaNodeId);
-    }
+          cpuParallel(graphContext->getCpuParallel()),
+          jitKernelStore(graphContext->getJitKernelStore()) {}
 
     [[nodiscard]] MultiCachePtr getRuntimeCache() const {
         auto runtimeCachePtr = runtimeCache.lock();
@@ -73,7 +71,10 @@ public:
     }
 
     [[nodiscard]] DnnlScratchPadPtr getScratchPad() const {
-        return scratchPads[curNumaNodeId];
+        // the graph context decides whether the node may share the scratch pad with the others
+        auto graphContextPtr = graphContext.lock();
+        OPENVINO_ASSERT(graphContextPtr, "The graph context of the executor is destroyed");
+        return graphContextPtr->getScratchPad();
     }
 
     [[nodiscard]] std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> getPrivateWeightCache() const {
@@ -100,19 +101,23 @@ public:
         return cpuParallel->get_thread_pool();
     }
 
+    [[nodiscard]] const JitKernelStore::Ptr& getJitKernelStore() const {
+        return jitKernelStore;
+    }
+
 private:
     // weak_ptr is required to avoid cycle dependencies with MultiCache
     // since ExecutorContext is stored in Executor itself
     MultiCacheWeakPtr runtimeCache;
-    std::vector<DnnlScratchPadPtr> scratchPads;
+    std::weak_ptr<const GraphContext> graphContext;
     WeightsSharing::Ptr weightsCache;
     const dnnl::engine& engine;
     std::vector<impl_desc_type> implPriorities;
     // @todo remove after global cache is used exclusevly
     std::shared_ptr<std::unordered_map<std::string, MemoryPtr>> privateWeighCache;
     int numNumaNodes;
-    int curNumaNodeId = -1;
     std::shared_ptr<CpuParallel> cpuParallel;
+    JitKernelStore::Ptr jitKernelStore;
 };
 
 class ExecutorFactoryLegacy {
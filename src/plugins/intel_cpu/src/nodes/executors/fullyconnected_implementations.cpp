@@ -40,6 +40,7 @@
 #    include "memory_desc/cpu_memory_desc_utils.h"
 #    include "memory_desc/dnnl_memory_desc.h"
 #    include "nodes/executors/dnnl/dnnl_convolution_primitive.hpp"
+#    include "nodes/executors/x64/dyn_quant_fc.hpp"
 #    include "onednn/iml_type_mapper.h"
 #endif
 
@@ -214,6 +215,22 @@ const std::vector<ExecutorImplementation<FCAttrs>>& getImplementations() {
             AcceptsAnyShape<FCAttrs>,
             CreateDefault<MlasGemmExecutor, FCAttrs>{}
             )
+        OV_CPU_INSTANCE_X64(
+            "fullyconnected_dyn_quant_x64",
+            ExecutorType::Jit,
+            OperationType::FullyConnected,
+            // supports
+            [](const FCConfig& config) -> bool {
+                VERIFY(DynQuantFCExecutor::supports(config), UNSUPPORTED_BY_EXECUTOR);
+                return true;
+            },
+            HasNoOptimalConfig<FCAttrs>{},
+            // acceptsShapes
+            [](const FCAttrs& attrs, const MemoryArgs& memory) -> bool {
+                return DynQuantFCExecutor::acceptsShapes(attrs, memory);
+            },
+            CreateDefault<DynQuantFCExecutor, FCAttrs>{}
+            )
         OV_CPU_INSTANCE_X64(
             "convolution_1x1_dnnl",
             ExecutorType::Dnnl,
@@ -9,9 +9,11 @@
 #include <cstddef>
 #include <iterator>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
+#include "cache/jit_kernel_store.h"
 #include "cpu_parallel.hpp"
 #include "cpu_types.h"
 #include "memory_desc/blocked_memory_desc.h"
@@ -33,6 +35,7 @@ using namespace dnnl::impl::cpu;
 #    include <cpu/x64/cpu_isa_traits.hpp>
 
 #    include "nodes/kernels/x64/jit_uni_eltwise_generic.hpp"
+#    include "utils/cpu_utils.hpp"
 using namespace ov::intel_cpu::x64;
 using namespace dnnl::impl::cpu::x64;
 #endif
@@ -55,7 +58,55 @@ using namespace ov::intel_cpu::riscv64;
 
 namespace ov::intel_cpu {
 
-EltwiseJitExecutor::EltwiseJitExecutor(const Key& key)
+#if defined(OPENVINO_ARCH_X86_64)
+namespace {
+
+// serialized parameters which fully define the code of the kernel without post ops
+std::string kernelStoreKey(const jit_eltwise_params& jep,
+                           const std::vector<EltwiseData>& eltwiseData,
+                           const std::vector<Type>& opsList) {
+    std::string key = "jit_uni_eltwise_generic";
+    auto put = [&key](const auto& value) {
+        key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto putDims = [&put](const VectorDims& dims) {
+        put(dims.size());
+        std::for_each(dims.begin(), dims.end(), put);
+    };
+
+    put(jep.inputs_number);
+    put(jep.input_size);
+    for (size_t i = 0; i < MAX_ELTWISE_INPUTS; i++) {
+        put(static_cast<ov::element::Type_t>(jep.src_prc[i]));
+        putDims(jep.src_offsets[i]);
+        put(jep.src_size[i]);
+    }
+    put(static_cast<ov::element::Type_t>(jep.dst_prc));
+    putDims(jep.dims);
+    putDims(jep.dst_offsets);
+    putDims(jep.oc_offsets);
+    put(jep.dst_size);
+    put(jep.oc_size);
+    put(jep.work_amount);
+    put(jep.use_runtime_ptrs);
+
+    put(eltwiseData.size());
+    for (const auto& data : eltwiseData) {
+        put(data.algo);
+        put(data.onednnAlgorithm);
+        put(data.alpha);
+        put(data.beta);
+        put(data.gamma);
+    }
+    put(opsList.size());
+    std::for_each(opsList.begin(), opsList.end(), put);
+    return key;
+}
+
+}  // namespace
+#endif
+
+EltwiseJitExecutor::EltwiseJitExecutor(const Key& key, [[maybe_unused]] const JitKernelStore::Ptr& kernelStore)
     : m_useRuntimePtrs(key.implType == EltwiseImplType::optimizedShapeAgnostic) {
     const auto& outBlkDims = key.outBlkDims;
     const auto& outOrder = key.outOrder;
@@ -278,23 +329,48 @@ EltwiseJitExecutor::EltwiseJitExecutor(const Key& key)
     });
 
 #if defined(OPENVINO_ARCH_X86_64)
-    if (mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
-        m_kernel = std::make_unique<jit_uni_eltwise_generic<dnnl::impl::cpu::x64::avx512_core>>(jep,
-                                                                                                key.eltwise_data,
-                                                                                                key.ops_list,
-                                                                                                key.postOps);
-    } else if (mayiuse(dnnl::impl::cpu::x64::avx2)) {
-        m_kernel = std::make_unique<jit_uni_eltwise_generic<dnnl::impl::cpu::x64::avx2>>(jep,
+    auto makeKernel = [&]() -> std::unique_ptr<jit_uni_eltwise_kernel> {
+        if (mayiuse(dnnl::impl::cpu::x64::avx512_core)) {
+            return std::make_unique<jit_uni_eltwise_generic<dnnl::impl::cpu::x64::avx512_core>>(jep,
+                                                                                               key.eltwise_data,
+                                                                                               key.ops_list,
+                                                                                               key.postOps);
+        }
+        if (mayiuse(dnnl::impl::cpu::x64::avx2)) {
+            return std::make_unique<jit_uni_eltwise_generic<dnnl::impl::cpu::x64::avx2>>(jep,
+                                                                                        key.eltwise_data,
+                                                                                        key.ops_list,
+                                                                                        key.postOps);
+        }
+        if (mayiuse(dnnl::impl::cpu::x64::sse41)) {
+            return std::make_unique<jit_uni_eltwise_generic<dnnl::impl::cpu::x64::sse41>>(jep,
                                                                                          key.eltwise_data,
                                                                                          key.ops_list,
                                                                                          key.postOps);
-    } else if (mayiuse(dnnl::impl::cpu::x64::sse41)) {
-        m_kernel = std::make_unique<jit_uni_eltwise_generic<dnnl::impl::cpu::x64::sse41>>(jep,
-                                                                                          key.eltwise_data,
-                                                                                          key.ops_list,
-                                                                                          key.postOps);
-    } else {
+        }
         OPENVINO_THROW("Can't create jit eltwise kernel");
+    };
+    m_kernel = makeKernel();
+
+    // the post ops may refer to the data of the nodes, so only the kernels without post ops are persisted
+    if (kernelStore && key.postOps.len() == 0) {
+        const auto storeKey = kernelStoreKey(jep, key.eltwise_data, key.ops_list);
+        m_storedCode = kernelStore->load(storeKey);
+        if (m_storedCode) {
+            m_kernel->ker_ = jit_kernel_cast<decltype(m_kernel->ker_)>(m_storedCode->get());
+            return;
+        }
+        m_kernel->create_ker();
+        // the second copy is needed to prove the code is position independent, e.g. it has no rel32 displacements
+        // of the calls to the functions outside the code
+        auto sameKernel = makeKernel();
+        sameKernel->create_ker();
+        const auto* generator = dynamic_cast<const dnnl::impl::cpu::x64::jit_generator_t*>(m_kernel.get());
+        const auto* sameGenerator = dynamic_cast<const dnnl::impl::cpu::x64::jit_generator_t*>(sameKernel.get());
+        if (generator && sameGenerator && generator->getSize() == sameGenerator->getSize()) {
+            kernelStore->store(storeKey, generator->jit_ker(), sameGenerator->jit_ker(), generator->getSize());
+        }
+        return;
     }
 #endif
 
@@ -609,7 +685,7 @@ std::shared_ptr<EltwiseJitExecutor> EltwiseJitExecutor::create(const MemoryArgs&
                implType};
 
     auto builder = [&](const Key& key) {
-        return std::make_shared<EltwiseJitExecutor>(key);
+        return std::make_shared<EltwiseJitExecutor>(key, context->getJitKernelStore());
     };
 
     auto runtimeCache = context->getRuntimeCache();
@@ -11,6 +11,7 @@
 #include <oneapi/dnnl/dnnl.hpp>
 #include <vector>
 
+#include "cache/jit_kernel_store.h"
 #include "common/primitive_attr.hpp"
 #include "common/primitive_hashing_utils.hpp"
 #include "cpu_types.h"
@@ -111,7 +112,10 @@ class EltwiseJitExecutor : public IEltwiseExecutor {
     };
 
 public:
-    EltwiseJitExecutor(const Key& key);
+    /**
+     * @param kernelStore persistent store to load the kernel code from (or to save the generated one to), may be null
+     */
+    EltwiseJitExecutor(const Key& key, const JitKernelStore::Ptr& kernelStore = nullptr);
 
     void exec(const jit_eltwise_call_args_ptrs& args_ptrs,
               const VectorDims& dims_out,
@@ -153,6 +157,8 @@ private:
 
     bool m_useRuntimePtrs = false;
 
+    // the kernel code loaded from the persistent store, if any
+    JitExecutableCodePtr m_storedCode;
     std::unique_ptr<jit_uni_eltwise_kernel> m_kernel;
     size_t m_schedulerWorkAmount = 0;
     size_t m_batchDimIdx = 0;
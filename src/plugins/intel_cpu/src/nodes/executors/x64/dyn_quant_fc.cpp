@@ -0,0 +1,287 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/executors/x64/dyn_quant_fc.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "cpu/x64/cpu_isa_traits.hpp"
+#include "cpu_memory.h"
+#include "cpu_parallel.hpp"
+#include "cpu_types.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "nodes/common/cpu_convert.h"
+#include "nodes/executors/debug_messages.hpp"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/implementation_utils.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "nodes/kernels/x64/dyn_quant_fc.hpp"
+#include "onednn/iml_type_mapper.h"
+#include "openvino/core/type/element_type.hpp"
+#include "utils/debug_capabilities.h"
+#include "utils/general_utils.h"
+
+using namespace dnnl::impl::cpu::x64;
+
+namespace ov::intel_cpu {
+
+using namespace ov::element;
+
+namespace {
+
+// the number of the output channels computed by a task
+constexpr size_t N_BLOCK = 32;
+// the kernels process the activation groups by the chunks of 32 values
+constexpr size_t K_CHUNK = 32;
+
+MemoryCPtr getOptional(const MemoryArgs& memory, int arg) {
+    auto it = memory.find(arg);
+    if (it == memory.end() || it->second->getDesc().empty()) {
+        return nullptr;
+    }
+    return it->second;
+}
+
+// the weights zero point introduced by the conversion of the signed weights to the unsigned ones
+float signedWeightsShift(const ov::element::Type& precision) {
+    if (precision == i8) {
+        return 128.0F;
+    }
+    if (precision == i4) {
+        return 8.0F;
+    }
+    return 0.0F;
+}
+
+// converts the signed weights to the unsigned ones and repacks the 4-bit weights to the layout of the kernel:
+// the low nibbles of 16 bytes hold the first 16 elements of a chunk and the high nibbles hold the other 16 ones
+MemoryCPtr prepareWeights(const MemoryCPtr& weights, const ExecutorContext::CPtr& context) {
+    const auto precision = weights->getPrecision();
+    const auto& dims = weights->getStaticDims();
+    const size_t N = dims[0];
+    const size_t K = dims[1];
+    const bool is4bit = any_of(precision, u4, i4);
+    const size_t rowBytes = is4bit ? K / 2 : K;
+
+    auto create = [&]() {
+        DEBUG_LOG("DynQuantFCExecutor: cache miss, perform packing");
+        MemoryPtr packed = std::make_shared<Memory>(context->getEngine(),
+                                                    CpuBlockedMemoryDesc(u8, intel_cpu::Shape{N * rowBytes}));
+        const auto* src = weights->getDataAs<const uint8_t>();
+        auto* dst = packed->getDataAs<uint8_t>();
+        const uint8_t flip = precision == i8 ? 0x80 : (precision == i4 ? 0x08 : 0x00);
+        context->getCpuParallel()->parallel_for(N, [&](size_t n) {
+            const auto* srcRow = src + n * rowBytes;
+            auto* dstRow = dst + n * rowBytes;
+            if (!is4bit) {
+                for (size_t k = 0; k < K; k++) {
+                    dstRow[k] = srcRow[k] ^ flip;
+                }
+                return;
+            }
+            auto nibble = [&](size_t k) {
+                const auto byte = srcRow[k / 2];
+                return static_cast<uint8_t>((((k % 2) != 0U ? byte >> 4 : byte) & 0x0F) ^ flip);
+            };
+            for (size_t k = 0; k < K; k += K_CHUNK) {
+                for (size_t j = 0; j < K_CHUNK / 2; j++) {
+                    dstRow[k / 2 + j] = nibble(k + j) | static_cast<uint8_t>(nibble(k + K_CHUNK / 2 + j) << 4);
+                }
+            }
+        });
+        return packed;
+    };
+
+    auto weightCache = context->getWeightsCache();
+    if (weightCache != nullptr) {
+        const std::string string_hash = "fc_dyn_quant_" + std::to_string(N) + "_" + std::to_string(K) + "_" +
+                                        precision.to_string() + "_" + std::to_string(weights->getSize()) + "_" +
+                                        std::to_string(reinterpret_cast<uint64_t>(weights->getData()));
+        DEBUG_LOG("DynQuantFCExecutor: findOrCreate, string_hash: ", string_hash);
+        return MemoryPtr(*weightCache->findOrCreate(string_hash, create));
+    }
+
+    DEBUG_LOG("DynQuantFCExecutor: Weights cache is not available");
+    return create();
+}
+
+// the scales and the zero points are [N, G], [N, 1] or [1] for the transposed weights
+std::pair<size_t, size_t> decompressionDims(const MemoryCPtr& mem) {
+    const auto& dims = mem->getStaticDims();
+    const auto elements = std::accumulate(dims.begin(), dims.end(), size_t{1}, std::multiplies<>());
+    const size_t channels = dims.empty() ? 1 : dims[0];
+    return {channels, elements / channels};
+}
+
+bool decompressionGroupsMatch(const MemoryCPtr& mem, size_t N, size_t K, size_t groupSize) {
+    if (!mem) {
+        return true;
+    }
+    const auto [channels, groups] = decompressionDims(mem);
+    if (none_of(channels, 1U, N) || K % groups != 0) {
+        return false;
+    }
+    return groups == 1 || (K / groups) % groupSize == 0;
+}
+
+// expands the decompression parameters to f32 [N, K / groupSize], the shift is added to the values
+std::vector<float> expandDecompressionParams(const MemoryCPtr& mem,
+                                             size_t N,
+                                             size_t K,
+                                             size_t groupSize,
+                                             float defaultValue,
+                                             float shift) {
+    const size_t groups = K / groupSize;
+    if (!mem) {
+        return std::vector<float>(N * groups, defaultValue + shift);
+    }
+    std::vector<float> expanded(N * groups, shift);
+    const auto [channels, srcGroups] = decompressionDims(mem);
+    std::vector<float> values(channels * srcGroups);
+    cpu_convert(mem->getData(), values.data(), mem->getPrecision(), f32, values.size());
+    const size_t srcGroupSize = K / srcGroups;
+    for (size_t n = 0; n < N; n++) {
+        const auto* row = values.data() + (channels == 1 ? 0 : n) * srcGroups;
+        for (size_t g = 0; g < groups; g++) {
+            expanded[n * groups + g] += row[srcGroups == 1 ? 0 : g * groupSize / srcGroupSize];
+        }
+    }
+    return expanded;
+}
+
+}  // namespace
+
+bool DynQuantFCExecutor::supports(const FCConfig& config) {
+    VERIFY(mayiuse(avx2), UNSUPPORTED_ISA);
+    // the VNNI capable cores are served by the oneDNN dynamic quantization
+    VERIFY(!mayiuse(avx2_vnni) && !mayiuse(avx512_core_vnni), UNSUPPORTED_ISA);
+    const auto groupSize = config.attrs.dynamicQuantizationGroupSize;
+    VERIFY(groupSize != 0 && groupSize % K_CHUNK == 0, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(srcType(config) == f32, UNSUPPORTED_SRC_PRECISIONS);
+    VERIFY(any_of(weiType(config), u8, i8, u4, i4), UNSUPPORTED_WEI_PRECISIONS);
+    VERIFY(config.descs.at(ARG_BIAS)->empty() || biaType(config) == f32, UNSUPPORTED_BIAS_PRECISIONS);
+    VERIFY(dstType(config) == f32, UNSUPPORTED_DST_PRECISIONS);
+    VERIFY(weiRank(config) == 2U, UNSUPPORTED_WEI_RANK);
+    VERIFY(config.attrs.postOps.empty(), UNSUPPORTED_POST_OPS);
+    VERIFY(config.attrs.dqScales.empty(), UNSUPPORTED_PER_CHANNEL_QUANTIZATION);
+    VERIFY(!config.attrs.sparseWeights, UNSUPPORTED_SPARSE_WEIGHTS);
+    VERIFY(!config.attrs.weightsNonTransposed, UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(config.attrs.constantWeights, UNSUPPORTED_BY_EXECUTOR);
+    return true;
+}
+
+bool DynQuantFCExecutor::acceptsShapes(const FCAttrs& attrs, const MemoryArgs& memory) {
+    const auto& dstDims = memory.at(ARG_DST)->getShape().getDims();
+    const auto M = std::accumulate(dstDims.begin(), dstDims.end() - 1, Dim{1}, std::multiplies<>());
+    VERIFY(M <= maxBatch, HEURISTICS_MISMATCH);
+
+    const auto& weiDims = memory.at(ARG_WEI)->getShape().getDims();
+    const size_t N = weiDims[0];
+    const size_t K = weiDims[1];
+    const auto groupSize = attrs.dynamicQuantizationGroupSize;
+    VERIFY(K % groupSize == 0, UNSUPPORTED_BY_EXECUTOR);
+
+    const auto scales = getOptional(memory, ARG_WEI | ARG_ATTR_SCALES);
+    const auto zeroPoints = getOptional(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS);
+    VERIFY(decompressionGroupsMatch(scales, N, K, groupSize), UNSUPPORTED_BY_EXECUTOR);
+    VERIFY(decompressionGroupsMatch(zeroPoints, N, K, groupSize), UNSUPPORTED_BY_EXECUTOR);
+    // the signed weights are shifted to the unsigned range, so they are expected to be symmetric
+    VERIFY(!zeroPoints || (any_of(memory.at(ARG_WEI)->getPrecision(), u8, u4) &&
+                           any_of(zeroPoints->getPrecision(), u8, u4)),
+           UNSUPPORTED_BY_EXECUTOR);
+    return true;
+}
+
+DynQuantFCExecutor::DynQuantFCExecutor(const FCAttrs& attrs,
+                                       const MemoryArgs& memory,
+                                       const ExecutorContext::CPtr& context)
+    : m_context(context),
+      m_N(memory.at(ARG_WEI)->getStaticDims()[0]),
+      m_K(memory.at(ARG_WEI)->getStaticDims()[1]),
+      m_groupSize(attrs.dynamicQuantizationGroupSize),
+      m_weightsU4(any_of(memory.at(ARG_WEI)->getPrecision(), u4, i4)),
+      m_packedWeights(prepareWeights(memory.at(ARG_WEI), context)) {
+    m_weightsScales =
+        expandDecompressionParams(getOptional(memory, ARG_WEI | ARG_ATTR_SCALES), m_N, m_K, m_groupSize, 1.0F, 0.0F);
+    m_weightsZeroPoints = expandDecompressionParams(getOptional(memory, ARG_WEI | ARG_ATTR_ZERO_POINTS),
+                                                    m_N,
+                                                    m_K,
+                                                    m_groupSize,
+                                                    0.0F,
+                                                    signedWeightsShift(memory.at(ARG_WEI)->getPrecision()));
+}
+
+bool DynQuantFCExecutor::update(const MemoryArgs& memory) {
+    const auto& dstDims = memory.at(ARG_DST)->getStaticDims();
+    m_M = std::accumulate(dstDims.begin(), dstDims.end() - 1, Dim{1}, std::multiplies<>());
+
+    const size_t groups = m_K / m_groupSize;
+    m_srcQuantized.resize(m_M * m_K);
+    m_srcScales.resize(m_M * groups);
+    m_srcSums.resize(m_M * groups);
+    return true;
+}
+
+void DynQuantFCExecutor::execute(const MemoryArgs& memory) {
+    const auto* src = memory.at(ARG_SRC)->getDataAs<const float>();
+    auto* dst = memory.at(ARG_DST)->getDataAs<float>();
+    const auto& bias = memory.at(ARG_BIAS);
+    const auto* biasData = bias->getDesc().empty() ? nullptr : bias->getDataAs<const float>();
+    const size_t groups = m_K / m_groupSize;
+    const auto& cpuParallel = m_context->getCpuParallel();
+
+    cpuParallel->parallel_for(m_M, [&](size_t m) {
+        ov::Extensions::Cpu::XARCH::dyn_quant_fc_quantize_src(src + m * m_K,
+                                                              m_K,
+                                                              m_srcQuantized.data() + m * m_K,
+                                                              m_srcScales.data() + m * groups,
+                                                              m_srcSums.data() + m * groups,
+                                                              1,
+                                                              m_K,
+                                                              m_groupSize);
+    });
+
+    cpuParallel->parallel_for(div_up(m_N, N_BLOCK), [&](size_t nb) {
+        const size_t nBegin = nb * N_BLOCK;
+        const size_t nEnd = std::min(nBegin + N_BLOCK, m_N);
+        ov::Extensions::Cpu::XARCH::dyn_quant_fc_kernel(m_srcQuantized.data(),
+                                                        m_srcScales.data(),
+                                                        m_srcSums.data(),
+                                                        m_M,
+                                                        m_packedWeights->getDataAs<const uint8_t>(),
+                                                        m_weightsU4,
+                                                        m_weightsScales.data(),
+                                                        m_weightsZeroPoints.data(),
+                                                        biasData,
+                                                        dst,
+                                                        m_N,
+                                                        nBegin,
+                                                        nEnd,
+                                                        m_K,
+                                                        m_groupSize);
+    });
+}
+
+impl_desc_type DynQuantFCExecutor::implType() const {
+    return mayiuse(avx512_core) ? impl_desc_type::jit_avx512 : impl_desc_type::jit_avx2;
+}
+
+void DynQuantFCExecutor::moveMemToNumaNode(int numaNodeID) {
+    if (m_curNumaNode == numaNodeID) {
+        return;
+    }
+    m_curNumaNode = numaNodeID;
+    mbind_move(m_packedWeights, numaNodeID);
+}
+
+}  // namespace ov::intel_cpu
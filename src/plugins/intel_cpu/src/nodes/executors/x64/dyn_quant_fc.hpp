@@ -0,0 +1,64 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "cpu_memory.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/fullyconnected_config.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "onednn/iml_type_mapper.h"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief FullyConnected with the u8/i8/u4/i4 compressed weights and the activations dynamically quantized to i8 per
+ * group of DYNAMIC_QUANTIZATION_GROUP_SIZE columns.
+ *
+ * Targets AVX2 and AVX-512 cores without VNNI (which are served by the oneDNN dynamic quantization) on the small
+ * batch (token generation) shapes, where the integer dot products on the compressed weights are cheaper than the
+ * weights decompression to f32.
+ */
+class DynQuantFCExecutor : public Executor {
+public:
+    DynQuantFCExecutor(const FCAttrs& attrs, const MemoryArgs& memory, const ExecutorContext::CPtr& context);
+
+    void execute(const MemoryArgs& memory) override;
+
+    [[nodiscard]] impl_desc_type implType() const override;
+
+    // offloads execution data preparation from the exec call
+    bool update(const MemoryArgs& memory) override;
+
+    void moveMemToNumaNode(int numaNodeID) override;
+
+    static bool supports(const FCConfig& config);
+
+    static bool acceptsShapes(const FCAttrs& attrs, const MemoryArgs& memory);
+
+    // the larger batches are compute bound and are executed faster by oneDNN
+    static constexpr size_t maxBatch = 16;
+
+private:
+    ExecutorContext::CPtr m_context;
+    size_t m_N;
+    size_t m_K;
+    size_t m_groupSize;
+    size_t m_M = 0;
+    bool m_weightsU4;
+    MemoryCPtr m_packedWeights;
+    // expanded to [N, K / groupSize]
+    std::vector<float> m_weightsScales;
+    std::vector<float> m_weightsZeroPoints;
+    std::vector<int8_t> m_srcQuantized;
+    std::vector<float> m_srcScales;
+    std::vector<int32_t> m_srcSums;
+    int m_curNumaNode = -1;
+};
+
+}  // namespace ov::intel_cpu
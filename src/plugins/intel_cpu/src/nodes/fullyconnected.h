@@ -49,6 +49,9 @@ public:
     void getSupportedDescriptors() override {};
     void execute(const dnnl::stream& strm) override;
     bool created() const override;
+    bool canReuseInferredShapes() const override {
+        return true;
+    }
 
     bool canBeInPlace() const override {
         return false;
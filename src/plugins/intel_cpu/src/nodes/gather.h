@@ -29,6 +29,9 @@ public:
     void createPrimitive() override;
     void execute(const dnnl::stream& strm) override;
     bool created() const override;
+    bool canReuseInferredShapes() const override {
+        return true;
+    }
     bool neverExecute() const override;
     bool isExecutable() const override;
     void resolveInPlaceEdges(Edge::LOOK look) override;
@@ -2,7 +2,9 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 #include <algorithm>
+#include <atomic>
 #include <cfloat>
+#include <chrono>
 #include <cmath>
 #include <cpu/platform.hpp>
 #include <cpu/x64/cpu_isa_traits.hpp>
@@ -1298,6 +1300,10 @@ struct MHAHelper {
     //  output_emb: [L, H * S]
     //  weight: [nthr, H, 32, rnd_up(kv_len, block_size)]
     //  output: [nthr, 32, H, S]
+    // L > 1 is the multi query decode: the L tokens are the last ones of cur_kv_len and are already in the cache, each
+    // one attends to the tokens up to itself (e.g. the draft tokens verification of the speculative decoding)
+    //  query_to_query_info_ptr: optional tree mask between the L tokens
+    //  q_start_idx_score: the scores of the tokens from this one are accumulated to score_output
     void exec_kernel_one_bh(const PlainTensor& query,
                             const PlainTensor& present_key,
                             const PlainTensor& present_value,
@@ -1312,7 +1318,9 @@ struct MHAHelper {
                             const PlainTensor& alibi_slopes,
                             float* score_output,
                             const PlainTensor& sinks,
-                            size_t q_token_start = 0) {
+                            size_t q_token_start = 0,
+                            const QueryToQueryBiasInfo* query_to_query_info_ptr = nullptr,
+                            size_t q_start_idx_score = 0) {
 #    if defined(OPENVINO_ARCH_X86_64)
         if (any_of(_fastpath_valid_prec, ov::element::bf16, ov::element::f16)) {
             _gemv->tile_config();
@@ -1360,12 +1368,21 @@ struct MHAHelper {
         }
 #    endif
 
+        const auto past_len = cur_kv_len - q_len;
         for (size_t pq = 0; pq < q_len; pq++) {
             for (size_t h = hq_beg; h < hq_end; h++) {
                 // apply attention mask & sofmax
-                const auto ncausal = get_ncausal(q_token_start + pq, cur_kv_len, cur_kv_len);
+                const auto causal_pos = past_len + pq + 1;
+                const auto ncausal = get_ncausal(q_token_start + pq, causal_pos, cur_kv_len);
                 float* score = _weight.ptr<float>(ithr, h - hq_beg, pq);
                 OPENVINO_DEBUG_ASSERT(score != nullptr, "PagedAttention: _weight buffer must be allocated");
+                if (query_to_query_info_ptr != nullptr) {
+                    for (size_t key_idx = past_len; key_idx < causal_pos; key_idx++) {
+                        if (query_to_query_is_masked(query_to_query_info_ptr, pq, key_idx, past_len)) {
+                            score[key_idx] = -FLT_MAX;
+                        }
+                    }
+                }
 
                 float* alibi_lookup = nullptr;
                 float alibi_slope = 0.F;
@@ -1378,7 +1395,7 @@ struct MHAHelper {
                     sink = &sinks.at<float>({0, h, 0, 0}, true);
                 }
                 if (_sliding_window) {
-                    const auto start_idx = get_sliding_start_idx(q_token_start + pq, cur_kv_len);
+                    const auto start_idx = get_sliding_start_idx(q_token_start + pq, causal_pos);
                     const size_t new_causal = ncausal - start_idx;
                     float* sw_alibi_lookup = nullptr;
                     attn_softmax_kernel<float>(score + start_idx,
@@ -1412,12 +1429,17 @@ struct MHAHelper {
                                                sink,
                                                alibi_slope);
                 }
-                if (score_output) {
+                if (score_output && pq >= q_start_idx_score) {
                     // aligned to cache line to avoid false sharing
                     static constexpr int cache_line_size = dnnl::impl::cpu::platform::get_cache_line_size();
-                    std::memcpy(score_output + h * rnd_up(cur_kv_len, cache_line_size / sizeof(float)),
-                                score,
-                                cur_kv_len * sizeof(float));
+                    auto* dst = score_output + h * rnd_up(cur_kv_len, cache_line_size / sizeof(float));
+                    if (q_len == 1) {
+                        std::memcpy(dst, score, cur_kv_len * sizeof(float));
+                    } else {
+                        for (size_t i = 0; i < cur_kv_len; i++) {
+                            dst[i] += score[i];
+                        }
+                    }
                 }
             }
         }
@@ -1705,11 +1727,22 @@ struct MHAHelper {
     }
 };
 
+// Sequences with up to this number of the new tokens (e.g. the draft tokens of the speculative decoding) appended to the
+// cache are computed token by token against the cache, instead of repacking the whole cache like the prefill does
+constexpr size_t MAX_MULTI_QUERY_DECODE_LEN = 16;
+
+static inline uint64_t elapsed_us(std::chrono::steady_clock::time_point start,
+                                  std::chrono::steady_clock::time_point finish) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(finish - start).count();
+}
+
 template <typename DATA_TYPE, ov::element::Type_t KEY_PREC, ov::element::Type_t VALUE_PREC>
 struct MHA {
     MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& _helper;
 
     WorkItems _workitems;
+    // latency breakdown of the current call, not collected if null
+    PagedAttentionPerfStats* _perf_stats = nullptr;
 
     MHA(MHAHelper<DATA_TYPE, KEY_PREC, VALUE_PREC>& helper) : _helper(helper) {}
 
@@ -1738,6 +1771,7 @@ struct MHA {
         _helper.init_reorder_buffers(_workitems.get_reorder_max_batch_size(),
                                      div_up(_workitems.get_reorder_max_kv_len(), _helper._block_size));
 
+        const auto reorder_start = std::chrono::steady_clock::now();
         // packed k, v
         parallel_for2d_dynamic(reorder_work_count, Hk, [&](size_t w, size_t hk) {
             constexpr bool q_cache_is_same = precision_of<DATA_TYPE>::value == VALUE_PREC;
@@ -1842,8 +1876,14 @@ struct MHA {
                            : true;  // or less than 2 work items per thread, loop H
         auto weight_h = loop_hk ? _helper.H / Hk : 1;
         _helper.resize_temporary_weight_buffer(weight_h);
-        // attn_work_count num_sub_seq
-        parallel_for2d_dynamic(attn_work_count, loop_hk ? Hk : _helper.H, [&](size_t w, size_t hx) {
+
+        const auto attn_start = std::chrono::steady_clock::now();
+        if (_perf_stats) {
+            _perf_stats->kv_reorder = elapsed_us(reorder_start, attn_start);
+        }
+        std::atomic<uint64_t> prefill_us{0};
+        std::atomic<uint64_t> decode_us{0};
+        auto exec_attn_work = [&](size_t w, size_t hx, size_t ithr) {
             size_t hk = 0;
             size_t hq_beg = 0;
             size_t hq_end = 0;
@@ -1861,7 +1901,6 @@ struct MHA {
             const auto batch_in_seq = item.batch_in_seq;
             const auto batch_in_token = subsequence_begins.ptr<int32_t>()[batch_in_seq];
             const auto q_len = static_cast<size_t>(item.q_len);
-            const auto ithr = static_cast<size_t>(parallel_get_thread_num());
 
             if (q_len == 1) {
                 const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + 1;
@@ -1891,6 +1930,49 @@ struct MHA {
                     score_output,
                     sinks,
                     static_cast<size_t>(batch_in_token));
+            } else if (item.multi_query_decode) {
+                const auto cur_kv_len = static_cast<size_t>(past_lens.ptr<int32_t>()[batch_in_seq]) + q_len;
+                float* score_output = nullptr;
+                size_t q_start_idx_score = 0;
+                if (output_score) {
+                    const auto score_win_len =
+                        score_aggregation_window
+                            ? static_cast<size_t>(score_aggregation_window.ptr<int32_t>()[batch_in_seq])
+                            : 1;
+                    if (score_win_len) {
+                        q_start_idx_score = q_len >= score_win_len ? q_len - score_win_len : 0;
+                        auto score_offset = _helper._score_infos[batch_in_seq].score_offsets_aligned;
+                        score_output = _helper._score_output.template ptr<float>() + score_offset * _helper.H;
+                    }
+                }
+                PlainTensor sub_query;
+                sub_query.resize({q_len, _helper.H, _helper.S}, q.ptr<DATA_TYPE>(batch_in_token));
+                // physical layout (B_in_tokens, H, S)
+                sub_query = sub_query.permute({1, 0, 2});
+
+                QueryToQueryBiasInfo* query_to_query_info_ptr = nullptr;
+                if (_helper._qq_bias && static_cast<size_t>(batch_in_seq) < _helper._qq_bias_infos.size()) {
+                    query_to_query_info_ptr = &_helper._qq_bias_infos[batch_in_seq];
+                }
+                _helper.exec_kernel_one_bh(
+                    sub_query,
+                    k_cache,
+                    v_cache,
+                    output_emb.slice(0, batch_in_token, batch_in_token + q_len)
+                        .reshape({q_len, _helper.H * _helper.SV}),
+                    block_indices.ptr<int32_t>() + block_indices_begins.ptr<int32_t>()[batch_in_seq],
+                    ithr,
+                    hq_beg,
+                    hq_end,
+                    hk,
+                    q_len,
+                    cur_kv_len,
+                    alibi_slopes,
+                    score_output,
+                    sinks,
+                    static_cast<size_t>(batch_in_token),
+                    query_to_query_info_ptr,
+                    q_start_idx_score);
             } else {
                 const auto batch_in_reorder = item.batch_in_reorder;
                 const auto q_blk = item.q_block_id;
@@ -2003,7 +2085,35 @@ struct MHA {
                     query_to_query_info_ptr);
 #    endif
             }
+        };
+        // The work items differ in the cost by orders of magnitude when the prefill and decode sequences are mixed in
+        // one call (a prefill tile of block_size queries against a long context versus one decode query), so they are
+        // not split between the threads statically. The items are started from the most expensive ones and every
+        // thread takes the next (item, head) pair once it is done with the previous one, the threads finishing early
+        // pick up the remaining cheap items instead of waiting for the slowest one.
+        const size_t h_count = loop_hk ? Hk : _helper.H;
+        const size_t attn_total = attn_work_count * h_count;
+        std::atomic<size_t> next_attn{0};
+        parallel_nt_static(static_cast<int>(std::min(_helper._nthr, attn_total)), [&](size_t ithr, size_t) {
+            for (size_t i = next_attn.fetch_add(1, std::memory_order_relaxed); i < attn_total;
+                 i = next_attn.fetch_add(1, std::memory_order_relaxed)) {
+                const auto w = _workitems.get_attn_schedule(i / h_count);
+                if (!_perf_stats) {
+                    exec_attn_work(w, i % h_count, ithr);
+                    continue;
+                }
+                const auto start = std::chrono::steady_clock::now();
+                exec_attn_work(w, i % h_count, ithr);
+                const auto& item = _workitems.get_attn_work_item(w);
+                auto& thread_time = (item.q_len == 1 || item.multi_query_decode) ? decode_us : prefill_us;
+                thread_time.fetch_add(elapsed_us(start, std::chrono::steady_clock::now()), std::memory_order_relaxed);
+            }
         });
+        if (_perf_stats) {
+            _perf_stats->attention = elapsed_us(attn_start, std::chrono::steady_clock::now());
+            _perf_stats->prefill = prefill_us.load();
+            _perf_stats->decode = decode_us.load();
+        }
         if (output_score) {
             parallel_for2d_dynamic(past_lens.m_dims[0], 1, [&](size_t b, [[maybe_unused]] size_t pq) {
                 auto seq_len = static_cast<size_t>(subsequence_begins.ptr<int32_t>()[b + 1] -
@@ -2042,8 +2152,16 @@ struct MHA {
                     const std::vector<PlainTensor>& sparse_attention_mask,
                     const PlainTensor& qq_bias,
                     const PlainTensor& qq_bias_begins) {
-        _workitems
-            .reset(query, past_lens, subsequence_begins, block_indices, block_indices_begins, _helper._block_size);
+        // the sparse attention mask is computed for the prefill only
+        const size_t max_multi_query_len =
+            sparse_attention_mask.empty() ? std::min(MAX_MULTI_QUERY_DECODE_LEN, _helper._block_size) : 0;
+        _workitems.reset(query,
+                         past_lens,
+                         subsequence_begins,
+                         block_indices,
+                         block_indices_begins,
+                         _helper._block_size,
+                         max_multi_query_len);
         if (output_score) {
             _helper.init_score_buffers(past_lens, subsequence_begins, score_aggregation_window);
         }
@@ -2054,7 +2172,9 @@ struct MHA {
         }
         auto nthr = static_cast<size_t>(parallel_get_max_threads());
 
-        if (past_lens.m_dims[0] >= nthr || _workitems.get_reorder_max_batch_size() > 0) {
+        // exec_loop_bhl supports the single query token per sequence only
+        if (past_lens.m_dims[0] >= nthr || _workitems.get_reorder_max_batch_size() > 0 ||
+            _workitems.get_multi_query_decode_size() > 0) {
             exec_loop_mixed(query,
                             present_key,
                             present_value,
@@ -2070,6 +2190,8 @@ struct MHA {
                             sinks,
                             sparse_attention_mask);
         } else {
+            // the decode only call is split between the threads by the kv blocks, the thread times are not collected
+            const auto attn_start = std::chrono::steady_clock::now();
             // TODO: support second token sparse attention execution
             _helper.exec_loop_bhl(query,
                                   present_key,
@@ -2084,6 +2206,9 @@ struct MHA {
                                   alibi_slopes,
                                   score_aggregation_window,
                                   sinks);
+            if (_perf_stats) {
+                _perf_stats->attention = elapsed_us(attn_start, std::chrono::steady_clock::now());
+            }
         }
     }
 };
@@ -2667,7 +2792,8 @@ struct AttentionExecutor : public PagedAttentionExecutor {
 
     void execute(const std::vector<MemoryPtr>& inputs,
                  const std::vector<MemoryPtr> outputs,
-                 bool write_kv_cache) override {
+                 bool write_kv_cache,
+                 PagedAttentionPerfStats* perf_stats) override {
         PlainTensor q;
         PlainTensor k;
         PlainTensor v;
@@ -2752,6 +2878,12 @@ struct AttentionExecutor : public PagedAttentionExecutor {
             _helper.clear_token_type();
         }
 
+        if (perf_stats) {
+            *perf_stats = {};
+        }
+        _kernel._perf_stats = perf_stats;
+
+        const auto update_start = std::chrono::steady_clock::now();
         if (write_kv_cache) {
             if (rotated_block_indices) {
                 // Rotate kv cache currently doesn't support quantized cache.
@@ -2766,6 +2898,9 @@ struct AttentionExecutor : public PagedAttentionExecutor {
 
             concat_pastkv(k, v, k_cache, v_cache, past_lens, subsequence_begins, block_indices, block_indices_begins);
         }
+        if (perf_stats) {
+            perf_stats->kv_cache_update = elapsed_us(update_start, std::chrono::steady_clock::now());
+        }
 
         _kernel(q,
                 k_cache,
@@ -5,8 +5,10 @@
 
 #include <xbyak/xbyak.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <numeric>
 #include <openvino/core/type/element_type.hpp>
 #include <utility>
 #include <vector>
@@ -19,6 +21,15 @@ namespace ov::Extensions::Cpu {
 
 // this file will contain features that do not require multiple instantiation
 
+// per call latency breakdown of the PagedAttention execution, all the times are in microseconds
+struct PagedAttentionPerfStats {
+    uint64_t kv_cache_update = 0;  // wall time of the cache rotation and the new tokens append
+    uint64_t kv_reorder = 0;       // wall time of the key/value repacking for the prefill sequences
+    uint64_t attention = 0;        // wall time of the attention loop
+    uint64_t prefill = 0;          // sum of the thread times spent on the prefill tiles
+    uint64_t decode = 0;           // sum of the thread times spent on the decode (single or multi query) items
+};
+
 struct PagedAttentionExecutor {
     // PagedAttention input index
     static const size_t ID_Q = 0;                              // [B_token, H * S], float
@@ -49,9 +60,11 @@ struct PagedAttentionExecutor {
     static const size_t ID_TOKEN_TYPE_IDS = 25;                                   // [B_token | 0] or [1, B_token], i32
     static const size_t ID_QQ_BIAS = 26;         // [batch_mask_size_in_sequences], uint8
     static const size_t ID_QQ_BIAS_BEGINS = 27;  // [B_seq + 1], int32
+    // perf_stats is filled with the latency breakdown of the call if it is not null
     virtual void execute(const std::vector<ov::intel_cpu::MemoryPtr>& inputs,
                          std::vector<ov::intel_cpu::MemoryPtr> outputs,
-                         bool write_kv_cache) = 0;
+                         bool write_kv_cache,
+                         PagedAttentionPerfStats* perf_stats) = 0;
     virtual ~PagedAttentionExecutor() = default;
 };
 
@@ -66,8 +79,11 @@ struct PagedAttnQuantParams {
 struct AttnWorkItem {
     int32_t batch_in_reorder;  // which batch in reorder buffer will be used
     int32_t batch_in_seq;      // batch idx in sequence
-    int32_t q_len;             // current sequence length, 1 for second token, 2+ for first token
+    int32_t q_len;             // current sequence length, 1 for second token, 2+ for first token or multi query
     int32_t q_block_id;        // block id in this seq, valid at first token
+    // a few query tokens (e.g. the draft tokens of the speculative decoding) are computed against the cache directly
+    // like the second token, so there is no reorder for them
+    bool multi_query_decode = false;
 };
 struct ReorderWorkItem {
     int32_t batch_in_seq;      // batch idx in sequence
@@ -79,23 +95,32 @@ struct ReorderWorkItem {
 struct WorkItems {
 private:
     std::vector<AttnWorkItem> attn_items;
+    // attention work items ordered by the cost descending, the most expensive ones (long prefill tiles) are started
+    // first and the cheap decode items fill the gaps at the end of the loop
+    std::vector<size_t> attn_schedule;
     std::vector<ReorderWorkItem> reorder_items;
     int32_t max_kv_len_in_reorder = 0;  // max kv len between first tokens
     int32_t max_batch_in_reorder = 0;
     int32_t total_kv_len = 0;
+    int32_t multi_query_decode_count = 0;
 
 public:
+    // max_multi_query_len: subsequences with 2..max_multi_query_len query tokens are computed as the multi query
+    // decode, 0 disables it
     void reset([[maybe_unused]] const ov::intel_cpu::PlainTensor& query,
                const ov::intel_cpu::PlainTensor& past_lens,
                const ov::intel_cpu::PlainTensor& subsequence_begins,
                const ov::intel_cpu::PlainTensor& block_indices,
                const ov::intel_cpu::PlainTensor& block_indices_begins,
-               size_t block_size) {
+               size_t block_size,
+               size_t max_multi_query_len = 0) {
         attn_items.clear();
+        attn_schedule.clear();
         reorder_items.clear();
         max_kv_len_in_reorder = 0;
         max_batch_in_reorder = 0;
         total_kv_len = 0;
+        multi_query_decode_count = 0;
         auto seq_cout = static_cast<int32_t>(past_lens.m_dims[0]);
         for (int32_t i = 0; i < seq_cout; i++) {
             auto q_len = subsequence_begins.ptr<int32_t>()[i + 1] - subsequence_begins.ptr<int32_t>()[i];
@@ -107,6 +132,14 @@ public:
                                                      1ULL,  // q_len
                                                      // kv_len in blocks, used in the sort function
                                                      kv_len_in_block - 1});
+            } else if (static_cast<size_t>(q_len) <= max_multi_query_len) {
+                attn_items.emplace_back(AttnWorkItem{0,      // batch_in_reorder
+                                                     i,      // batch_in_seq
+                                                     q_len,  // q_len
+                                                     // kv_len in blocks, used in the sort function
+                                                     kv_len_in_block - 1,
+                                                     true});  // multi_query_decode
+                multi_query_decode_count++;
             } else {
                 auto reorder_sub_work_count = kv_len_in_block;
                 max_kv_len_in_reorder = std::max(max_kv_len_in_reorder, kv_len);
@@ -135,10 +168,34 @@ public:
             }
             total_kv_len += kv_len;
         }
+
+        // the cost of an item is the number of the query-key dot products of a head
+        std::vector<size_t> attn_costs(attn_items.size());
+        for (size_t w = 0; w < attn_items.size(); w++) {
+            const auto& item = attn_items[w];
+            const auto past_len = static_cast<size_t>(past_lens.ptr<int32_t>()[item.batch_in_seq]);
+            const auto q_len = static_cast<size_t>(item.q_len);
+            if (q_len == 1 || item.multi_query_decode) {
+                attn_costs[w] = q_len * (past_len + q_len);
+            } else {
+                const auto q_beg = static_cast<size_t>(item.q_block_id) * block_size;
+                const auto q_cnt = std::min(block_size, q_len - q_beg);
+                attn_costs[w] = q_cnt * (past_len + q_beg + q_cnt);
+            }
+        }
+        attn_schedule.resize(attn_items.size());
+        std::iota(attn_schedule.begin(), attn_schedule.end(), 0);
+        std::stable_sort(attn_schedule.begin(), attn_schedule.end(), [&](size_t a, size_t b) {
+            return attn_costs[a] > attn_costs[b];
+        });
     }
     [[nodiscard]] const AttnWorkItem& get_attn_work_item(size_t idx) const {
         return attn_items[idx];
     }
+    // index of the attention work item to be started idx-th
+    [[nodiscard]] size_t get_attn_schedule(size_t idx) const {
+        return attn_schedule[idx];
+    }
     [[nodiscard]] size_t attn_work_size() const {
         return attn_items.size();
     }
@@ -157,6 +214,9 @@ public:
     [[nodiscard]] size_t get_total_kv_len() const {
         return static_cast<size_t>(total_kv_len);
     }
+    [[nodiscard]] size_t get_multi_query_decode_size() const {
+        return static_cast<size_t>(multi_query_decode_count);
+    }
 };
 
 #ifdef OPENVINO_ARCH_X86_64
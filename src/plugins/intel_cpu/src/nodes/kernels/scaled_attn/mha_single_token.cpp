@@ -1,10 +1,12 @@
 // Copyright (C) 2018-2026 Intel Corporation
 // SPDX-License-Identifier: Apache-2.0
 //
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <type_traits>
 
 #include "openvino/core/except.hpp"
@@ -1212,6 +1214,251 @@ static void attn_reduce(ov::float16* dst, ov::float16* temp, size_t M, size_t S,
 }
 #endif
 
+// The kv length is split into parts (flash decoding) when the batch and the heads can't occupy the threads: every part
+// is computed by a thread from the logits to the partial output with the max and the sum of the exponents of its
+// logits, then the parts are combined with the log-sum-exp rescaling. Otherwise the softmax of the whole row is
+// computed by a thread, so only B * H * q_len threads are busy with it.
+static size_t get_kv_split_num(size_t B, size_t H, size_t h_group_num, size_t q_len, size_t kv_len, size_t nthr) {
+    // the shorter parts don't pay back the reduction of the partial outputs
+    constexpr size_t min_part_len = 256;
+    constexpr size_t min_kv_len = 2048;
+    if (kv_len < min_kv_len || B * H * q_len >= nthr) {
+        return 1;
+    }
+    return std::min(intel_cpu::div_up(nthr, B * h_group_num), kv_len / min_part_len);
+}
+
+// scales and masks the logits of the part of the row in place like attn_softmax_kernel, returns their max
+static float scale_mask_reduce_max(float* a,
+                                   float scale,
+                                   const void* attn_mask,
+                                   ov::element::Type attn_mask_prec,
+                                   size_t len) {
+    float max = std::numeric_limits<float>::lowest();
+    if (attn_mask == nullptr) {
+        scale_add2_reduce_max<false, false, false, false, float>(a,
+                                                                 scale,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 nullptr,
+                                                                 false,
+                                                                 len,
+                                                                 0.0F,
+                                                                 max,
+                                                                 nullptr,
+                                                                 1);
+    } else if (attn_mask_prec == ov::element::f32) {
+        scale_add2_reduce_max<false, true, false, false>(a,
+                                                         scale,
+                                                         nullptr,
+                                                         static_cast<const float*>(attn_mask),
+                                                         nullptr,
+                                                         false,
+                                                         len,
+                                                         0.0F,
+                                                         max,
+                                                         nullptr,
+                                                         1);
+    } else if (attn_mask_prec == ov::element::bf16) {
+        scale_add2_reduce_max<false, true, false, false>(a,
+                                                         scale,
+                                                         nullptr,
+                                                         static_cast<const ov::bfloat16*>(attn_mask),
+                                                         nullptr,
+                                                         false,
+                                                         len,
+                                                         0.0F,
+                                                         max,
+                                                         nullptr,
+                                                         1);
+    } else {
+        scale_add2_reduce_max<false, true, false, false>(a,
+                                                         scale,
+                                                         nullptr,
+                                                         static_cast<const ov::float16*>(attn_mask),
+                                                         nullptr,
+                                                         false,
+                                                         len,
+                                                         0.0F,
+                                                         max,
+                                                         nullptr,
+                                                         1);
+    }
+    return max;
+}
+
+template <typename T, typename T2>
+static void mha_single_token_split_kv(const ov::intel_cpu::PlainTensor& query,
+                                      const ov::intel_cpu::PlainTensor& present_key,
+                                      const ov::intel_cpu::PlainTensor& present_value,
+                                      const ov::intel_cpu::PlainTensor& attention_mask,
+                                      const ov::intel_cpu::PlainTensor& beams,
+                                      ov::intel_cpu::PlainTensor& output_emb,
+                                      ov::intel_cpu::PlainTensor& buf_attn_w,
+                                      ov::intel_cpu::PlainTensor& buf_attn_score,
+                                      bool has_out_transpose,
+                                      bool auto_causal,
+                                      float d_scale,
+                                      const ov::intel_cpu::PlainTensor& past_k_scale_zp,
+                                      const ov::intel_cpu::PlainTensor& past_v_scale_zp,
+                                      ov::intel_cpu::PlainTensor& head_sum,
+                                      size_t key_group_size,
+                                      size_t value_group_size,
+                                      bool quant_key_by_channel,
+                                      const ov::intel_cpu::PlainTensor& sink_input,
+                                      size_t kv_split_num,
+                                      const ov::intel_cpu::CpuParallelPtr& cpu_parallel) {
+    auto B = query.size(0);
+    auto H = query.size(1);
+    auto q_len = query.size(2);
+    auto S = query.size(3);
+    auto SV = present_value.size(3);
+    auto h_group_num = present_value.size(1);
+    auto h_each_group_len = H / h_group_num;
+    auto kv_len = present_key.size(2);
+    bool pastkv_is_int8 = static_cast<bool>(past_k_scale_zp);
+    auto attn_mask_prec = attention_mask.get_precision();
+    // the partial output of a part is followed by the max and the sum of the exponents of its logits
+    const size_t part_stride = intel_cpu::rnd_up(SV + 2, 16);
+    buf_attn_score.resize<float>({B, H, q_len, kv_split_num, part_stride});
+
+    cpu_parallel->parallel_for3d(B, h_group_num, kv_split_num, [&](size_t b, size_t h_group, size_t part) {
+        const auto part_beg = kv_len * part / kv_split_num;
+        const auto part_end = kv_len * (part + 1) / kv_split_num;
+        const auto h_beg = h_group * h_each_group_len;
+        const auto h_end = h_beg + h_each_group_len;
+        auto get_ncausal = [&](size_t pq) {
+            return auto_causal ? (kv_len - q_len + pq + 1) : kv_len;
+        };
+
+        // q * k'
+        for (size_t pk = part_beg; pk < part_end; pk++) {
+            auto b_kv = beams ? beams.ptr<int32_t>(b)[pk] : b;
+            auto* p = past_k_scale_zp.ptr<float>(pk, b_kv, h_group);
+            for (size_t pq = 0; pq < q_len; pq++) {
+                for (size_t h = h_beg; h < h_end; h++) {
+                    if (quant_key_by_channel && pastkv_is_int8) {
+                        auto* p_scale = past_k_scale_zp.ptr<float>(pk / key_group_size * 2, b_kv, h_group);
+                        auto* p_zp = past_k_scale_zp.ptr<float>(pk / key_group_size * 2 + 1, b_kv, h_group);
+                        auto* p_k = present_key.ptr<uint8_t>(b_kv, h_group, pk);
+                        buf_attn_w.ptr<float>(b, h, pq)[pk] =
+                            dot_product_by_channel(query.ptr<T>(b, h, pq), p_k, S, p_scale, p_zp, key_group_size);
+                    } else {
+                        buf_attn_w.ptr<float>(b, h, pq)[pk] = dot_product(query.ptr<T>(b, h, pq),
+                                                                          present_key.ptr<T2>(b_kv, h_group, pk),
+                                                                          S,
+                                                                          p,
+                                                                          p + 1,
+                                                                          head_sum.ptr<float>(b, h, pq),
+                                                                          key_group_size);
+                    }
+                }
+            }
+        }
+
+        // softmax of the part without the normalization
+        for (size_t pq = 0; pq < q_len; pq++) {
+            const auto valid_end = std::min(part_end, get_ncausal(pq));
+            const auto len = valid_end > part_beg ? valid_end - part_beg : 0;
+            for (size_t h = h_beg; h < h_end; h++) {
+                auto* out = buf_attn_score.ptr<float>(b, h, pq, part);
+                std::memset(out, 0, SV * sizeof(float));
+                float max = std::numeric_limits<float>::lowest();
+                float sum = 0.0F;
+                if (len > 0) {
+                    auto* w = buf_attn_w.ptr<float>(b, h, pq) + part_beg;
+                    const uint8_t* attn_mask_ptr = nullptr;
+                    if (attention_mask) {
+                        attn_mask_ptr = reinterpret_cast<uint8_t*>(&attention_mask.at<T>({b, h, pq, 0}, true)) +
+                                        part_beg * attn_mask_prec.size();
+                    }
+                    max = scale_mask_reduce_max(w, d_scale, attn_mask_ptr, attn_mask_prec, len);
+                    if (max == -std::numeric_limits<float>::infinity()) {
+                        // the part is fully masked, it doesn't contribute to the output
+                        std::memset(w, 0, len * sizeof(float));
+                        max = std::numeric_limits<float>::lowest();
+                    } else {
+                        exp_reduce_sum(w, max, len, sum);
+                    }
+                }
+                out[SV] = max;
+                out[SV + 1] = sum;
+            }
+        }
+
+        // attn_w * V
+        for (size_t pv = part_beg; pv < part_end; pv++) {
+            auto b_kv = beams ? beams.ptr<int32_t>(b)[pv] : b;
+            auto* v = present_value.ptr<T2>(b_kv, h_group, pv);
+            auto* p = past_v_scale_zp.ptr<float>(pv, b_kv, h_group);
+            for (size_t pq = 0; pq < q_len; pq++) {
+                if (pv >= get_ncausal(pq)) {
+                    continue;
+                }
+                for (size_t h = h_beg; h < h_end; h++) {
+                    attn_acc_value(buf_attn_score.ptr<float>(b, h, pq, part),
+                                   buf_attn_w.ptr<float>(b, h, pq)[pv],
+                                   v,
+                                   SV,
+                                   p + 0,
+                                   p + 1,
+                                   value_group_size);
+                }
+            }
+        }
+    });
+
+    // combine the parts rescaled to the max of the whole row, the empty and the fully masked parts are skipped
+    cpu_parallel->parallel_for3d(B, H, q_len, [&](size_t b, size_t h, size_t pq) {
+        auto part_stats = [&](size_t part) {
+            return buf_attn_score.ptr<float>(b, h, pq, part) + SV;
+        };
+        float max = std::numeric_limits<float>::lowest();
+        for (size_t part = 0; part < kv_split_num; part++) {
+            if (part_stats(part)[1] > 0.0F) {
+                max = std::max(max, part_stats(part)[0]);
+            }
+        }
+        const float* sink = sink_input ? &sink_input.at<float>({b, h, pq, 0}, true) : nullptr;
+        if (sink != nullptr) {
+            max = std::max(max, *sink);
+        }
+        float sum = 0.0F;
+        for (size_t part = 0; part < kv_split_num; part++) {
+            const auto* stats = part_stats(part);
+            if (stats[1] > 0.0F) {
+                sum += stats[1] * std::exp(stats[0] - max);
+            }
+        }
+        if (sink != nullptr) {
+            sum += std::exp(*sink - max);
+        }
+        // the scales are zeros if the whole row is masked, so the output is zeros rather than NaN
+        auto part_scale = [&](size_t part) {
+            const auto* stats = part_stats(part);
+            return stats[1] > 0.0F ? std::exp(stats[0] - max) / sum : 0.0F;
+        };
+
+        auto* acc = buf_attn_score.ptr<float>(b, h, pq, 0);
+        const float scale0 = part_scale(0);
+        for (size_t i = 0; i < SV; i++) {
+            acc[i] *= scale0;
+        }
+        for (size_t part = 1; part < kv_split_num; part++) {
+            const float scale = part_scale(part);
+            if (scale == 0.0F) {
+                continue;
+            }
+            const auto* out = buf_attn_score.ptr<float>(b, h, pq, part);
+            for (size_t i = 0; i < SV; i++) {
+                acc[i] += out[i] * scale;
+            }
+        }
+        auto* dst = has_out_transpose ? output_emb.ptr<T>(b, pq, h * SV) : output_emb.ptr<T>(b, h, pq);
+        cvt_copy(dst, acc, SV);
+    });
+}
+
 template <typename T, typename T2, typename T3>
 static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
                                     const ov::intel_cpu::PlainTensor& present_key,
@@ -1269,6 +1516,33 @@ static void mha_single_token_kernel(const ov::intel_cpu::PlainTensor& query,
     }
 #endif
 
+    if constexpr (std::is_same_v<T3, float>) {
+        const auto kv_split_num = get_kv_split_num(B, H, h_group_num, q_len, kv_len, static_cast<size_t>(nthr));
+        if (kv_split_num > 1 && !alibi_mask) {
+            mha_single_token_split_kv<T, T2>(query,
+                                             present_key,
+                                             present_value,
+                                             attention_mask,
+                                             beams,
+                                             output_emb,
+                                             buf_attn_w,
+                                             buf_attn_score,
+                                             has_out_transpose,
+                                             auto_causal,
+                                             d_scale,
+                                             past_k_scale_zp,
+                                             past_v_scale_zp,
+                                             head_sum,
+                                             key_group_size,
+                                             value_group_size,
+                                             quant_key_by_channel,
+                                             sink_input,
+                                             kv_split_num,
+                                             cpu_parallel);
+            return;
+        }
+    }
+
     parallel_nt_static(nthr, [&](const size_t ithr, const size_t nthr) {
         size_t start{0};
         size_t end{0};
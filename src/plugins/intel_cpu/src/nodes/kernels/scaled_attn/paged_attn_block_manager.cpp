@@ -0,0 +1,297 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include "paged_attn_block_manager.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/util/hash_util.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+size_t hashBlock(size_t prevHash, const PagedAttentionBlockManager::Token* tokens, size_t count) {
+    size_t seed = prevHash;
+    for (size_t i = 0; i < count; i++) {
+        seed = ov::util::hash_combine(std::hash<PagedAttentionBlockManager::Token>{}(tokens[i]), seed);
+    }
+    // zero marks the blocks which are not cached
+    return seed == 0 ? 1 : seed;
+}
+}  // namespace
+
+PagedAttentionBlockManager::PagedAttentionBlockManager(size_t numBlocks, size_t blockSize, bool prefixCaching)
+    : m_blockSize(blockSize),
+      m_prefixCaching(prefixCaching),
+      m_blocks(numBlocks) {
+    OPENVINO_ASSERT(blockSize > 0, "PagedAttention block size must be positive");
+    m_free.reserve(numBlocks);
+    // the blocks are allocated from the back, so the lower block numbers are used first
+    for (size_t i = numBlocks; i > 0; i--) {
+        m_free.push_back(static_cast<int32_t>(i - 1));
+    }
+}
+
+PagedAttentionBlockManager::Sequence& PagedAttentionBlockManager::sequence(SequenceId id) {
+    auto it = m_sequences.find(id);
+    OPENVINO_ASSERT(it != m_sequences.end(), "PagedAttention sequence ", id, " is not registered");
+    return it->second;
+}
+
+const PagedAttentionBlockManager::Sequence& PagedAttentionBlockManager::sequence(SequenceId id) const {
+    auto it = m_sequences.find(id);
+    OPENVINO_ASSERT(it != m_sequences.end(), "PagedAttention sequence ", id, " is not registered");
+    return it->second;
+}
+
+int32_t PagedAttentionBlockManager::allocate() {
+    int32_t block = -1;
+    if (!m_free.empty()) {
+        block = m_free.back();
+        m_free.pop_back();
+    } else {
+        OPENVINO_ASSERT(!m_evictable.empty(), "PagedAttention KV cache is out of blocks");
+        block = m_evictable.front();
+        m_evictable.pop_front();
+        m_blocks[block].evictable = false;
+        forget(block);
+    }
+    m_blocks[block].refs = 1;
+    return block;
+}
+
+void PagedAttentionBlockManager::acquire(int32_t block) {
+    auto& b = m_blocks[block];
+    if (b.evictable) {
+        m_evictable.erase(b.lru);
+        b.evictable = false;
+    }
+    b.refs++;
+}
+
+void PagedAttentionBlockManager::release(int32_t block) {
+    auto& b = m_blocks[block];
+    OPENVINO_ASSERT(b.refs > 0, "PagedAttention block ", block, " is released twice");
+    if (--b.refs != 0) {
+        return;
+    }
+    if (b.hash != 0) {
+        b.lru = m_evictable.insert(m_evictable.end(), block);
+        b.evictable = true;
+    } else {
+        m_free.push_back(block);
+    }
+}
+
+void PagedAttentionBlockManager::forget(int32_t block) {
+    auto& b = m_blocks[block];
+    if (b.hash == 0) {
+        return;
+    }
+    auto range = m_cached.equal_range(b.hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == block) {
+            m_cached.erase(it);
+            break;
+        }
+    }
+    b.hash = 0;
+    b.prev = -1;
+    b.tokens.clear();
+}
+
+int32_t PagedAttentionBlockManager::lookup(size_t hash, int32_t prev, const Token* tokens) const {
+    auto range = m_cached.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        const auto& b = m_blocks[it->second];
+        // the hash collisions are resolved by the comparison of the content
+        if (b.prev == prev && std::equal(b.tokens.begin(), b.tokens.end(), tokens)) {
+            return it->second;
+        }
+    }
+    return -1;
+}
+
+size_t PagedAttentionBlockManager::addSequence(SequenceId id, const std::vector<Token>& tokens) {
+    OPENVINO_ASSERT(!tokens.empty(), "PagedAttention sequence ", id, " has no tokens");
+    OPENVINO_ASSERT(m_sequences.count(id) == 0, "PagedAttention sequence ", id, " is already registered");
+    auto& seq = m_sequences[id];
+    seq.tokens = tokens;
+    if (!m_prefixCaching) {
+        return 0;
+    }
+
+    size_t hash = 0;
+    int32_t prev = -1;
+    for (size_t begin = 0; begin + m_blockSize <= tokens.size(); begin += m_blockSize) {
+        hash = hashBlock(hash, tokens.data() + begin, m_blockSize);
+        const auto block = lookup(hash, prev, tokens.data() + begin);
+        if (block < 0) {
+            break;
+        }
+        acquire(block);
+        seq.blocks.push_back(block);
+        prev = block;
+    }
+    // the output of the last token is required, so it is computed again (the block is copied on write)
+    seq.computed = std::min(seq.blocks.size() * m_blockSize, tokens.size() - 1);
+    m_prefixHitTokens += seq.computed;
+    return seq.computed;
+}
+
+void PagedAttentionBlockManager::forkSequence(SequenceId parent, SequenceId child) {
+    OPENVINO_ASSERT(m_sequences.count(child) == 0, "PagedAttention sequence ", child, " is already registered");
+    auto seq = sequence(parent);
+    for (const auto block : seq.blocks) {
+        acquire(block);
+    }
+    m_sequences.emplace(child, std::move(seq));
+}
+
+void PagedAttentionBlockManager::appendTokens(SequenceId id, const std::vector<Token>& tokens) {
+    auto& seq = sequence(id);
+    seq.tokens.insert(seq.tokens.end(), tokens.begin(), tokens.end());
+}
+
+void PagedAttentionBlockManager::removeSequence(SequenceId id) {
+    auto& seq = sequence(id);
+    // the prefix blocks are more likely to be reused, so they are released last and evicted last
+    for (auto it = seq.blocks.rbegin(); it != seq.blocks.rend(); ++it) {
+        release(*it);
+    }
+    m_sequences.erase(id);
+}
+
+std::vector<PagedAttentionBlockManager::BlockCopy> PagedAttentionBlockManager::reserve(SequenceId id) {
+    auto& seq = sequence(id);
+    std::vector<BlockCopy> copies;
+    // the blocks the tokens of the step are written to must be owned by the sequence
+    for (size_t i = seq.computed / m_blockSize; i < seq.blocks.size(); i++) {
+        auto& block = seq.blocks[i];
+        if (m_blocks[block].refs == 1 && m_blocks[block].hash == 0) {
+            continue;
+        }
+        const auto copy = allocate();
+        copies.push_back({block, copy});
+        release(block);
+        block = copy;
+    }
+    const auto required = (seq.tokens.size() + m_blockSize - 1) / m_blockSize;
+    while (seq.blocks.size() < required) {
+        seq.blocks.push_back(allocate());
+    }
+    m_copiedBlocks += copies.size();
+    return copies;
+}
+
+void PagedAttentionBlockManager::commit(SequenceId id) {
+    auto& seq = sequence(id);
+    OPENVINO_ASSERT(seq.blocks.size() * m_blockSize >= seq.tokens.size(),
+                    "PagedAttention sequence ",
+                    id,
+                    " is committed without the reserved blocks");
+    seq.computed = seq.tokens.size();
+    if (!m_prefixCaching) {
+        return;
+    }
+
+    size_t hash = 0;
+    int32_t prev = -1;
+    for (size_t i = 0; (i + 1) * m_blockSize <= seq.computed; i++) {
+        auto& block = seq.blocks[i];
+        const auto* tokens = seq.tokens.data() + i * m_blockSize;
+        if (m_blocks[block].hash == 0) {
+            hash = hashBlock(hash, tokens, m_blockSize);
+            const auto cached = lookup(hash, prev, tokens);
+            if (cached >= 0) {
+                // the same content is computed by another sequence meanwhile, so the cached block is shared
+                acquire(cached);
+                release(block);
+                block = cached;
+            } else {
+                auto& b = m_blocks[block];
+                b.hash = hash;
+                b.prev = prev;
+                b.tokens.assign(tokens, tokens + m_blockSize);
+                m_cached.emplace(hash, block);
+            }
+        } else {
+            hash = m_blocks[block].hash;
+        }
+        prev = block;
+    }
+}
+
+void PagedAttentionBlockManager::rollback(SequenceId id, size_t tokens) {
+    auto& seq = sequence(id);
+    OPENVINO_ASSERT(seq.computed == seq.tokens.size(),
+                    "PagedAttention sequence ",
+                    id,
+                    " is rolled back before the commit");
+    OPENVINO_ASSERT(tokens < seq.computed,
+                    "PagedAttention sequence ",
+                    id,
+                    " can't drop ",
+                    tokens,
+                    " tokens of ",
+                    seq.computed,
+                    " computed ones");
+    seq.computed -= tokens;
+    seq.tokens.resize(seq.computed);
+}
+
+PagedAttentionBlockManager::Inputs PagedAttentionBlockManager::inputs(const std::vector<SequenceId>& ids) const {
+    Inputs inputs;
+    inputs.subsequenceBegins.push_back(0);
+    inputs.blockIndicesBegins.push_back(0);
+    for (const auto id : ids) {
+        const auto& seq = sequence(id);
+        OPENVINO_ASSERT(seq.blocks.size() * m_blockSize >= seq.tokens.size(),
+                        "PagedAttention sequence ",
+                        id,
+                        " has no reserved blocks for the step");
+        inputs.pastLens.push_back(static_cast<int32_t>(seq.computed));
+        inputs.subsequenceBegins.push_back(inputs.subsequenceBegins.back() +
+                                           static_cast<int32_t>(seq.tokens.size() - seq.computed));
+        inputs.blockIndices.insert(inputs.blockIndices.end(), seq.blocks.begin(), seq.blocks.end());
+        inputs.blockIndicesBegins.push_back(static_cast<int32_t>(inputs.blockIndices.size()));
+    }
+    return inputs;
+}
+
+void PagedAttentionBlockManager::copyBlocks(const std::vector<BlockCopy>& copies, void* cache, size_t blockBytes) {
+    auto* data = static_cast<uint8_t*>(cache);
+    for (const auto& copy : copies) {
+        std::memcpy(data + static_cast<size_t>(copy.dst) * blockBytes,
+                    data + static_cast<size_t>(copy.src) * blockBytes,
+                    blockBytes);
+    }
+}
+
+const std::vector<int32_t>& PagedAttentionBlockManager::blockTable(SequenceId id) const {
+    return sequence(id).blocks;
+}
+
+size_t PagedAttentionBlockManager::computedTokens(SequenceId id) const {
+    return sequence(id).computed;
+}
+
+PagedAttentionBlockManager::Statistics PagedAttentionBlockManager::statistics() const {
+    Statistics stats;
+    for (const auto& block : m_blocks) {
+        stats.usedBlocks += block.refs > 0 ? 1 : 0;
+        stats.sharedBlocks += block.refs > 1 ? 1 : 0;
+    }
+    stats.cachedBlocks = m_evictable.size();
+    stats.prefixHitTokens = m_prefixHitTokens;
+    stats.copiedBlocks = m_copiedBlocks;
+    return stats;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,173 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Reference manager of the PagedAttention KV cache blocks with the prefix sharing.
+ *
+ * The manager owns the block tables of the sequences and produces the PagedAttention inputs (past_lens,
+ * subsequence_begins, block_indices and block_indices_begins) for a batch of the sequences.
+ *
+ * The full blocks are identified by the hash of their tokens chained with the hash of the previous block, so a new
+ * sequence reuses the blocks of the already computed prompt prefix (e.g. a system prompt) instead of recomputing it.
+ * The blocks are reference counted, the blocks which are not referenced by any sequence stay in the prefix cache until
+ * they are evicted (least recently used first) by the allocation of a new block.
+ *
+ * A shared block is never written: when the tokens of a sequence are about to be appended to a shared block, the
+ * block is copied (copy-on-write) and the copies must be applied to the KV cache with copyBlocks() before the
+ * PagedAttention is executed (for both the key and the value caches).
+ *
+ * The typical step is:
+ *   addSequence() or appendTokens(), reserve(), copyBlocks(), inputs(), PagedAttention execution, commit()
+ * followed by rollback() if the step computes the draft tokens of the speculative decoding and some are rejected.
+ *
+ * @note The manager is not thread safe.
+ */
+class PagedAttentionBlockManager {
+public:
+    using SequenceId = uint64_t;
+    using Token = int64_t;
+
+    struct BlockCopy {
+        int32_t src;
+        int32_t dst;
+    };
+
+    struct Inputs {
+        std::vector<int32_t> pastLens;
+        std::vector<int32_t> subsequenceBegins;
+        std::vector<int32_t> blockIndices;
+        std::vector<int32_t> blockIndicesBegins;
+    };
+
+    struct Statistics {
+        // blocks referenced by the sequences
+        size_t usedBlocks = 0;
+        // blocks referenced by more than one sequence
+        size_t sharedBlocks = 0;
+        // blocks not referenced by the sequences, but kept in the prefix cache
+        size_t cachedBlocks = 0;
+        // prompt tokens found in the prefix cache
+        size_t prefixHitTokens = 0;
+        size_t copiedBlocks = 0;
+    };
+
+    /**
+     * @param numBlocks number of the blocks of the KV cache
+     * @param blockSize number of the tokens in a block
+     * @param prefixCaching whether the computed blocks are shared between the sequences
+     */
+    PagedAttentionBlockManager(size_t numBlocks, size_t blockSize, bool prefixCaching = true);
+
+    /**
+     * @brief Registers the sequence with the prompt tokens and shares the cached blocks of the longest prompt prefix
+     * @return Number of the prompt tokens found in the cache. The last prompt token is always computed, since its
+     * output is required
+     */
+    size_t addSequence(SequenceId id, const std::vector<Token>& tokens);
+
+    /**
+     * @brief Registers the child sequence sharing all the blocks of the parent one (e.g. for the parallel sampling)
+     */
+    void forkSequence(SequenceId parent, SequenceId child);
+
+    /**
+     * @brief Appends the tokens (e.g. generated by the previous step) to be computed by the next step
+     */
+    void appendTokens(SequenceId id, const std::vector<Token>& tokens);
+
+    void removeSequence(SequenceId id);
+
+    /**
+     * @brief Allocates the blocks for the tokens to be computed by the next step
+     * @return Blocks to copy before the step, since the tokens are written to the shared blocks
+     */
+    std::vector<BlockCopy> reserve(SequenceId id);
+
+    /**
+     * @brief Marks the tokens of the step computed and makes the newly filled blocks available for the prefix sharing
+     */
+    void commit(SequenceId id);
+
+    /**
+     * @brief Drops the last computed tokens of the sequence, e.g. the draft tokens rejected by the speculative decoding
+     *
+     * The block table is kept: the KV of the dropped tokens stays in the blocks, but it is hidden by past_lens and
+     * overwritten by the next step. The cached blocks with the dropped tokens are left to the other sequences, the
+     * next step copies them on write.
+     */
+    void rollback(SequenceId id, size_t tokens);
+
+    /**
+     * @brief Builds the PagedAttention inputs of the batch of the sequences reserved for the step
+     */
+    Inputs inputs(const std::vector<SequenceId>& ids) const;
+
+    /**
+     * @brief Copies the blocks of a KV cache with layout [num_blocks, ...]
+     * @param cache pointer to the cache data
+     * @param blockBytes size of a block of the cache in bytes, including the quantization parameters
+     */
+    static void copyBlocks(const std::vector<BlockCopy>& copies, void* cache, size_t blockBytes);
+
+    [[nodiscard]] const std::vector<int32_t>& blockTable(SequenceId id) const;
+
+    [[nodiscard]] size_t computedTokens(SequenceId id) const;
+
+    [[nodiscard]] Statistics statistics() const;
+
+    [[nodiscard]] size_t freeBlocks() const {
+        return m_free.size() + m_evictable.size();
+    }
+
+private:
+    struct Block {
+        size_t refs = 0;
+        // the hash of the full block which tokens are computed, zero otherwise
+        size_t hash = 0;
+        int32_t prev = -1;
+        std::vector<Token> tokens;
+        // position in the evictable list if the cached block is not referenced
+        std::list<int32_t>::iterator lru;
+        bool evictable = false;
+    };
+
+    struct Sequence {
+        std::vector<Token> tokens;
+        std::vector<int32_t> blocks;
+        size_t computed = 0;
+    };
+
+    Sequence& sequence(SequenceId id);
+    const Sequence& sequence(SequenceId id) const;
+
+    int32_t allocate();
+    void acquire(int32_t block);
+    void release(int32_t block);
+    void forget(int32_t block);
+    int32_t lookup(size_t hash, int32_t prev, const Token* tokens) const;
+
+    const size_t m_blockSize;
+    const bool m_prefixCaching;
+    std::vector<Block> m_blocks;
+    std::vector<int32_t> m_free;
+    // not referenced cached blocks, the least recently used first
+    std::list<int32_t> m_evictable;
+    std::unordered_multimap<size_t, int32_t> m_cached;
+    std::unordered_map<SequenceId, Sequence> m_sequences;
+
+    size_t m_prefixHitTokens = 0;
+    size_t m_copiedBlocks = 0;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,242 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "dyn_quant_fc.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include "nodes/kernels/scaled_attn/common.hpp"
+
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+#    include <immintrin.h>
+#endif
+
+namespace ov::Extensions::Cpu::XARCH {
+
+namespace {
+
+// the weights are unsigned and the activations are in [-127, 127], so the VNNI-less multiply-add sequences below
+// (vpmaddwd on the widened values, vpmaddubsw for the 4-bit weights) never saturate
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+inline __m256i dot_u8_16(const uint8_t* w, const int8_t* a, __m256i acc) {
+    auto vw = _mm256_cvtepu8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(w)));
+    auto va = _mm256_cvtepi8_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i*>(a)));
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(vw, va));
+}
+
+inline __m256i dot_u4_32(const uint8_t* w, const int8_t* a, __m256i acc) {
+    const auto mask = _mm_set1_epi8(0x0F);
+    const auto ones = _mm256_set1_epi16(1);
+    auto packed = _mm_loadu_si128(reinterpret_cast<const __m128i*>(w));
+    auto lo = _mm_and_si128(packed, mask);
+    auto hi = _mm_and_si128(_mm_srli_epi16(packed, 4), mask);
+    auto vw = _mm256_set_m128i(hi, lo);
+    auto va = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(a));
+    // the pair sums are at most 2 * 15 * 127 and fit into int16
+    return _mm256_add_epi32(acc, _mm256_madd_epi16(_mm256_maddubs_epi16(vw, va), ones));
+}
+#endif
+
+// the integer dot products are scaled once per group in f32 lanes, the horizontal reduction is done once per output
+float row_dot_u8(const uint8_t* w,
+                 const int8_t* a,
+                 const float* a_scales,
+                 const float* w_scales,
+                 size_t groups,
+                 size_t group_size) {
+#if defined(HAVE_AVX512F)
+    auto vsum = _mm512_setzero_ps();
+    for (size_t g = 0; g < groups; g++) {
+        auto acc = _mm512_setzero_si512();
+        for (size_t i = g * group_size; i < (g + 1) * group_size; i += 32) {
+            auto vw = _mm512_cvtepu8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(w + i)));
+            auto va = _mm512_cvtepi8_epi16(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(a + i)));
+            acc = _mm512_add_epi32(acc, _mm512_madd_epi16(vw, va));
+        }
+        vsum = _mm512_fmadd_ps(_mm512_cvtepi32_ps(acc), _mm512_set1_ps(a_scales[g] * w_scales[g]), vsum);
+    }
+    return _mm512_reduce_add_ps(vsum);
+#elif defined(HAVE_AVX2)
+    auto vsum = _mm256_setzero_ps();
+    for (size_t g = 0; g < groups; g++) {
+        auto acc = _mm256_setzero_si256();
+        for (size_t i = g * group_size; i < (g + 1) * group_size; i += 16) {
+            acc = dot_u8_16(w + i, a + i, acc);
+        }
+        vsum = _mm256_fmadd_ps(_mm256_cvtepi32_ps(acc), _mm256_set1_ps(a_scales[g] * w_scales[g]), vsum);
+    }
+    hsum(vsum);
+    return _mm256_cvtss_f32(vsum);
+#else
+    float sum = 0.0F;
+    for (size_t g = 0; g < groups; g++) {
+        int32_t acc = 0;
+        for (size_t i = g * group_size; i < (g + 1) * group_size; i++) {
+            acc += static_cast<int32_t>(w[i]) * a[i];
+        }
+        sum += static_cast<float>(acc) * a_scales[g] * w_scales[g];
+    }
+    return sum;
+#endif
+}
+
+float row_dot_u4(const uint8_t* w,
+                 const int8_t* a,
+                 const float* a_scales,
+                 const float* w_scales,
+                 size_t groups,
+                 size_t group_size) {
+#if defined(HAVE_AVX2) || defined(HAVE_AVX512F)
+    auto vsum = _mm256_setzero_ps();
+    for (size_t g = 0; g < groups; g++) {
+        auto acc = _mm256_setzero_si256();
+        for (size_t i = g * group_size; i < (g + 1) * group_size; i += 32) {
+            acc = dot_u4_32(w + i / 2, a + i, acc);
+        }
+        vsum = _mm256_fmadd_ps(_mm256_cvtepi32_ps(acc), _mm256_set1_ps(a_scales[g] * w_scales[g]), vsum);
+    }
+    hsum(vsum);
+    return _mm256_cvtss_f32(vsum);
+#else
+    float sum = 0.0F;
+    for (size_t g = 0; g < groups; g++) {
+        int32_t acc = 0;
+        for (size_t i = g * group_size; i < (g + 1) * group_size; i += 32) {
+            for (size_t j = 0; j < 16; j++) {
+                const auto byte = w[i / 2 + j];
+                acc += static_cast<int32_t>(byte & 0x0F) * a[i + j] + static_cast<int32_t>(byte >> 4) * a[i + 16 + j];
+            }
+        }
+        sum += static_cast<float>(acc) * a_scales[g] * w_scales[g];
+    }
+    return sum;
+#endif
+}
+
+// returns the sum of the quantized values of the group
+int32_t quantize_group(const float* src, int8_t* dst, size_t size, float& scale) {
+    float amax = 0.0F;
+    size_t i = 0;
+#if defined(HAVE_AVX512F)
+    auto vmax = _mm512_setzero_ps();
+    for (; i + 16 <= size; i += 16) {
+        vmax = _mm512_max_ps(vmax, _mm512_abs_ps(_mm512_loadu_ps(src + i)));
+    }
+    amax = _mm512_reduce_max_ps(vmax);
+#elif defined(HAVE_AVX2)
+    const auto sign = _mm256_set1_ps(-0.0F);
+    auto vmax = _mm256_setzero_ps();
+    for (; i + 8 <= size; i += 8) {
+        vmax = _mm256_max_ps(vmax, _mm256_andnot_ps(sign, _mm256_loadu_ps(src + i)));
+    }
+    hmax(vmax);
+    amax = _mm256_cvtss_f32(vmax);
+#endif
+    for (; i < size; i++) {
+        amax = std::max(amax, std::abs(src[i]));
+    }
+
+    scale = amax / 127.0F;
+    const float inv_scale = amax > 0.0F ? 127.0F / amax : 0.0F;
+    int32_t sum = 0;
+    i = 0;
+#if defined(HAVE_AVX512F)
+    const auto vinv = _mm512_set1_ps(inv_scale);
+    auto vsum = _mm512_setzero_si512();
+    for (; i + 16 <= size; i += 16) {
+        auto q = _mm512_cvtps_epi32(_mm512_mul_ps(_mm512_loadu_ps(src + i), vinv));
+        vsum = _mm512_add_epi32(vsum, q);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm512_cvtsepi32_epi8(q));
+    }
+    sum = _mm512_reduce_add_epi32(vsum);
+#elif defined(HAVE_AVX2)
+    const auto vinv = _mm256_set1_ps(inv_scale);
+    // restores the order of the elements after the in-lane packs
+    const auto order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    auto vsum = _mm256_setzero_si256();
+    for (; i + 32 <= size; i += 32) {
+        auto q0 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i), vinv));
+        auto q1 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i + 8), vinv));
+        auto q2 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i + 16), vinv));
+        auto q3 = _mm256_cvtps_epi32(_mm256_mul_ps(_mm256_loadu_ps(src + i + 24), vinv));
+        vsum = _mm256_add_epi32(vsum, _mm256_add_epi32(_mm256_add_epi32(q0, q1), _mm256_add_epi32(q2, q3)));
+        auto q = _mm256_packs_epi16(_mm256_packs_epi32(q0, q1), _mm256_packs_epi32(q2, q3));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i), _mm256_permutevar8x32_epi32(q, order));
+    }
+    auto sum128 = _mm_add_epi32(_mm256_castsi256_si128(vsum), _mm256_extracti128_si256(vsum, 1));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, _MM_SHUFFLE(1, 0, 3, 2)));
+    sum128 = _mm_add_epi32(sum128, _mm_shuffle_epi32(sum128, _MM_SHUFFLE(2, 3, 0, 1)));
+    sum = _mm_cvtsi128_si32(sum128);
+#endif
+    for (; i < size; i++) {
+        const auto q = std::clamp(static_cast<int32_t>(std::nearbyint(src[i] * inv_scale)), -127, 127);
+        dst[i] = static_cast<int8_t>(q);
+        sum += q;
+    }
+    return sum;
+}
+
+}  // namespace
+
+void dyn_quant_fc_quantize_src(const float* src,
+                               size_t src_stride,
+                               int8_t* dst,
+                               float* scales,
+                               int32_t* sums,
+                               size_t M,
+                               size_t K,
+                               size_t group_size) {
+    const size_t groups = K / group_size;
+    for (size_t m = 0; m < M; m++) {
+        for (size_t g = 0; g < groups; g++) {
+            const auto idx = m * groups + g;
+            sums[idx] = quantize_group(src + m * src_stride + g * group_size,
+                                       dst + m * K + g * group_size,
+                                       group_size,
+                                       scales[idx]);
+        }
+    }
+}
+
+void dyn_quant_fc_kernel(const int8_t* src,
+                         const float* src_scales,
+                         const int32_t* src_sums,
+                         size_t M,
+                         const uint8_t* weights,
+                         bool weights_u4,
+                         const float* weights_scales,
+                         const float* weights_zps,
+                         const float* bias,
+                         float* dst,
+                         size_t dst_stride,
+                         size_t n_begin,
+                         size_t n_end,
+                         size_t K,
+                         size_t group_size) {
+    const size_t groups = K / group_size;
+    const size_t row_bytes = weights_u4 ? K / 2 : K;
+    for (size_t n = n_begin; n < n_end; n++) {
+        const auto* w = weights + n * row_bytes;
+        const auto* w_scales = weights_scales + n * groups;
+        const auto* w_zps = weights_zps + n * groups;
+        // the weights row stays in L1 while it is multiplied by all the activation rows
+        for (size_t m = 0; m < M; m++) {
+            const auto* a = src + m * K;
+            const auto* a_scales = src_scales + m * groups;
+            const auto* a_sums = src_sums + m * groups;
+            float result = weights_u4 ? row_dot_u4(w, a, a_scales, w_scales, groups, group_size)
+                                      : row_dot_u8(w, a, a_scales, w_scales, groups, group_size);
+            // sum((w - zp) * a) = sum(w * a) - zp * sum(a)
+            for (size_t g = 0; g < groups; g++) {
+                result -= a_scales[g] * w_scales[g] * w_zps[g] * static_cast<float>(a_sums[g]);
+            }
+            dst[m * dst_stride + n] = bias ? result + bias[n] : result;
+        }
+    }
+}
+
+}  // namespace ov::Extensions::Cpu::XARCH
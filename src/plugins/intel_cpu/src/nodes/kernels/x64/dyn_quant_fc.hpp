@@ -0,0 +1,51 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace ov::Extensions::Cpu::XARCH {
+
+/**
+ * @brief Quantizes the f32 activations [M, K] to i8 symmetrically per group of group_size columns.
+ *
+ * The group scales [M, K / group_size] and the sums of the quantized values of every group (to apply the weights zero
+ * points after the integer dot product) are stored to the scales and sums.
+ */
+void dyn_quant_fc_quantize_src(const float* src,
+                               size_t src_stride,
+                               int8_t* dst,
+                               float* scales,
+                               int32_t* sums,
+                               size_t M,
+                               size_t K,
+                               size_t group_size);
+
+/**
+ * @brief Computes the output channels [n_begin, n_end) of the fully connected layer with the activations quantized
+ * by dyn_quant_fc_quantize_src and the unsigned weights [N, K].
+ *
+ * The u8 weights are stored row by row. The u4 weights are packed by the chunks of 32 elements of a row: the low
+ * nibbles of 16 bytes hold the first 16 elements of the chunk and the high nibbles hold the other 16 ones.
+ * The weights scales and zero points are expanded to the activation groups: [N, K / group_size].
+ */
+void dyn_quant_fc_kernel(const int8_t* src,
+                         const float* src_scales,
+                         const int32_t* src_sums,
+                         size_t M,
+                         const uint8_t* weights,
+                         bool weights_u4,
+                         const float* weights_scales,
+                         const float* weights_zps,
+                         const float* bias,
+                         float* dst,
+                         size_t dst_stride,
+                         size_t n_begin,
+                         size_t n_end,
+                         size_t K,
+                         size_t group_size);
+
+}  // namespace ov::Extensions::Cpu::XARCH
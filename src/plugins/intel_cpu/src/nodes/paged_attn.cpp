@@ -4,6 +4,7 @@
 
 #include "paged_attn.h"
 
+#include <chrono>
 #include <common/utils.hpp>
 #include <cstddef>
 #include <cstdint>
@@ -28,6 +29,7 @@
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/paged_attention.hpp"
+#include "openvino/runtime/profiling_info.hpp"
 #include "openvino/runtime/system_conf.hpp"
 #include "shape_inference/shape_inference_internal_dyn.hpp"
 #include "transformations/utils/utils.hpp"
@@ -280,8 +282,9 @@ void PagedAttention::createPrimitive() {
     auto kCachePrecision = getOriginalInputPrecisionAtPort(PagedAttentionExecutor::ID_KCACHE);
     auto vCachePrecision = getOriginalInputPrecisionAtPort(PagedAttentionExecutor::ID_VCACHE);
     const auto& cpuConfig = context->getConfig();
-    bool quantKeybyChannel = isQuantByChannel(cpuConfig.keyCacheQuantMode, cpuConfig.keyCachePrecision, true);
-    bool quantValuebyChannel = isQuantByChannel(cpuConfig.valueCacheQuantMode, cpuConfig.valueCachePrecision, false);
+    // the cache precisions may differ per layer, so the ones of the cache inputs are used
+    bool quantKeybyChannel = isQuantByChannel(cpuConfig.keyCacheQuantMode, kCachePrecision, true);
+    bool quantValuebyChannel = isQuantByChannel(cpuConfig.valueCacheQuantMode, vCachePrecision, false);
 
     PagedAttentionKey key = {rtPrecision,
                              kCachePrecision,
@@ -374,11 +377,12 @@ void PagedAttention::execute([[maybe_unused]] const dnnl::stream& strm) {
         // For by-channel quantized caches, dim[2] includes parameter header rows
         // (scales/zps). Subtract them to get the actual PA block_size.
         const auto& cpuConfig = context->getConfig();
-        bool quantKeybyChannel = isQuantByChannel(cpuConfig.keyCacheQuantMode, cpuConfig.keyCachePrecision, true);
+        const auto kCachePrecision = getOriginalInputPrecisionAtPort(K_CACHE_IDX);
+        bool quantKeybyChannel = isQuantByChannel(cpuConfig.keyCacheQuantMode, kCachePrecision, true);
         size_t block_size = inputs[K_CACHE_IDX]->getStaticDims()[2];
-        if (quantKeybyChannel && cpuConfig.keyCachePrecision.is_integral()) {
-            size_t params_count = (cpuConfig.keyCachePrecision == ov::element::i8) ? 1 : 2;
-            size_t key_sub_byte_mult = (cpuConfig.keyCachePrecision == ov::element::u4) ? 2 : 1;
+        if (quantKeybyChannel && kCachePrecision.is_integral()) {
+            size_t params_count = (kCachePrecision == ov::element::i8) ? 1 : 2;
+            size_t key_sub_byte_mult = (kCachePrecision == ov::element::u4) ? 2 : 1;
             size_t key_params_size = sizeof(float) * params_count * key_sub_byte_mult;
             block_size -= key_params_size;
         }
@@ -408,7 +412,40 @@ void PagedAttention::execute([[maybe_unused]] const dnnl::stream& strm) {
         }
     }
 
-    m_executor->execute(inputs, outputs, m_write_kv_cache);
+    const auto& config = context->getConfig();
+    if (!config.collectPerfCounters || !config.collectStagePerfCounters) {
+        m_executor->execute(inputs, outputs, m_write_kv_cache, nullptr);
+        return;
+    }
+
+    m_lastPerfStats = {};
+    m_executor->execute(inputs, outputs, m_write_kv_cache, &m_lastPerfStats);
+    m_hasPerfStats = true;
+}
+
+void PagedAttention::appendStagePerfCounters(std::vector<ov::ProfilingInfo>& perfMap) const {
+    if (!m_hasPerfStats) {
+        return;
+    }
+    // the stages of the last execution are reported as "<node>/<stage>"; the prefill and decode entries are the thread
+    // times of the attention loop, they have no own wall time
+    auto append = [&](const std::string& stage, uint64_t real_time, uint64_t cpu_time) {
+        ov::ProfilingInfo pc;
+        pc.node_name = getName() + "/" + stage;
+        pc.node_type = "PagedAttentionStage";
+        pc.exec_type = getPrimitiveDescriptorType();
+        pc.real_time = std::chrono::microseconds(real_time);
+        pc.cpu_time = std::chrono::microseconds(cpu_time);
+        pc.status = (real_time + cpu_time) > 0 ? ov::ProfilingInfo::Status::EXECUTED
+                                               : ov::ProfilingInfo::Status::NOT_RUN;
+        perfMap.emplace_back(pc);
+    };
+    const auto& stats = m_lastPerfStats;
+    append("kv_cache_update", stats.kv_cache_update, stats.kv_cache_update);
+    append("kv_reorder", stats.kv_reorder, stats.kv_reorder);
+    append("attention", stats.attention, stats.prefill + stats.decode);
+    append("attention_prefill", 0, stats.prefill);
+    append("attention_decode", 0, stats.decode);
 }
 
 bool PagedAttention::isSupportedOperation(const std::shared_ptr<const ov::Node>& op,
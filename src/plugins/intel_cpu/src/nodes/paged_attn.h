@@ -7,6 +7,7 @@
 #include <memory>
 #include <oneapi/dnnl/dnnl_common.hpp>
 #include <string>
+#include <vector>
 
 #include "config.h"
 #include "cpu_types.h"
@@ -15,6 +16,7 @@
 #include "nodes/kernels/scaled_attn/executor_pa_common.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/profiling_info.hpp"
 
 namespace ov::intel_cpu::node {
 
@@ -48,6 +50,7 @@ public:
     void initSupportedPrimitiveDescriptors() override;
     void execute(const dnnl::stream& strm) override;
     void createPrimitive() override;
+    void appendStagePerfCounters(std::vector<ov::ProfilingInfo>& perfMap) const override;
     static bool isSupportedOperation(const std::shared_ptr<const ov::Node>& op, std::string& errorMessage) noexcept;
 
     static bool isQuantByChannel(Config::CacheQuantMode mode, ov::element::Type precision, bool isKey);
@@ -65,6 +68,10 @@ private:
     bool m_hasScore = false;
     bool m_has_adaptive_rkv_diversity_output = false;
     bool m_write_kv_cache = true;
+
+    // latency breakdown of the last execution, collected with the stage performance counters enabled only
+    ov::Extensions::Cpu::PagedAttentionPerfStats m_lastPerfStats;
+    bool m_hasPerfStats = false;
 };
 
 }  // namespace ov::intel_cpu::node
@@ -76,6 +76,20 @@ static std::vector<int> allocate_workers(const std::vector<int>& grouped_works,
     return g_workers;
 }
 
+// rotate-half RoPE applied in place to the f32 accumulation of a head
+static void rope_rotate_half(float* x,
+                             const float* cos,
+                             const float* sin,
+                             size_t half_rotary_dims,
+                             size_t cos_sin_offset) {
+    for (size_t i = 0; i < half_rotary_dims; i++) {
+        auto x0 = x[i];
+        auto x1 = x[i + half_rotary_dims];
+        x[i] = cos[i] * x0 - sin[i] * x1;
+        x[i + half_rotary_dims] = cos[i + cos_sin_offset] * x1 + sin[i + cos_sin_offset] * x0;
+    }
+}
+
 template <typename T>
 struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
     std::vector<Work> works;
@@ -114,7 +128,10 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
         auto create_works = [&](void* pw, int output_id, int N, int valid_nthr) {
             // split task on more cores is better on TBB
             OPENVINO_ASSERT((N % REG_BLK_N_SIZE) == 0);
-            auto num_blk_N = N / REG_BLK_N_SIZE;
+            // the fused RoPE needs the whole heads in every work
+            const bool with_rope = m_node->m_config.rope_head_size > 0 && output_id < 2;
+            const int blk_n_size = with_rope ? m_node->m_config.rope_head_size : REG_BLK_N_SIZE;
+            auto num_blk_N = N / blk_n_size;
             auto blkN_per_thread = (num_blk_N) / valid_nthr;
             auto blkN_leftover = num_blk_N - (blkN_per_thread * valid_nthr);
             auto start_blkN = 0;
@@ -128,9 +145,9 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
                 if (blkN) {
                     auto& work = works[cur_work_id++];
                     work.blk_K_size = cache_blk_k_size;
-                    work.n0 = (start_blkN)*REG_BLK_N_SIZE;
-                    work.n1 = (start_blkN + blkN) * REG_BLK_N_SIZE;
-                    work.BN = blkN * REG_BLK_N_SIZE;
+                    work.n0 = (start_blkN)*blk_n_size;
+                    work.n1 = (start_blkN + blkN) * blk_n_size;
+                    work.BN = blkN * blk_n_size;
                     work.k0 = 0;
                     work.k1 = cache_blk_k_size * num_blk_K;
                     work.output_id = output_id;
@@ -258,6 +275,37 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
         auto stride_dst_1 = dstStrides1[1];
         auto stride_dst_2 = dstStrides2[1];
 
+        // the q & k outputs are [B, H, L, S] with the fused RoPE
+        const bool with_rope = m_node->m_config.rope_head_size > 0;
+        PlainTensor t_cos;
+        PlainTensor t_sin;
+        T* rope_dst[2] = {dst0, dst1};
+        size_t rope_heads[2] = {};
+        size_t seq_len = 0;
+        size_t head_size = 0;
+        size_t half_rotary_dims = 0;
+        size_t cos_sin_offset = 0;
+        if (with_rope) {
+            const auto cos_port = m_node->m_config.quantized ? 7 : 4;
+            t_cos.reset(m_node->getSrcMemoryAtPort(cos_port));
+            t_sin.reset(m_node->getSrcMemoryAtPort(cos_port + 1));
+            // the tables are [B or 1, 1, L, cos_sin_ndims] as for the RoPE node
+            if (t_cos.m_rank == 2) {
+                t_cos = t_cos.reshape({1, 1, t_cos.size(0), t_cos.size(1)});
+                t_sin = t_sin.reshape({1, 1, t_sin.size(0), t_sin.size(1)});
+            } else if (t_cos.m_rank == 3) {
+                t_cos = t_cos.reshape({1, t_cos.size(0), t_cos.size(1), t_cos.size(2)});
+                t_sin = t_sin.reshape({1, t_sin.size(0), t_sin.size(1), t_sin.size(2)});
+            }
+            seq_len = ishape[1];
+            head_size = m_node->m_config.rope_head_size;
+            half_rotary_dims = m_node->m_config.rope_rotary_ndims / 2;
+            const auto cos_sin_ndims = static_cast<size_t>(m_node->m_config.rope_cos_sin_ndims);
+            cos_sin_offset = (cos_sin_ndims == half_rotary_dims) ? 0 : half_rotary_dims;
+            rope_heads[0] = m_node->m_config.proj_size0 / head_size;
+            rope_heads[1] = m_node->m_config.proj_size1 / head_size;
+        }
+
         auto asym = true;
         for (int m = 0; m < M;) {
             int BM = std::min(M - m, CACHE_BLK_M_SIZE);
@@ -315,8 +363,44 @@ struct QKVProjection::Executor : public QKVProjection::ExecutorBase {
                                                                                w_scale[work.output_id] + work.n0,
                                                                                asym);
                     }
-                    // compress accumulation result into target
-                    jit_cvt.call(src, stride_src, dst, stride_dst, BM, work.BN);
+                    // @todo quantize k & v to the cache precision and append them to the KV cache of the stateful
+                    // SDPA here, which needs the cache memory to be resized before this node is executed
+                    if (with_rope && work.output_id < 2) {
+                        // the rows of the block are split by the batches, the tokens of a batch are contiguous in
+                        // every head of the destination
+                        for (int i = 0; i < BM;) {
+                            const auto b = static_cast<size_t>(m + i) / seq_len;
+                            const auto l0 = static_cast<size_t>(m + i) % seq_len;
+                            const int rows = std::min(BM - i, static_cast<int>(seq_len - l0));
+                            for (int r = 0; r < rows; r++) {
+                                const auto* cos = &t_cos.at<float>({b, 0, l0 + r, 0}, true);
+                                const auto* sin = &t_sin.at<float>({b, 0, l0 + r, 0}, true);
+                                for (int n = 0; n < work.BN; n += static_cast<int>(head_size)) {
+                                    rope_rotate_half(src + (i + r) * stride_src + n,
+                                                     cos,
+                                                     sin,
+                                                     half_rotary_dims,
+                                                     cos_sin_offset);
+                                }
+                            }
+                            for (int n = 0; n < work.BN; n += static_cast<int>(head_size)) {
+                                const auto h = (work.n0 + n) / head_size;
+                                const auto heads = rope_heads[work.output_id];
+                                auto* dst_head =
+                                    rope_dst[work.output_id] + ((b * heads + h) * seq_len + l0) * head_size;
+                                jit_cvt.call(src + i * stride_src + n,
+                                             stride_src,
+                                             dst_head,
+                                             head_size,
+                                             rows,
+                                             static_cast<int>(head_size));
+                            }
+                            i += rows;
+                        }
+                    } else {
+                        // compress accumulation result into target
+                        jit_cvt.call(src, stride_src, dst, stride_dst, BM, work.BN);
+                    }
                 }
             });
             m += BM;
@@ -435,6 +519,12 @@ void QKVProjection::initSupportedPrimitiveDescriptors() {
         outPortConfigs.emplace_back(LayoutType::ncsp, rtPrecision, getOutputShapeAtPort(2), false, -1);
     }
 
+    if (m_config.rope_head_size > 0) {
+        const auto cos_port = inPortConfigs.size();
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(cos_port), false, -1);
+        inPortConfigs.emplace_back(LayoutType::ncsp, ov::element::f32, getInputShapeAtPort(cos_port + 1), false, -1);
+    }
+
     addSupportedPrimDesc(inPortConfigs, outPortConfigs, impl_desc_type::ref_any);
 }
 
@@ -488,6 +578,10 @@ bool QKVProjection::isSupportedOperation([[maybe_unused]] const std::shared_ptr<
                 errorMessage = "QKVProjection 3rd proj output channel size is not multiple of register blocking size";
                 return false;
             }
+            if ((config.rope_head_size % REG_BLK_N_SIZE) != 0) {
+                errorMessage = "QKVProjection fused RoPE head size is not multiple of register blocking size";
+                return false;
+            }
         } else {
             errorMessage = "Only QKVProjection operation is supported";
             return false;
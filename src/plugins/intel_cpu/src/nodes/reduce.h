@@ -112,6 +112,9 @@ public:
     void prepareParams() override;
     void createPrimitive() override;
     bool created() const override;
+    bool canReuseInferredShapes() const override {
+        return true;
+    }
     void execute(const dnnl::stream& strm) override;
     void executeDynamicImpl(const dnnl::stream& strm) override;
     int getFusingAxis() const override;
@@ -21,6 +21,9 @@ public:
     void getSupportedDescriptors() override;
     void initSupportedPrimitiveDescriptors() override;
     [[nodiscard]] bool created() const override;
+    [[nodiscard]] bool canReuseInferredShapes() const override {
+        return true;
+    }
     [[nodiscard]] bool neverExecute() const override;
     [[nodiscard]] bool isExecutable() const override;
 
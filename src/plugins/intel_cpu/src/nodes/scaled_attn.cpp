@@ -13,6 +13,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <memory>
+#include <numeric>
 #include <oneapi/dnnl/dnnl.hpp>
 #include <oneapi/dnnl/dnnl_common.hpp>
 
@@ -40,6 +41,7 @@
 #include "shape_inference/custom/scaled_attn.hpp"
 #include "transformations/cpu_opset/common/op/sdpa.hpp"
 #include "utils/general_utils.h"
+#include "utils/kv_cache_precision_policy.hpp"
 #include "utils/plain_tensor.hpp"
 
 #if defined(OPENVINO_ARCH_X86_64) || defined(OPENVINO_ARCH_X86)
@@ -1843,14 +1845,24 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
         OPENVINO_THROW_NOT_IMPLEMENTED(errorMessage);
     }
     const auto& cpuConfig = context->getConfig();
-    const auto& keyCachePrecision = cpuConfig.keyCachePrecision;
-    const auto& valueCachePrecision = cpuConfig.valueCachePrecision;
+    // the per layer precisions (see ApplyKVCachePrecisionPolicy) override the model-wide ones
+    const auto& rtInfo = op->get_rt_info();
+    auto cacheHint = [&](const char* rtKey, const KVCachePrecision& modelHint) {
+        const auto it = rtInfo.find(rtKey);
+        return it == rtInfo.end() ? modelHint : KVCachePrecision::parse(it->second.as<std::string>());
+    };
+    m_key_cache_hint =
+        cacheHint(KEY_CACHE_PRECISION_RT_INFO, {cpuConfig.keyCachePrecision, cpuConfig.keyCacheQuantAlg});
+    m_value_cache_hint =
+        cacheHint(VALUE_CACHE_PRECISION_RT_INFO, {cpuConfig.valueCachePrecision, cpuConfig.valueCacheQuantAlg});
+    const auto& keyCachePrecision = m_key_cache_hint.precision;
+    const auto& valueCachePrecision = m_value_cache_hint.precision;
     const auto keyDims = getInputShapeAtPort(1).getDims();
     const auto valueDims = getInputShapeAtPort(2).getDims();
     const auto keyS = *(keyDims.end() - 1);
     const auto valueS = *(valueDims.end() - 1);
-    const bool is_turbo_key = cpuConfig.keyCacheQuantAlg == ov::internal::CacheQuantAlgorithm::TURBO;
-    const bool is_turbo_value = cpuConfig.valueCacheQuantAlg == ov::internal::CacheQuantAlgorithm::TURBO;
+    const bool is_turbo_key = m_key_cache_hint.alg == ov::internal::CacheQuantAlgorithm::TURBO;
+    const bool is_turbo_value = m_value_cache_hint.alg == ov::internal::CacheQuantAlgorithm::TURBO;
     if (is_turbo_key || is_turbo_value) {
         if (is_turbo_key) {
             CPU_NODE_ASSERT(any_of(keyCachePrecision, ov::element::u3, ov::element::u4),
@@ -1901,9 +1913,11 @@ ScaledDotProductAttention::ScaledDotProductAttention(const std::shared_ptr<ov::N
         m_config.config = node->get_config();
     }
 
-    m_key_spec.alg = cpuConfig.keyCacheQuantAlg;
-    m_value_spec.alg = cpuConfig.valueCacheQuantAlg;
+    m_key_spec.alg = m_key_cache_hint.alg;
+    m_value_spec.alg = m_value_cache_hint.alg;
     m_key_spec.by_channel = cpuConfig.keyCacheQuantMode == ov::intel_cpu::Config::CacheQuantMode::BY_CHANNEL;
+    m_kv_cache_window_size = cpuConfig.kvCacheWindowSize;
+    m_kv_cache_sink_size = cpuConfig.kvCacheSinkSize;
 }
 
 void ScaledDotProductAttention::initSupportedPrimitiveDescriptors() {
@@ -2031,6 +2045,15 @@ void ScaledDotProductAttention::createPrimitive() {
         m_value_spec.precision = m_config.config.fuse_concat ? getValueCachePrecision() : rtPrecision;
     }
 
+    // the by-channel quantized states can only drop the whole quantization groups, so the sink is rounded up to them
+    size_t sink_align = 1;
+    for (const auto* spec : {&m_key_spec, &m_value_spec}) {
+        if (spec->by_channel && any_of(spec->precision, ov::element::u8, ov::element::u4)) {
+            sink_align = std::lcm(sink_align, spec->group_size);
+        }
+    }
+    m_kv_cache_sink_size = rnd_up(cpuConfig.kvCacheSinkSize, sink_align);
+
     ScaledDotProductAttentionKey key = {rtPrecision};
 
     auto builder = [&]([[maybe_unused]] const ScaledDotProductAttentionKey& key) -> std::shared_ptr<Executor> {
@@ -2152,6 +2175,9 @@ void ScaledDotProductAttention::execute(const dnnl::stream& strm) {
         presentk_input = m_k_state->internal_state_mem();
         presentv_input = m_v_state->internal_state_mem();
         beam_input = m_k_state->hidden_state_mem();
+        if (m_kv_cache_window_size > 0 && orginSDPInputNumber > 3) {
+            inputs[3] = compactAttnMask(inputs[3], beam_input->getStaticDims()[1]);
+        }
         k_scale_zp = m_k_state->get_scale_zp();
         v_scale_zp = m_v_state->get_scale_zp();
     } else {
@@ -2575,10 +2601,100 @@ void ScaledDotProductAttention::gatherConcatPastkv(const MemoryPtr& mem_cur_k,
         return;
     }
 
+    if (m_kv_cache_window_size > 0 && !m_k_state->is_reset_state() && !m_v_state->is_reset_state()) {
+        evictPastkv(L1);
+    }
     updateBeamTable(mem_beam_idx, L1);
     updatePastkv(mem_cur_k, mem_cur_v);
 }
 
+// Keeps the sink tokens and the last tokens of the window in the cache. The tokens are evicted in batches (when the
+// window is overflowed by a quarter) to amortize the moves of the kept tokens, the order of the tokens is preserved,
+// so the causal masking and the beam table need no remapping.
+void ScaledDotProductAttention::evictPastkv(size_t L1) {
+    const auto inputNumber = getOriginalInputsNumber();
+    const auto k_mem = getSrcMemoryAtPort(inputNumber - 2);
+    const auto v_mem = getSrcMemoryAtPort(inputNumber - 1);
+    std::vector<size_t> order = {0, 1, 2, 3};
+    if (!m_config.config.permute_axes.empty()) {
+        order = m_config.config.permute_axes;
+    }
+    const size_t L0 = v_mem->getStaticDims().at(order[2]);
+    const size_t sink = m_kv_cache_sink_size;
+    const size_t window = m_kv_cache_window_size;
+    if (L0 <= sink || L0 + L1 <= sink + window + window / 4) {
+        return;
+    }
+    // the by-channel quantized cache can only drop the whole quantization groups
+    size_t align = 1;
+    for (const auto& state : {m_k_state, m_v_state}) {
+        if (state->get_spec().by_channel) {
+            align = std::lcm(align, state->get_spec().group_size);
+        }
+    }
+    // the sink is rounded up to the quantization groups in createPrimitive()
+    CPU_NODE_ASSERT(sink % align == 0, "KV cache sink size ", sink, " is not aligned to the quantization groups");
+    const size_t keep = window > L1 ? std::min(window - L1, L0 - sink) : 0;
+    size_t count = L0 - sink - keep;
+    count -= count % align;
+    if (count == 0) {
+        return;
+    }
+
+    m_k_state->evict(sink, count);
+    m_v_state->evict(sink, count);
+    // the norms of the TurboQuant caches are [B, H, L, 1]
+    for (auto* meta_data : {&m_k_quant_meta_data, &m_v_quant_meta_data}) {
+        if (!*meta_data) {
+            continue;
+        }
+        for (size_t b = 0; b < meta_data->size(0); b++) {
+            for (size_t h = 0; h < meta_data->size(1); h++) {
+                std::memmove(meta_data->ptr<float>(b, h, sink),
+                             meta_data->ptr<float>(b, h, sink + count),
+                             sizeof(float) * (L0 - sink - count));
+            }
+        }
+    }
+    // the past kv inputs are the views of the states, so the following updates see the compacted length
+    for (const auto& mem : {k_mem, v_mem}) {
+        auto dims = mem->getStaticDims();
+        dims[order[2]] = L0 - count;
+        mem->redefineDesc(mem->getDescPtr()->cloneWithNewDims(dims));
+    }
+}
+
+MemoryPtr ScaledDotProductAttention::compactAttnMask(const MemoryPtr& mask, size_t kv_len) {
+    const auto& dims = mask->getStaticDims();
+    if (dims.empty() || dims.back() <= kv_len) {
+        return mask;
+    }
+    // the mask still covers the whole sequence: the sink tokens and the last kv_len - sink tokens are kept
+    const size_t mask_len = dims.back();
+    const size_t sink = std::min(m_kv_cache_sink_size, kv_len);
+    const size_t rows = mask->getShape().getElementsCount() / mask_len;
+    const size_t elem_size = mask->getPrecision().size();
+    auto compact_dims = dims;
+    compact_dims.back() = kv_len;
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(mask->getPrecision(), Shape(compact_dims));
+    if (!m_compact_attn_mask) {
+        m_compact_attn_mask = std::make_shared<Memory>(getEngine(), desc);
+    } else {
+        m_compact_attn_mask->redefineDesc(desc);
+    }
+    const auto* src = mask->getDataAs<const uint8_t>();
+    auto* dst = m_compact_attn_mask->getDataAs<uint8_t>();
+    context->getCpuParallel()->parallel_for(rows, [&](size_t r) {
+        const auto* src_row = src + r * mask_len * elem_size;
+        auto* dst_row = dst + r * kv_len * elem_size;
+        std::memcpy(dst_row, src_row, sink * elem_size);
+        std::memcpy(dst_row + sink * elem_size,
+                    src_row + (mask_len - kv_len + sink) * elem_size,
+                    (kv_len - sink) * elem_size);
+    });
+    return m_compact_attn_mask;
+}
+
 // Update beam table using beam_idx. For first token, beam table is like [[0, 0, 0, ...], [1, 1, 1, ...], ...],
 //   for second token, beam table is updated using gather(beam_table, beam_idx) then appending [0, 1, 2, ...] to the end
 //   for itself.
@@ -2994,8 +3110,8 @@ static ov::element::Type side_cache_precision(bool is_turbo,
 
 ov::element::Type ScaledDotProductAttention::getKeyCachePrecision() {
     const auto rtPrecision = getRuntimePrecision();
-    const auto keyHint = context->getConfig().keyCachePrecision;
-    const auto valueHint = context->getConfig().valueCachePrecision;
+    const auto keyHint = m_key_cache_hint.precision;
+    const auto valueHint = m_value_cache_hint.precision;
     const bool enableKVCacheFP16 = m_config.config.fuse_concat && mayiuse(cpu_isa_t::avx2) &&
                                    rtPrecision != ov::element::bf16 && all_of(ov::element::f16, keyHint, valueHint);
     return side_cache_precision(m_key_spec.alg == ov::internal::CacheQuantAlgorithm::TURBO,
@@ -3006,8 +3122,8 @@ ov::element::Type ScaledDotProductAttention::getKeyCachePrecision() {
 
 ov::element::Type ScaledDotProductAttention::getValueCachePrecision() {
     const auto rtPrecision = getRuntimePrecision();
-    const auto keyHint = context->getConfig().keyCachePrecision;
-    const auto valueHint = context->getConfig().valueCachePrecision;
+    const auto keyHint = m_key_cache_hint.precision;
+    const auto valueHint = m_value_cache_hint.precision;
     const bool enableKVCacheFP16 = m_config.config.fuse_concat && mayiuse(cpu_isa_t::avx2) &&
                                    rtPrecision != ov::element::bf16 && all_of(ov::element::f16, keyHint, valueHint);
     return side_cache_precision(m_value_spec.alg == ov::internal::CacheQuantAlgorithm::TURBO,
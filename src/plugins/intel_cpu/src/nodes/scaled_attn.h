@@ -22,6 +22,7 @@
 #include "openvino/core/node.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "transformations/cpu_opset/common/op/sdpa.hpp"
+#include "utils/kv_cache_precision_policy.hpp"
 #include "utils/plain_tensor.hpp"
 
 namespace ov::intel_cpu::node {
@@ -84,6 +85,10 @@ private:
     void gatherConcatPastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
     void updateBeamTable(const MemoryPtr& mem_beam_idx, size_t L1);
     void updatePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v);
+    // evicts the past tokens out of the sliding window before the L1 new tokens are appended
+    void evictPastkv(size_t L1);
+    // selects the columns of the kept tokens from the attention mask covering the whole sequence
+    MemoryPtr compactAttnMask(const MemoryPtr& mask, size_t kv_len);
     ov::element::Type getRuntimePrecision() const override;
     void resetBeamTablePastkv(const MemoryPtr& mem_cur_k, const MemoryPtr& mem_cur_v, const MemoryPtr& mem_beam_idx);
     // Derive per-thread scratch {base, stride} (f32 slots) from m_per_thread_head_scratch.
@@ -129,12 +134,19 @@ private:
     std::vector<size_t> m_kvstate_layout = {2, 0, 1, 3};
     ov::Extensions::Cpu::CacheSpec m_key_spec;
     ov::Extensions::Cpu::CacheSpec m_value_spec;
+    // cache precisions requested for the layer: the model-wide ones or the ones of the per layer policy
+    KVCachePrecision m_key_cache_hint;
+    KVCachePrecision m_value_cache_hint;
     MemoryPtr m_per_thread_head_scratch;
     // Per-token TBQ norm. Populated only when a side has alg=TURBO; empty otherwise.
     PlainTensor m_k_quant_meta_data;
     PlainTensor m_v_quant_meta_data;
     // Random ±1 sign vector for WHT rotation.
     PlainTensor m_wht_signs;
+    // KV cache eviction: the sink tokens and at least the window of the recent tokens are kept
+    size_t m_kv_cache_window_size = 0;
+    size_t m_kv_cache_sink_size = 0;
+    MemoryPtr m_compact_attn_mask;
 };
 
 }  // namespace ov::intel_cpu::node
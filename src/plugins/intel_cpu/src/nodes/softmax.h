@@ -26,6 +26,9 @@ public:
                           const std::vector<MemoryDescPtr>& outputDesc) override;
     void getSupportedDescriptors() override;
     [[nodiscard]] bool created() const override;
+    [[nodiscard]] bool canReuseInferredShapes() const override {
+        return true;
+    }
     AttrPtr initPrimitiveAttr() override;
     void prepareParams() override;
     void execute(const dnnl::stream& strm) override;
@@ -30,6 +30,9 @@ public:
     void createPrimitive() override;
     void execute(const dnnl::stream& strm) override;
     [[nodiscard]] bool created() const override;
+    [[nodiscard]] bool canReuseInferredShapes() const override {
+        return true;
+    }
     [[nodiscard]] bool canBeInPlace() const override {
         return false;
     }
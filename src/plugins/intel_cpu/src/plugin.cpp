@@ -262,6 +262,12 @@ static bool streamsSet(const ov::AnyMap& config) {
     return config.find(ov::num_streams.name()) != config.end();
 }
 
+static void checkCompiledModelProperties(const ov::AnyMap& config) {
+    OPENVINO_ASSERT(config.find(ov::intel_cpu::cpu_runtime_cache_byte_budget.name()) == config.end(),
+                    ov::intel_cpu::cpu_runtime_cache_byte_budget.name(),
+                    " is a plugin level property, it can be set by ov::Core::set_property only");
+}
+
 void Plugin::get_performance_streams(Config& config, const std::shared_ptr<ov::Model>& model) {
     int streams_set = config.streams;
     int streams = 0;
@@ -370,6 +376,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::compile_model(const std::shared_ptr<
 
     // update the props after the perf mode translated to configs
     // TODO: Clarify the behavior of SetConfig method. Skip eng_config or not?
+    checkCompiledModelProperties(config);
     Config conf = engConfig;
     conf.applyRtInfo(cloned_model);
     conf.readProperties(config, modelType);
@@ -430,6 +437,7 @@ void Plugin::set_property(const ov::AnyMap& config) {
     streamsExplicitlySetForEngine = streamsSet(config);
 
     engConfig.readProperties(config);
+    m_rtCacheBudget->setLimit(engConfig.rtCacheByteBudget);
 }
 
 ov::Any Plugin::get_property(const std::string& name, const ov::AnyMap& options) const {
@@ -808,6 +816,7 @@ std::shared_ptr<ov::ICompiledModel> Plugin::deserialize_model(ModelDeserializer&
         loaded_from_cache = it->second.as<bool>();
         _config.erase(it);
     }
+    checkCompiledModelProperties(_config);
     conf.readProperties(_config, modelType);
 
     // import config props from caching model
@@ -8,6 +8,7 @@
 #include <memory>
 #include <string>
 
+#include "cache/cache_budget.h"
 #include "config.h"
 #include "openvino/core/any.hpp"
 #include "openvino/core/except.hpp"
@@ -62,6 +63,11 @@ public:
         OPENVINO_THROW_NOT_IMPLEMENTED("get_default_context is not supported by CPU plugin!");
     };
 
+    // the byte budget shared by the runtime caches of all the compiled models of the plugin
+    [[nodiscard]] const CacheMemoryBudget::Ptr& getRuntimeCacheBudget() const {
+        return m_rtCacheBudget;
+    }
+
     std::shared_ptr<ov::threading::MessageManager> m_msg_manager;
 
 private:
@@ -78,6 +84,7 @@ private:
     bool streamsExplicitlySetForEngine = false;
     const std::string deviceFullName;
     ov::AnyMap m_compiled_model_runtime_properties;
+    CacheMemoryBudget::Ptr m_rtCacheBudget = std::make_shared<CacheMemoryBudget>();
 
     std::shared_ptr<void> specialSetup;
 };
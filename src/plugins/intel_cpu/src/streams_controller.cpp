@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "streams_controller.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+
+namespace ov::intel_cpu {
+
+std::string StreamsController::Decision::toString() const {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(2) << "streams " << from.streams << "x" << from.threadsPerStream << " -> "
+       << to.streams << "x" << to.threadsPerStream << " at " << std::setprecision(3)
+       << std::chrono::duration<double>(time).count() << " s: queue depth " << std::setprecision(2) << queueDepth
+       << ", utilization " << utilization << ", latency " << latencyMs << " ms";
+    return ss.str();
+}
+
+StreamsController::StreamsController(std::vector<Candidate> candidates,
+                                     size_t current,
+                                     const Settings& settings,
+                                     Clock::time_point now)
+    : m_candidates(std::move(candidates)),
+      m_settings(settings),
+      m_start(now),
+      m_current(current) {
+    OPENVINO_ASSERT(current < m_candidates.size(), "Invalid initial streams configuration index ", current);
+    OPENVINO_ASSERT(m_settings.scaleDownDepthRatio < m_settings.scaleUpDepthRatio,
+                    "Adaptive streams thresholds must not overlap");
+    startWindow(now);
+}
+
+void StreamsController::record(const Sample& sample) {
+    m_samples++;
+    m_queueDepthSum += sample.queueDepth;
+    m_latencySum += sample.latency;
+    m_busyTimeSum += sample.busyTime;
+}
+
+void StreamsController::startWindow(Clock::time_point now) {
+    m_windowStart = now;
+    m_samples = 0;
+    m_queueDepthSum = 0;
+    m_latencySum = std::chrono::microseconds{0};
+    m_busyTimeSum = std::chrono::microseconds{0};
+}
+
+std::optional<size_t> StreamsController::evaluate(Clock::time_point now) {
+    const auto elapsed = now - m_windowStart;
+    if (elapsed < m_settings.window || m_samples < m_settings.minSamples) {
+        return std::nullopt;
+    }
+
+    const auto& current = m_candidates[m_current];
+    const auto streams = static_cast<float>(current.streams);
+    const auto queueDepth = static_cast<float>(m_queueDepthSum) / static_cast<float>(m_samples);
+    const auto utilization = static_cast<float>(std::chrono::duration<double>(m_busyTimeSum).count() /
+                                                (std::chrono::duration<double>(elapsed).count() * streams));
+    const auto latencyMs =
+        static_cast<float>(std::chrono::duration<double, std::milli>(m_latencySum).count() / m_samples);
+    startWindow(now);
+
+    if (m_warmingUp) {
+        m_warmingUp = false;
+        return std::nullopt;
+    }
+
+    int direction = 0;
+    if (queueDepth > streams * m_settings.scaleUpDepthRatio && utilization >= m_settings.saturatedUtilization &&
+        m_current + 1 < m_candidates.size()) {
+        direction = 1;
+    } else if (queueDepth < streams * m_settings.scaleDownDepthRatio && m_current > 0) {
+        direction = -1;
+    }
+
+    if (direction == 0 || (m_trend != 0 && (m_trend > 0) != (direction > 0))) {
+        m_trend = direction;
+    } else {
+        m_trend += direction;
+    }
+
+    if (static_cast<size_t>(m_trend > 0 ? m_trend : -m_trend) < m_settings.stableWindows) {
+        return std::nullopt;
+    }
+
+    const auto next = direction > 0 ? m_current + 1 : m_current - 1;
+    if (m_decisions.size() == maxDecisions) {
+        m_decisions.erase(m_decisions.begin());
+    }
+    m_decisions.push_back({std::chrono::duration_cast<std::chrono::milliseconds>(now - m_start),
+                           current,
+                           m_candidates[next],
+                           queueDepth,
+                           utilization,
+                           latencyMs});
+    m_current = next;
+    m_trend = 0;
+    m_warmingUp = true;
+    return next;
+}
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,125 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Online controller of the streams configuration of a compiled model.
+ *
+ * The controller collects the telemetry of the executed inferences (queue depth, latency and busy time) over
+ * the sampling windows and decides whether the model should switch to a configuration with more streams (the requests
+ * are queued while the cores are saturated) or with fewer wider streams (the streams are mostly idle, so the requests
+ * can use more threads each).
+ *
+ * In order to avoid oscillations the thresholds of the two directions do not overlap, the configuration is changed
+ * only after several consecutive windows agree, by one candidate at a time, and the window following a change is
+ * skipped, since the graphs of the new configuration are warming up.
+ *
+ * @note The controller is not thread safe.
+ */
+class StreamsController {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    struct Candidate {
+        int streams;
+        int threadsPerStream;
+    };
+
+    struct Settings {
+        std::chrono::milliseconds window{1000};
+        // windows with fewer samples are extended
+        size_t minSamples = 16;
+        // number of consecutive windows which must agree before the configuration is changed
+        size_t stableWindows = 3;
+        // more streams are used if the average queue depth exceeds the number of streams by the ratio
+        float scaleUpDepthRatio = 1.5F;
+        // and only if the streams are busy for the given part of the window
+        float saturatedUtilization = 0.8F;
+        // fewer streams are used if the average queue depth is below the given part of the number of streams
+        float scaleDownDepthRatio = 0.5F;
+    };
+
+    struct Sample {
+        // number of the requests in flight when the request was submitted, including the request itself
+        size_t queueDepth;
+        // time from the submission to the completion
+        std::chrono::microseconds latency;
+        // time the request was executed by a stream
+        std::chrono::microseconds busyTime;
+    };
+
+    struct Decision {
+        std::chrono::milliseconds time;  // since the controller creation
+        Candidate from;
+        Candidate to;
+        float queueDepth;
+        float utilization;
+        float latencyMs;
+
+        [[nodiscard]] std::string toString() const;
+    };
+
+    /**
+     * @param candidates configurations to switch between, sorted by the number of streams
+     * @param current index of the initial configuration
+     */
+    StreamsController(std::vector<Candidate> candidates,
+                      size_t current,
+                      const Settings& settings,
+                      Clock::time_point now = Clock::now());
+
+    void record(const Sample& sample);
+
+    /**
+     * @brief Completes the sampling window if it is over
+     * @return Index of the configuration to switch to, if the configuration should be changed
+     */
+    std::optional<size_t> evaluate(Clock::time_point now = Clock::now());
+
+    [[nodiscard]] size_t current() const {
+        return m_current;
+    }
+
+    [[nodiscard]] const std::vector<Candidate>& candidates() const {
+        return m_candidates;
+    }
+
+    [[nodiscard]] const std::vector<Decision>& decisions() const {
+        return m_decisions;
+    }
+
+    // number of the decisions kept for the audit
+    static constexpr size_t maxDecisions = 64;
+
+private:
+    void startWindow(Clock::time_point now);
+
+    const std::vector<Candidate> m_candidates;
+    const Settings m_settings;
+    const Clock::time_point m_start;
+    size_t m_current;
+
+    Clock::time_point m_windowStart;
+    size_t m_samples = 0;
+    uint64_t m_queueDepthSum = 0;
+    std::chrono::microseconds m_latencySum{0};
+    std::chrono::microseconds m_busyTimeSum{0};
+
+    // positive for the consecutive windows asking for more streams, negative for fewer streams
+    int m_trend = 0;
+    bool m_warmingUp = false;
+    std::vector<Decision> m_decisions;
+};
+
+}  // namespace ov::intel_cpu
@@ -0,0 +1,67 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "apply_kv_cache_precision_policy.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+
+#include "openvino/cc/pass/itt.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/core/type.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/op/paged_attention.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/runtime/internal_properties.hpp"
+#include "transformations/cpu_opset/common/op/sdpa.hpp"
+#include "utils/kv_cache_precision_policy.hpp"
+
+namespace ov::intel_cpu {
+
+ApplyKVCachePrecisionPolicy::ApplyKVCachePrecisionPolicy(KVCachePrecisionPolicy policy,
+                                                         QuantByChannelFunc quant_by_channel)
+    : m_policy(std::move(policy)),
+      m_quant_by_channel(std::move(quant_by_channel)) {}
+
+bool ApplyKVCachePrecisionPolicy::run_on_model(const std::shared_ptr<ov::Model>& model) {
+    RUN_ON_MODEL_SCOPE(ApplyKVCachePrecisionPolicy);
+    bool changed = false;
+    size_t layer = 0;
+    for (const auto& op : model->get_ordered_ops()) {
+        const bool is_paged = ov::is_type<ov::op::PagedAttentionExtension>(op);
+        if (!is_paged &&
+            !ov::is_type_any_of<ov::op::v13::ScaledDotProductAttention, ScaledDotProductAttentionWithKVCache>(op)) {
+            continue;
+        }
+        const auto precision = m_policy.get(layer++);
+        auto& rt_info = op->get_rt_info();
+        auto annotate = [&](const std::string& rt_key,
+                            const std::string& by_channel_rt_key,
+                            const std::optional<KVCachePrecision>& policy_precision,
+                            bool is_key) {
+            if (policy_precision && rt_info.count(rt_key) == 0) {
+                rt_info[rt_key] = policy_precision->to_string();
+                changed = true;
+            }
+            if (!is_paged || rt_info.count(rt_key) == 0) {
+                return;
+            }
+            auto cache = KVCachePrecision::parse(rt_info[rt_key].as<std::string>());
+            if (cache.alg == ov::internal::CacheQuantAlgorithm::TURBO) {
+                cache = {ov::element::u4, ov::internal::CacheQuantAlgorithm::SCALAR};
+            }
+            rt_info[rt_key] = cache.to_string();
+            rt_info[by_channel_rt_key] = m_quant_by_channel(cache.precision, is_key);
+            changed = true;
+        };
+        annotate(KEY_CACHE_PRECISION_RT_INFO, "key_cache_quant_bychannel", precision.key, true);
+        annotate(VALUE_CACHE_PRECISION_RT_INFO, "value_cache_quant_bychannel", precision.value, false);
+    }
+    return changed;
+}
+
+}  // namespace ov::intel_cpu
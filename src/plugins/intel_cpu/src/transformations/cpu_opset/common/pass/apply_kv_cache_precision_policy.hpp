@@ -0,0 +1,39 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "openvino/core/model.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/pass/pass.hpp"
+#include "utils/kv_cache_precision_policy.hpp"
+
+namespace ov::intel_cpu {
+
+/**
+ * @brief Annotates the attention operations (SDPA and PagedAttention) with the per layer KV cache precisions of the
+ * policy, the precisions already set in rt_info of an operation are kept.
+ *
+ * The PagedAttention kernels have no TurboQuant implementation, so the TurboQuant precisions are replaced with the
+ * u4 cache for them. The quantization mode of the PagedAttention caches depends on the precision, so it is annotated
+ * as well with the given function.
+ */
+class ApplyKVCachePrecisionPolicy : public ov::pass::ModelPass {
+public:
+    using QuantByChannelFunc = std::function<bool(const ov::element::Type& precision, bool is_key)>;
+
+    OPENVINO_MODEL_PASS_RTTI("ApplyKVCachePrecisionPolicy");
+    ApplyKVCachePrecisionPolicy(KVCachePrecisionPolicy policy, QuantByChannelFunc quant_by_channel);
+
+    bool run_on_model(const std::shared_ptr<ov::Model>& model) override;
+
+private:
+    KVCachePrecisionPolicy m_policy;
+    QuantByChannelFunc m_quant_by_channel;
+};
+
+}  // namespace ov::intel_cpu
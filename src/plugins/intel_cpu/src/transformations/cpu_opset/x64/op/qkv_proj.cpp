@@ -9,6 +9,7 @@
 #include "openvino/core/attribute_visitor.hpp"
 #include "openvino/core/node.hpp"
 #include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
 #include "transformations/itt.hpp"
 
 namespace ov::intel_cpu {
@@ -16,7 +17,7 @@ namespace ov::intel_cpu {
 void QKVProjectionNode::validate_and_infer_types() {
     INTERNAL_OP_SCOPE(QKVProjection_validate_and_infer_types);
     const auto input_size = get_input_size();
-    NODE_VALIDATION_CHECK(this, input_size == (m_config.quantized ? 7 : 4));
+    NODE_VALIDATION_CHECK(this, input_size == rope_cos_port() + (with_rope() ? 2 : 0));
 
     const auto& ishape = get_input_partial_shape(0);
     const auto& itype = get_input_element_type(0);
@@ -31,6 +32,15 @@ void QKVProjectionNode::validate_and_infer_types() {
     oshape0[oshape0.size() - 1] = m_config.proj_size0;
     oshape1[oshape1.size() - 1] = m_config.proj_size1;
     oshape2[oshape2.size() - 1] = m_config.proj_size2;
+    if (with_rope()) {
+        // [B, L, H * S] => [B, H, L, S]
+        const auto head_size = m_config.rope_head_size;
+        NODE_VALIDATION_CHECK(this,
+                              m_config.proj_size0 % head_size == 0 && m_config.proj_size1 % head_size == 0,
+                              "q & k projection sizes must be multiple of the RoPE head size");
+        oshape0 = ov::PartialShape{ishape[0], m_config.proj_size0 / head_size, ishape[1], head_size};
+        oshape1 = ov::PartialShape{ishape[0], m_config.proj_size1 / head_size, ishape[1], head_size};
+    }
 
     set_output_type(0, itype, oshape0);
     set_output_type(1, itype, oshape1);
@@ -52,6 +62,9 @@ bool QKVProjectionNode::visit_attributes(ov::AttributeVisitor& visitor) {
     visitor.on_attribute("proj_size1", m_config.proj_size1);
     visitor.on_attribute("proj_size2", m_config.proj_size2);
     visitor.on_attribute("weights_combined", m_config.weights_combined);
+    visitor.on_attribute("rope_head_size", m_config.rope_head_size);
+    visitor.on_attribute("rope_rotary_ndims", m_config.rope_rotary_ndims);
+    visitor.on_attribute("rope_cos_sin_ndims", m_config.rope_cos_sin_ndims);
     visitor.finish_structure();
     return true;
 }
@@ -26,6 +26,11 @@ public:
         int proj_size1;
         int proj_size2;
         bool weights_combined;
+        // the rotate-half RoPE fused into the q & k projections, which are produced in [B, H, L, S] layout then
+        // (the cos & sin tables are the last inputs), rope_head_size == 0 when the RoPE is not fused
+        int rope_head_size = 0;
+        int rope_rotary_ndims = 0;
+        int rope_cos_sin_ndims = 0;
     };
 
     QKVProjectionNode(const OutputVector& args, const Config& cfg) : Op(args), m_config(cfg) {
@@ -42,6 +47,15 @@ public:
         return m_config;
     }
 
+    bool with_rope() const {
+        return m_config.rope_head_size > 0;
+    }
+
+    // the port of the RoPE cos table, the sin table follows it
+    size_t rope_cos_port() const {
+        return m_config.quantized ? 7 : 4;
+    }
+
 private:
     Config m_config{};
 };
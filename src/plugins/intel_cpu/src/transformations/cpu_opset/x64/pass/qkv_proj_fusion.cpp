@@ -4,6 +4,7 @@
 
 #include "qkv_proj_fusion.hpp"
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
 #include <memory>
@@ -12,13 +13,16 @@
 #include "openvino/cc/pass/itt.hpp"
 #include "openvino/core/model.hpp"
 #include "openvino/core/node_vector.hpp"
+#include "openvino/core/partial_shape.hpp"
 #include "openvino/core/rt_info.hpp"
+#include "openvino/core/symbol.hpp"
 #include "openvino/core/type.hpp"
 #include "openvino/core/type/element_type.hpp"
 #include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/reshape.hpp"
 #include "openvino/op/variadic_split.hpp"
 #include "openvino/pass/matcher_pass.hpp"
 #include "openvino/pass/pattern/matcher.hpp"
@@ -27,6 +31,7 @@
 #include "openvino/pass/pattern/op/pattern.hpp"
 #include "openvino/pass/pattern/op/wrap_type.hpp"
 #include "openvino/util/pp.hpp"
+#include "ov_ops/rotary_positional_embeddings.hpp"
 #include "transformations/cpu_opset/x64/op/qkv_proj.hpp"
 #include "transformations/symbolic_transformations/symbolic_optimizations.hpp"
 
@@ -295,6 +300,112 @@ ov::intel_cpu::QKVProjFusionPass2::QKVProjFusionPass2() {
     this->register_matcher(m, callback);
 }
 
+ov::intel_cpu::QKVProjRoPEFusion::QKVProjRoPEFusion() {
+    MATCHER_SCOPE(QKVProjRoPEFusion);
+
+    auto qkv_proj = pattern::wrap_type<QKVProjectionNode>();
+
+    matcher_pass_callback callback = [OV_CAPTURE_CPY_AND_THIS](ov::pass::pattern::Matcher& m) {
+        auto qkv_node = ov::as_type_ptr<QKVProjectionNode>(m.get_match_root());
+        if (!qkv_node || qkv_node->with_rope()) {
+            return false;
+        }
+
+        const auto& ishape = qkv_node->get_input_partial_shape(0);
+        auto same_dim = [](const ov::Dimension& a, const ov::Dimension& b) {
+            return (a.is_static() && a == b) || ov::symbol::are_equal(a.get_symbol(), b.get_symbol());
+        };
+
+        // the q & k projections must be only consumed by the rotate-half RoPE reading them as [B, L, H, S]
+        std::array<std::shared_ptr<ov::op::internal::RoPE>, 2> ropes;
+        NodeVector fused_nodes{qkv_node};
+        for (size_t i = 0; i < ropes.size(); i++) {
+            auto proj_consumers = qkv_node->get_output_target_inputs(i);
+            if (proj_consumers.size() != 1) {
+                return false;
+            }
+            auto reshape = ov::as_type_ptr<v1::Reshape>(proj_consumers.begin()->get_node()->shared_from_this());
+            if (!reshape) {
+                return false;
+            }
+            auto reshape_consumers = reshape->get_output_target_inputs(0);
+            if (reshape_consumers.size() != 1 || reshape_consumers.begin()->get_index() != 0) {
+                return false;
+            }
+            auto rope = ov::as_type_ptr<ov::op::internal::RoPE>(
+                reshape_consumers.begin()->get_node()->shared_from_this());
+            if (!rope || rope->get_input_size() != 3) {
+                return false;
+            }
+
+            const auto& rope_config = rope->get_config();
+            if (rope_config.is_interleaved || rope_config.is_chatglm || rope_config.is_qwen ||
+                rope_config.support_2d_rope || rope_config.support_3d_rope || rope_config.is_ltx_video ||
+                rope_config.use_rope_cache || !rope_config.input_trans0213 || rope_config.output_trans0213 ||
+                rope_config.slice_stop > rope_config.slice_start || rope_config.gather_position_arg_id != 0) {
+                return false;
+            }
+
+            const auto& rshape = reshape->get_output_partial_shape(0);
+            if (rshape.rank().is_dynamic() || rshape.size() != 4 || rshape[2].is_dynamic() || rshape[3].is_dynamic() ||
+                !same_dim(rshape[0], ishape[0]) || !same_dim(rshape[1], ishape[1])) {
+                return false;
+            }
+            const auto proj_size = i == 0 ? qkv_node->get_config().proj_size0 : qkv_node->get_config().proj_size1;
+            if (rshape[2].get_length() * rshape[3].get_length() != proj_size) {
+                return false;
+            }
+
+            if (ropes[0]) {
+                const auto& q_config = ropes[0]->get_config();
+                if (rshape[3] != ropes[0]->get_input_partial_shape(0)[3] ||
+                    rope_config.rotary_ndims != q_config.rotary_ndims ||
+                    rope_config.cos_sin_ndims != q_config.cos_sin_ndims ||
+                    rope->input_value(1) != ropes[0]->input_value(1) ||
+                    rope->input_value(2) != ropes[0]->input_value(2)) {
+                    return false;
+                }
+            }
+            ropes[i] = rope;
+            fused_nodes.push_back(reshape);
+            fused_nodes.push_back(rope);
+        }
+
+        const auto& rope_config = ropes[0]->get_config();
+        const auto head_size = ropes[0]->get_input_partial_shape(0)[3].get_length();
+        if (rope_config.rotary_ndims == 0 || rope_config.rotary_ndims % 2 != 0 ||
+            rope_config.rotary_ndims > static_cast<size_t>(head_size)) {
+            return false;
+        }
+
+        auto config = qkv_node->get_config();
+        config.rope_head_size = static_cast<int>(head_size);
+        config.rope_rotary_ndims = static_cast<int>(rope_config.rotary_ndims);
+        config.rope_cos_sin_ndims = static_cast<int>(rope_config.cos_sin_ndims);
+
+        auto args = qkv_node->input_values();
+        args.push_back(ropes[0]->input_value(1));
+        args.push_back(ropes[0]->input_value(2));
+
+        auto new_node = std::make_shared<QKVProjectionNode>(args, config);
+        new_node->set_friendly_name(qkv_node->get_friendly_name());
+        ov::copy_runtime_info(fused_nodes, new_node);
+
+        // callback is for plugin implementation to check if it can be supported
+        if (!transformation_callback(new_node)) {
+            return false;
+        }
+
+        ropes[0]->output(0).replace(new_node->output(0));
+        ropes[1]->output(0).replace(new_node->output(1));
+        qkv_node->output(2).replace(new_node->output(2));
+        return true;
+    };
+
+    auto m = std::make_shared<ov::pass::pattern::Matcher>(qkv_proj, matcher_name);
+    this->register_matcher(m, callback);
+}
+
 bool ov::intel_cpu::QKVProjFusion::run_on_model(const std::shared_ptr<ov::Model>& model) {
     RUN_ON_MODEL_SCOPE(QKVProjFusion);
 
@@ -303,6 +414,7 @@ bool ov::intel_cpu::QKVProjFusion::run_on_model(const std::shared_ptr<ov::Model>
 
     symbolic_ctx_manager->register_pass<QKVProjFusionPass1>();
     symbolic_ctx_manager->register_pass<QKVProjFusionPass2>();
+    symbolic_ctx_manager->register_pass<QKVProjRoPEFusion>();
 
     return symbolic_optimizations.run_on_model(model);
 }
@@ -20,6 +20,15 @@ public:
     QKVProjFusionPass2();
 };
 
+// fuses the rotate-half RoPE of the q & k projections into QKVProjection, so the rotated q & k are written once
+// in the [B, H, L, S] layout expected by the attention instead of being read back and transposed by RoPE.
+// The k & v are still appended to the KV cache (and quantized) by the stateful SDPA, not by the fused node
+class QKVProjRoPEFusion : public ov::pass::MatcherPass {
+public:
+    OPENVINO_MATCHER_PASS_RTTI("QKVProjRoPEFusion");
+    QKVProjRoPEFusion();
+};
+
 class QKVProjFusion : public ov::pass::ModelPass {
 public:
     OPENVINO_MODEL_PASS_RTTI("QKVProjFusion");
@@ -143,6 +143,7 @@
 #include "transformations/low_precision/mark_dequantization_subgraph.hpp"
 
 // CPU specific transformations
+#include "transformations/cpu_opset/common/pass/apply_kv_cache_precision_policy.hpp"
 #include "transformations/cpu_opset/common/pass/insert_convert_after_extension.hpp"
 #include "transformations/cpu_opset/common/pass/ngram_fusion.hpp"
 #include "transformations/cpu_opset/common/pass/permute_slice_n_interpolation.hpp"
@@ -590,6 +591,16 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
         },
         ov::pass::KeepConstAndDecompression);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::AUGRUCellFusion);
+    // the layers are annotated before the fusions, the fused attention operations inherit the rt_info
+    CPU_REGISTER_PASS_COMMON(manager,
+                             ApplyKVCachePrecisionPolicy,
+                             KVCachePrecisionPolicy(config.kvCachePrecisionPolicy),
+                             [this](const ov::element::Type& precision, bool is_key) {
+                                 return node::PagedAttention::isQuantByChannel(
+                                     is_key ? config.keyCacheQuantMode : config.valueCacheQuantMode,
+                                     precision,
+                                     is_key);
+                             });
     CPU_REGISTER_PASS_COMMON(manager, SDPASubgraphFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::GatedDeltaNetFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::CommonOptimizations);
@@ -911,7 +922,8 @@ void Transformations::PreLpt(const std::vector<ov::element::Type>& defaultPrecis
        and finally do CF for those constant paths that are not inputs to MatMul node */
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::EnableDecompressionConvertConstantFolding);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::KeepConstAndDecompression);
-    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding);
+    // the remaining decompression sub-graphs are independent, so they are folded concurrently
+    CPU_REGISTER_PASS_COMMON(manager, ov::pass::ConstantFolding, true);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::LoraSubgraphFusion);
     CPU_REGISTER_PASS_COMMON(manager, ov::pass::Validate);
 
@@ -1140,6 +1152,11 @@ void Transformations::PostLpt() {
     CPU_DISABLE_PASS_COMMON(postLPTPassManager, ov::pass::RoPEFusionLtxVideo);
     CPU_REGISTER_PASS_X64(postLPTPassManager, CausalMaskPreprocessFusion);
 
+    // markup Rope Input when BF16/F16 inference, before the RoPE is fused into QKVProjection.
+    if (any_of(config.inferencePrecision, ov::element::bf16, ov::element::f16)) {
+        CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::MarkRopeInputsToKeepInMixedPrecision);
+    }
+
 #if defined(OPENVINO_ARCH_X86_64)
     // MLP & QKV fusion optimizations is focused on throughput, only enabled on AMX-bf16 & LLM serving use cases.
     auto can_use_amx_bf16_int8 = dnnl::impl::cpu::x64::mayiuse(dnnl::impl::cpu::x64::avx512_core_amx) &&
@@ -1185,6 +1202,17 @@ void Transformations::PostLpt() {
                                                                  fcDynamicQuantizationGroupSize);
             },
             QKVProjFusionPass2);
+
+        CPU_SET_CALLBACK_X64(
+            postLPTPassManager,
+            [=](const_node_ptr& node) -> bool {
+                std::string errorMsg;
+                return node::QKVProjection::isSupportedOperation(node,
+                                                                 errorMsg,
+                                                                 concurrency,
+                                                                 fcDynamicQuantizationGroupSize);
+            },
+            QKVProjRoPEFusion);
     }
 #endif  // OPENVINO_ARCH_X86_64
 
@@ -1198,9 +1226,7 @@ void Transformations::PostLpt() {
         },
         ov::intel_cpu::DecomposeRMSNorm);
 
-    // markup Rope Input when BF16/F16 inference.
     if (any_of(config.inferencePrecision, ov::element::bf16, ov::element::f16)) {
-        CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::MarkRopeInputsToKeepInMixedPrecision);
         CPU_REGISTER_PASS_COMMON(postLPTPassManager, ov::pass::MarkFloatingPointRange);
     }
 
@@ -89,6 +89,10 @@ void DebugCapsConfig::readProperties() {
     if (const auto* envVarValue = readEnv("OV_CPU_MEMORY_STATISTICS_PATH")) {
         memoryStatisticsDumpPath = envVarValue;
     }
+
+    if (const auto* envVarValue = readEnv("OV_CPU_MEMORY_REGIONS_DUMP_DIR")) {
+        memoryRegionsDumpDir = envVarValue;
+    }
 }
 
 }  // namespace ov::intel_cpu
@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "kv_cache_precision_policy.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/internal_properties.hpp"
+
+namespace ov::intel_cpu {
+
+namespace {
+
+std::string trim(const std::string& str) {
+    const auto begin = str.find_first_not_of(" \t");
+    if (begin == std::string::npos) {
+        return {};
+    }
+    const auto end = str.find_last_not_of(" \t");
+    return str.substr(begin, end - begin + 1);
+}
+
+std::vector<std::string> split(const std::string& str, char delimiter) {
+    std::vector<std::string> parts;
+    size_t begin = 0;
+    while (true) {
+        const auto end = str.find(delimiter, begin);
+        parts.push_back(trim(str.substr(begin, end - begin)));
+        if (end == std::string::npos) {
+            return parts;
+        }
+        begin = end + 1;
+    }
+}
+
+size_t parseLayer(const std::string& str, const std::string& rule) {
+    OPENVINO_ASSERT(!str.empty() && std::all_of(str.begin(),
+                                                str.end(),
+                                                [](char c) {
+                                                    return std::isdigit(static_cast<unsigned char>(c)) != 0;
+                                                }),
+                    "Wrong layers '",
+                    str,
+                    "' in the KV cache precision policy rule '",
+                    rule,
+                    "'");
+    return std::stoul(str);
+}
+
+}  // namespace
+
+KVCachePrecision KVCachePrecision::parse(const std::string& str) {
+    if (str == "tbq4") {
+        return {ov::element::u4, ov::internal::CacheQuantAlgorithm::TURBO};
+    }
+    if (str == "tbq3") {
+        return {ov::element::u3, ov::internal::CacheQuantAlgorithm::TURBO};
+    }
+    for (const auto prec : {ov::element::f32, ov::element::f16, ov::element::bf16, ov::element::u8, ov::element::u4}) {
+        if (str == prec.to_string()) {
+            return {prec, ov::internal::CacheQuantAlgorithm::SCALAR};
+        }
+    }
+    OPENVINO_THROW("Wrong KV cache precision '", str, "'. Supported values: f32, f16, bf16, u8, u4, tbq4, tbq3");
+}
+
+std::string KVCachePrecision::to_string() const {
+    if (alg == ov::internal::CacheQuantAlgorithm::TURBO) {
+        return "tbq" + std::to_string(precision.bitwidth());
+    }
+    return precision.to_string();
+}
+
+KVCachePrecisionPolicy::KVCachePrecisionPolicy(const std::string& policy) {
+    for (const auto& rule : split(policy, ';')) {
+        if (rule.empty()) {
+            continue;
+        }
+        const auto colon = rule.find(':');
+        OPENVINO_ASSERT(colon != std::string::npos,
+                        "KV cache precision policy rule '",
+                        rule,
+                        "' must have the format <layers>:<precisions>");
+        const auto layers = trim(rule.substr(0, colon));
+        const auto precisions = trim(rule.substr(colon + 1));
+
+        Rule parsed{0, std::numeric_limits<size_t>::max(), {}};
+        if (layers != "*") {
+            const auto dash = layers.find('-');
+            if (dash == std::string::npos) {
+                parsed.first = parsed.last = parseLayer(layers, rule);
+            } else {
+                parsed.first = parseLayer(trim(layers.substr(0, dash)), rule);
+                const auto last = trim(layers.substr(dash + 1));
+                if (!last.empty()) {
+                    parsed.last = parseLayer(last, rule);
+                }
+            }
+            OPENVINO_ASSERT(parsed.first <= parsed.last,
+                            "Empty layers range in the KV cache precision policy rule '",
+                            rule,
+                            "'");
+        }
+
+        if (precisions.find('=') == std::string::npos) {
+            parsed.precision.key = parsed.precision.value = KVCachePrecision::parse(precisions);
+        } else {
+            for (const auto& item : split(precisions, ',')) {
+                const auto eq = item.find('=');
+                const auto cache = eq == std::string::npos ? item : trim(item.substr(0, eq));
+                OPENVINO_ASSERT(eq != std::string::npos && (cache == "key" || cache == "value"),
+                                "Wrong precisions '",
+                                item,
+                                "' in the KV cache precision policy rule '",
+                                rule,
+                                "'. Expected key=<precision> or value=<precision>");
+                auto& target = cache == "key" ? parsed.precision.key : parsed.precision.value;
+                target = KVCachePrecision::parse(trim(item.substr(eq + 1)));
+            }
+        }
+        m_rules.push_back(parsed);
+    }
+}
+
+KVCachePrecisionPolicy::LayerPrecision KVCachePrecisionPolicy::get(size_t layer) const {
+    LayerPrecision result;
+    for (const auto& rule : m_rules) {
+        if (layer < rule.first || layer > rule.last) {
+            continue;
+        }
+        if (rule.precision.key) {
+            result.key = rule.precision.key;
+        }
+        if (rule.precision.value) {
+            result.value = rule.precision.value;
+        }
+    }
+    return result;
+}
+
+}  // namespace ov::intel_cpu
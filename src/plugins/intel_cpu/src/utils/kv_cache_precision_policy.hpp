@@ -0,0 +1,76 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "openvino/core/type/element_type.hpp"
+#include "openvino/runtime/internal_properties.hpp"
+
+namespace ov::intel_cpu {
+
+// rt_info keys of the attention operations (SDPA and PagedAttention) overriding the model-wide cache precisions,
+// the values are the precision strings accepted by KVCachePrecisionPolicy, e.g. "u4" or "tbq3"
+inline constexpr const char* KEY_CACHE_PRECISION_RT_INFO = "key_cache_precision";
+inline constexpr const char* VALUE_CACHE_PRECISION_RT_INFO = "value_cache_precision";
+
+struct KVCachePrecision {
+    ov::element::Type precision = ov::element::dynamic;
+    ov::internal::CacheQuantAlgorithm alg = ov::internal::CacheQuantAlgorithm::SCALAR;
+
+    bool operator==(const KVCachePrecision& rhs) const {
+        return precision == rhs.precision && alg == rhs.alg;
+    }
+
+    /**
+     * @brief Parses the precision of a cache: f32, f16, bf16, u8, u4 or tbq4/tbq3 for the TurboQuant u4/u3 cache
+     */
+    static KVCachePrecision parse(const std::string& str);
+
+    [[nodiscard]] std::string to_string() const;
+};
+
+/**
+ * @brief Per layer key and value cache precisions of the attention operations.
+ *
+ * The policy is a list of the rules separated by ';', every rule is "<layers>:<precisions>" where
+ *   <layers> is a layer index "N", a range "N-M", an open range "N-" or "*" for all the layers;
+ *   <precisions> is the precision of both caches or "key=<precision>,value=<precision>" (either part may be omitted).
+ * The layer is the index of the attention operation in the topological order of the model. The later rules override
+ * the earlier ones, the caches not covered by any rule keep the model-wide precision.
+ *
+ * E.g. "*:u4;0-1:f16" keeps the caches of the first two layers in f16 and compresses the caches of the other ones
+ * to 4 bits, "8-:key=u8,value=tbq3" changes the caches of the deep layers only.
+ */
+class KVCachePrecisionPolicy {
+public:
+    struct LayerPrecision {
+        std::optional<KVCachePrecision> key;
+        std::optional<KVCachePrecision> value;
+    };
+
+    KVCachePrecisionPolicy() = default;
+    explicit KVCachePrecisionPolicy(const std::string& policy);
+
+    [[nodiscard]] bool empty() const {
+        return m_rules.empty();
+    }
+
+    [[nodiscard]] LayerPrecision get(size_t layer) const;
+
+private:
+    struct Rule {
+        size_t first;
+        size_t last;
+        LayerPrecision precision;
+    };
+
+    std::vector<Rule> m_rules;
+};
+
+}  // namespace ov::intel_cpu
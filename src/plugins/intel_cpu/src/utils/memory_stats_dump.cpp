@@ -14,6 +14,7 @@
 
 #include "compiled_model.h"
 #include "debug_capabilities.h"
+#include "memory_control.hpp"
 #include "openvino/core/except.hpp"
 #include "utils/debug_caps_config.h"
 #include "weights_cache.hpp"
@@ -56,6 +57,30 @@ static void dumpStatistics(std::ostream& os,
     }
 }
 
+static void dumpRegions(const std::string& dir,
+                        const std::string& network_name,
+                        std::deque<CompiledModel::GraphGuard>& graphs) {
+    std::filesystem::create_directories(dir);
+    size_t graph_index = 0;
+    for (auto&& graph : graphs) {
+        CompiledModel::GraphGuard::Lock graph_lock{graph};
+        auto ctx = graph_lock._graph.getGraphContext();
+        if (!ctx) {
+            continue;
+        }
+        for (auto&& unit : ctx->getAuxiliaryNetworkMemoryControl()->controlUnits()) {
+            std::filesystem::path file_path = dir;
+            file_path /= network_name + "_" + std::to_string(graph_index) + "_" + unit->getId() + ".regions";
+            std::ofstream output(file_path);
+            if (!output.is_open()) {
+                OPENVINO_THROW("Cannot open file for writing: ", file_path);
+            }
+            writeMemoryRegions(output, unit->getRegions());
+        }
+        graph_index++;
+    }
+}
+
 static void dumpStatisticsCSV(std::ofstream& os,
                               [[maybe_unused]] const std::string& network_name,
                               std::deque<CompiledModel::GraphGuard>& graphs,
@@ -106,6 +131,10 @@ void dumpMemoryStats(const DebugCapsConfig& conf,
         return;
     }
 
+    if (!conf.memoryRegionsDumpDir.empty()) {
+        dumpRegions(conf.memoryRegionsDumpDir, network_name, graphs);
+    }
+
     if (conf.memoryStatisticsDumpPath.empty()) {
         return;
     }
@@ -5,18 +5,19 @@
 #include "weights_cache.hpp"
 
 #include <atomic>
+#include <cstddef>
 #include <functional>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
 #include <utility>
-#ifdef CPU_DEBUG_CAPS
-#    include <vector>
-#endif
+#include <vector>
 
 #include "cpu_memory.h"
 #include "openvino/core/except.hpp"
 #include "openvino/runtime/system_conf.hpp"
+#include "utils/debug_capabilities.h"
 
 namespace ov::intel_cpu {
 
@@ -62,6 +63,11 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::findOrCreate(const std::string
 
         if (!isCached()) {
             newPtr = create();
+            // the memory is first touched by the creating stream threads running on the node,
+            // the binding moves the pages touched by the threads of other nodes, if any
+            if (numaNodeId >= 0 && newPtr && newPtr->getSize() > 0 && !mbind_move(newPtr, numaNodeId)) {
+                DEBUG_LOG("WeightsSharing: failed to bind the memory with key ", key, " to NUMA node ", numaNodeId);
+            }
             ptr = std::make_shared<MemoryInfo>(newPtr, valid);
             sharedWeights[key] = ptr;
         }
@@ -93,11 +99,45 @@ WeightsSharing::SharedMemory::Ptr WeightsSharing::get(const std::string& key) co
                                           newPtr);
 }
 
+size_t WeightsSharing::totalSize() const {
+    size_t retVal = 0;
+
+    std::lock_guard<std::mutex> lock(guard);
+
+    for (const auto& item : sharedWeights) {
+        if (auto memory = item.second->sharedMemory.lock()) {
+            retVal += memory->getSize();
+        }
+    }
+
+    return retVal;
+}
+
 SocketsWeights::SocketsWeights() {
     int num_sockets = get_num_sockets();
     for (int socket_id = 0; socket_id < num_sockets; socket_id++) {
         _cache_map[socket_id] = std::make_shared<WeightsSharing>();
     }
+    // the NUMA node ids are not necessarily contiguous (i.e. the nodes without CPUs are not listed)
+    for (const auto& row : get_proc_type_table()) {
+        const int numa_node_id = row[PROC_NUMA_NODE_ID];
+        if (numa_node_id >= 0 && _numa_cache_map.count(numa_node_id) == 0) {
+            _numa_cache_map[numa_node_id] = std::make_shared<WeightsSharing>(numa_node_id);
+        }
+    }
+}
+
+WeightsSharing::Ptr SocketsWeights::numaNode(int numa_node_id) const {
+    auto found = _numa_cache_map.find(numa_node_id);
+    return found != _numa_cache_map.end() ? found->second : nullptr;
+}
+
+std::map<int, size_t> SocketsWeights::numaNodesTotalSize() const {
+    std::map<int, size_t> retVal;
+    for (const auto& item : _numa_cache_map) {
+        retVal[item.first] = item.second->totalSize();
+    }
+    return retVal;
 }
 
 WeightsSharing::Ptr& SocketsWeights::operator[](int socket_id) {
@@ -27,6 +27,7 @@ namespace ov::intel_cpu {
 /**
  * Caching store of Memory objects
  * Will return a cached object or create new one
+ * If the store is bound to a NUMA node, the memory of the created objects is bound to the node
  *
  * Is a thread safe
  */
@@ -51,6 +52,11 @@ public:
 
     using Ptr = std::shared_ptr<WeightsSharing>;
 
+    /**
+     * @param numaNodeId NUMA node to bind the cached memory to, -1 means no binding
+     */
+    explicit WeightsSharing(int numa_node_id = -1) : numaNodeId(numa_node_id) {}
+
     class SharedMemory {
     public:
         using Ptr = std::shared_ptr<SharedMemory>;
@@ -73,6 +79,15 @@ public:
 
     SharedMemory::Ptr get(const std::string& key) const;
 
+    /**
+     * @brief Size in bytes of the cached objects which are still in use
+     */
+    [[nodiscard]] size_t totalSize() const;
+
+    [[nodiscard]] int getNumaNodeId() const {
+        return numaNodeId;
+    }
+
 #ifdef CPU_DEBUG_CAPS
     Statistics dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
@@ -80,10 +95,12 @@ public:
 protected:
     mutable std::mutex guard;
     std::unordered_map<std::string, MemoryInfo::Ptr> sharedWeights;
+    const int numaNodeId;
 };
 
 /**
  * Collection of memory caching store per socket
+ * Additionally contains the stores per NUMA node, which keep a replica of the weights bound to every node
  *
  * Is a thread safe
  */
@@ -94,12 +111,23 @@ public:
     WeightsSharing::Ptr& operator[](int socket_id);
     const WeightsSharing::Ptr& operator[](int socket_id) const;
 
+    /**
+     * @brief Returns the weights replica of the NUMA node, nullptr if the node is unknown
+     */
+    [[nodiscard]] WeightsSharing::Ptr numaNode(int numa_node_id) const;
+
+    /**
+     * @brief Size in bytes of the weights replicas in use per NUMA node
+     */
+    [[nodiscard]] std::map<int, size_t> numaNodesTotalSize() const;
+
 #ifdef CPU_DEBUG_CAPS
     [[nodiscard]] std::vector<std::pair<int, WeightsSharing::Statistics>> dumpStatistics() const;
 #endif  // CPU_DEBUG_CAPS
 
 private:
     std::map<int, WeightsSharing::Ptr> _cache_map;
+    std::map<int, WeightsSharing::Ptr> _numa_cache_map;
 };
 
 }  // namespace ov::intel_cpu
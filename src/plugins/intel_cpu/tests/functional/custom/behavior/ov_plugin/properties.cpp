@@ -301,6 +301,17 @@ TEST_F(OVClassConfigTestCPU, smoke_PluginSetConfigLogLevel) {
             testing::HasSubstr(expect_message));
 }
 
+TEST_F(OVClassConfigTestCPU, smoke_PluginSetConfigRuntimeCacheByteBudget) {
+    ov::Core ie;
+
+    // the budget is shared by all the compiled models of the plugin, so it is set on the plugin level only
+    OV_ASSERT_NO_THROW(ie.set_property("CPU", ov::intel_cpu::cpu_runtime_cache_byte_budget(1024 * 1024)));
+    OV_ASSERT_NO_THROW(ie.compile_model(model, deviceName));
+    OV_EXPECT_THROW(ie.compile_model(model, deviceName, ov::intel_cpu::cpu_runtime_cache_byte_budget(1024)),
+                    ov::Exception,
+                    testing::HasSubstr("is a plugin level property"));
+}
+
 TEST_F(OVClassConfigTestCPU, smoke_PluginCheckCPUExecutionDevice) {
     ov::Core ie;
     ov::Any value;
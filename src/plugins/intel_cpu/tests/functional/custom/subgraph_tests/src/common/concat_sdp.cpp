@@ -23,6 +23,11 @@ const std::vector<std::vector<InputShape>> inputShapes = {
         {{-1, 8, -1, 64}, {{129, 8, 10, 64}, {129, 8, 1, 64}, {129, 8, 1, 64}, {129, 8, 1, 64}, {129, 8, 1, 64}}},
         {{-1, 8, -1, 64}, {{129, 8, 0, 64}, {129, 8, 10, 64}, {129, 8, 11, 64}, {129, 8, 12, 64}, {129, 8, 13, 64}}},
     },
+    // long context with batch 1 to check the split along the kv length inside mha_single_token_kernel
+    {
+        {{1, 8, -1, 64}, {{1, 8, 2100, 64}, {1, 8, 1, 64}, {1, 8, 1, 64}}},
+        {{1, 8, -1, 64}, {{1, 8, 0, 64}, {1, 8, 2100, 64}, {1, 8, 2101, 64}}},
+    },
 };
 
 const ov::AnyMap cfg_none{};
@@ -389,6 +389,234 @@ INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeByChannelTest,
 
 }  //  namespace
 
+// The past tokens out of the sliding window are evicted from the states. Every step is compared with the model without
+// the window, which gets the compacted states of the evicting model via set_state before the step.
+class ConcatSDPTransposeEvictionTest : public ConcatSDPTransposeTestBase {
+public:
+    static constexpr size_t windowSize = 16;
+    // not aligned to the by-channel quantization groups, it is rounded up to them
+    static constexpr size_t sinkSize = 4;
+
+    static ov::Tensor copy_state(ov::InferRequest& request, const std::string& name) {
+        for (auto&& state : request.query_state()) {
+            if (state.get_name() == name) {
+                auto state_tensor = state.get_state();
+                ov::Tensor copy{state_tensor.get_element_type(), state_tensor.get_shape()};
+                state_tensor.copy_to(copy);
+                return copy;
+            }
+        }
+        OPENVINO_THROW("Failed to find ", name, " state");
+    }
+};
+
+TEST_P(ConcatSDPTransposeEvictionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    if (!quantKeyByChannel) {
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::f32;
+    }
+    compile_model();
+    auto reference = compiledModel.create_infer_request();
+    configuration[ov::intel_cpu::kv_cache_window_size.name()] = windowSize;
+    configuration[ov::intel_cpu::kv_cache_sink_size.name()] = sinkSize;
+    prepare();
+    CheckNumberOfNodesWithType(compiledModel, "ScaledDotProductAttention", 1);
+
+    const auto concatAxis = transposeOrder[2];
+    size_t processedTokens = 0;
+    int idx = 0;
+    for (auto&& shapes : targetStaticShapes) {
+        if (idx > 0) {
+            for (auto&& state : reference.query_state()) {
+                state.set_state(copy_state(inferRequest, state.get_name()));
+            }
+        }
+        generate(idx++, shapes);
+        for (const auto& input : inputs) {
+            inferRequest.set_tensor(input.first, input.second);
+            reference.set_tensor(input.first, input.second);
+        }
+        inferRequest.infer();
+        reference.infer();
+        ov::test::utils::compare(reference.get_output_tensor(0),
+                                 inferRequest.get_output_tensor(0),
+                                 abs_threshold,
+                                 rel_threshold);
+        processedTokens += shapes[0][concatAxis];
+    }
+
+    for (const std::string name : {"pastk", "pastv"}) {
+        const auto keptTokens = copy_state(inferRequest, name).get_shape()[concatAxis];
+        EXPECT_LT(keptTokens, processedTokens) << name;
+        EXPECT_GE(keptTokens, windowSize) << name;
+    }
+    reset();
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeEvictionTest,
+                         ConcatSDPTransposeEvictionTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(shapesWithGreedySearch),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeEvictionByChannelTest,
+                         ConcatSDPTransposeEvictionTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(shapesWithGreedySearch),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true),
+                                            ::testing::Values(8)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
+// The raw KV cache states of one request are adopted by another request without copying them, the resumed request
+// must produce the same outputs. The exported views must not change when both requests run further or start over.
+class ConcatSDPTransposeRawStateTest : public ConcatSDPTransposeTestBase {
+public:
+    static bool is_raw(const ov::VariableState& state) {
+        return state.get_name().find("/raw/") != std::string::npos;
+    }
+
+    static ov::VariableState find_state(ov::InferRequest& request, const std::string& name) {
+        for (auto&& state : request.query_state()) {
+            if (state.get_name() == name) {
+                return state;
+            }
+        }
+        OPENVINO_THROW("Failed to find ", name, " state");
+    }
+
+    static ov::Tensor copy_tensor(const ov::Tensor& tensor) {
+        ov::Tensor copy{tensor.get_element_type(), tensor.get_shape()};
+        tensor.copy_to(copy);
+        return copy;
+    }
+
+    void infer(ov::InferRequest& resumed, int idx, const std::vector<ov::Shape>& shapes) {
+        generate(idx, shapes);
+        for (const auto& input : inputs) {
+            inferRequest.set_tensor(input.first, input.second);
+            resumed.set_tensor(input.first, input.second);
+        }
+        // the original request runs first, so it would change the buffers adopted by the resumed one if it wrote them
+        inferRequest.infer();
+        resumed.infer();
+        ov::test::utils::compare(inferRequest.get_output_tensor(0),
+                                 resumed.get_output_tensor(0),
+                                 abs_threshold,
+                                 rel_threshold);
+    }
+
+    void run_raw_state_test() {
+        if (!quantKeyByChannel) {
+            configuration[ov::hint::kv_cache_precision.name()] = ov::element::f32;
+        }
+        configuration[ov::intel_cpu::kv_cache_raw_state_access.name()] = true;
+        prepare();
+        auto resumed = compiledModel.create_infer_request();
+
+        // the views exported before every step with the copies of their content
+        std::vector<std::pair<ov::Tensor, ov::Tensor>> exported;
+        const auto check_exported = [&]() {
+            for (const auto& [view, content] : exported) {
+                const auto view_content = copy_tensor(view);
+                ASSERT_EQ(std::memcmp(view_content.data(), content.data(), content.get_byte_size()), 0)
+                    << "The exported raw state is changed";
+            }
+        };
+
+        int idx = 0;
+        for (auto&& shapes : targetStaticShapes) {
+            if (idx > 0) {
+                size_t rawStates = 0;
+                for (auto&& state : inferRequest.query_state()) {
+                    if (is_raw(state)) {
+                        auto view = state.get_state();
+                        find_state(resumed, state.get_name()).set_state(view);
+                        exported.emplace_back(view, copy_tensor(view));
+                        rawStates++;
+                    }
+                }
+                // the cache and the beam table of the k and v states, and their scales and zero points if quantized
+                ASSERT_EQ(rawStates, quantKeyByChannel ? 6 : 4);
+                for (auto&& state : resumed.query_state()) {
+                    if (is_raw(state)) {
+                        EXPECT_EQ(state.get_state().data(),
+                                  find_state(inferRequest, state.get_name()).get_state().data())
+                            << state.get_name() << " is copied";
+                    }
+                }
+            }
+            infer(resumed, idx++, shapes);
+            check_exported();
+        }
+
+        // both requests start over in the buffers of the previous sequence unless they are exported
+        reset();
+        for (auto&& state : resumed.query_state()) {
+            state.reset();
+        }
+        infer(resumed, 0, targetStaticShapes.front());
+        check_exported();
+        ASSERT_FALSE(exported.empty());
+    }
+};
+
+TEST_P(ConcatSDPTransposeRawStateTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    run_raw_state_test();
+}
+
+// The sliding window eviction compacts the cache in place, the exported and adopted buffers must be copied first.
+class ConcatSDPTransposeRawStateEvictionTest : public ConcatSDPTransposeRawStateTest {};
+
+TEST_P(ConcatSDPTransposeRawStateEvictionTest, CompareWithRefs) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    configuration[ov::intel_cpu::kv_cache_window_size.name()] = ConcatSDPTransposeEvictionTest::windowSize;
+    configuration[ov::intel_cpu::kv_cache_sink_size.name()] = ConcatSDPTransposeEvictionTest::sinkSize;
+    run_raw_state_test();
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeRawStateTest,
+                         ConcatSDPTransposeRawStateTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReorders),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeRawStateByChannelTest,
+                         ConcatSDPTransposeRawStateTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(shapesWithGreedySearch),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true),
+                                            ::testing::Values(8)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeRawStateEvictionTest,
+                         ConcatSDPTransposeRawStateEvictionTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(shapesWithGreedySearch),
+                                            ::testing::Values(false),
+                                            ::testing::Values(false),
+                                            ::testing::Values(0)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+
+INSTANTIATE_TEST_SUITE_P(smoke_ConcatSDPTransposeRawStateEvictionByChannelTest,
+                         ConcatSDPTransposeRawStateEvictionTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(shapesWithGreedySearch),
+                                            ::testing::Values(false),
+                                            ::testing::Values(true),
+                                            ::testing::Values(8)),
+                         ConcatSDPTransposeTest::getTestCaseName);
+}  // namespace
+
 class ConcatSDPTransposeTestSetState : public ConcatSDPTransposeTestBase {
 public:
     void reduce_state() {
@@ -0,0 +1,50 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "internal_properties.hpp"
+#include "openvino/op/matmul.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph with the repeated input shapes:
+
+                param
+                  |
+                MatMul
+                  |
+                Result
+
+The main purpose of the test is to check that the output shapes of the nodes which opt in are memoized per graph
+input shapes and the memoized shapes produce the same results as the shape inference.
+*/
+
+namespace ov {
+namespace test {
+
+class DynamicShapesCacheCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto precision = ov::element::f32;
+        init_input_shapes({InputShape{{-1, 64}, {{2, 64}, {5, 64}, {2, 64}, {5, 64}}}});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        auto weights = ov::test::utils::make_constant(precision, ov::Shape{64, 32});
+        auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+        auto result = std::make_shared<ov::op::v0::Result>(matMul);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "ShapesCache");
+    }
+};
+
+TEST_F(DynamicShapesCacheCPUTest, smoke_CompareWithRefs) {
+    run();
+    const auto stats = compiledModel.get_property(ov::intel_cpu::dynamic_shapes_cache_stats.name())
+                           .as<std::map<std::string, uint64_t>>();
+    // the first two input shapes are inferred, the repeated ones are taken from the cache
+    ASSERT_EQ(stats.at("misses"), 2u);
+    ASSERT_EQ(stats.at("hits"), 2u);
+}
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "common_test_utils/node_builders/eltwise.hpp"
+#include "internal_properties.hpp"
+#include "openvino/core/parallel.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/matmul.hpp"
+#include "openvino/op/relu.hpp"
+#include "openvino/runtime/properties.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+
+/*This test runs the following subgraph with the inter-op parallelism enabled:
+
+                         param
+               /       /       \       \
+           MatMul   MatMul   MatMul   MatMul
+             |        |        |        |
+            Add      Add      Add      Add
+             |        |        |        |
+            Relu     Relu     Relu     Relu
+               \       \       /       /
+                        Concat
+                          |
+                        Result
+
+The main purpose of the test is to check that the independent branches executed concurrently
+produce the same results as the sequential execution and the memory reuse plan is respected.
+*/
+
+namespace ov {
+namespace test {
+
+class InterOpParallelismCPUTest : virtual public ov::test::SubgraphBaseTest {
+protected:
+    static constexpr size_t numBranches = 4;
+
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto precision = ov::element::f32;
+        init_input_shapes({InputShape{{}, {{8, 64}}}});
+        configuration.insert({ov::intel_cpu::enable_inter_op_parallelism.name(), true});
+        configuration.insert({ov::enable_profiling.name(), true});
+        configuration.insert({ov::hint::inference_precision.name(), precision});
+
+        auto param = std::make_shared<ov::op::v0::Parameter>(precision, inputDynamicShapes.front());
+        ov::OutputVector concatInputs;
+        for (size_t i = 0; i < numBranches; i++) {
+            auto weights = ov::test::utils::make_constant(precision, ov::Shape{64, 64});
+            auto matMul = std::make_shared<ov::op::v0::MatMul>(param, weights);
+            auto bias = ov::test::utils::make_constant(precision, ov::Shape{1, 64});
+            auto add = utils::make_eltwise(matMul, bias, utils::EltwiseTypes::ADD);
+            concatInputs.push_back(std::make_shared<ov::op::v0::Relu>(add));
+        }
+        auto concat = std::make_shared<ov::op::v0::Concat>(concatInputs, 1);
+        auto result = std::make_shared<ov::op::v0::Result>(concat);
+        function = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param}, "InterOp");
+    }
+
+    void checkBranches() {
+        size_t branches = 0;
+        for (const auto& info : inferRequest.get_profiling_info()) {
+            if (info.node_type == "InterOpBranch") {
+                branches++;
+            }
+        }
+#if OV_THREAD_USE_TBB
+        if (parallel_get_max_threads() > 1) {
+            ASSERT_GT(branches, 1u);
+        }
+#else
+        ASSERT_EQ(branches, 0u);
+#endif
+    }
+};
+
+TEST_F(InterOpParallelismCPUTest, smoke_CompareWithRefs) {
+    run();
+    checkBranches();
+}
+
+}  // namespace test
+}  // namespace ov
@@ -24,6 +24,18 @@ const std::vector<MoeTestShapeParams> moe_params_smoke = {
         4,                                                           // number_of_experts
         256                                                          // intermediate_size
     },
+    {
+        {{-1, -1, 128}, {{64, 1, 128}, {1, 1, 128}, {2, 40, 128}}},  // Batched decoding, several rows per expert
+        2,                                                           // topk
+        8,                                                           // number_of_experts
+        256                                                          // intermediate_size
+    },
+    {
+        {{-1, -1, 128}, {{4, 1, 128}, {6, 1, 128}, {4, 1, 128}}},  // Small experts computed concurrently by GEMV
+        2,                                                         // topk
+        8,                                                         // number_of_experts
+        256                                                        // intermediate_size
+    },
 };
 
 std::vector<ov::AnyMap> generate_additional_config() {
@@ -297,6 +297,7 @@ std::vector<ov::AnyMap> filter_additional_config_dyn_quant() {
     std::vector<ov::AnyMap> additional_config = {
         {{ov::hint::dynamic_quantization_group_size(0)}},  // dynamic quantization is disabled
         {{ov::hint::dynamic_quantization_group_size(16)}},
+        {{ov::hint::dynamic_quantization_group_size(32)}},
         {{ov::hint::dynamic_quantization_group_size(128)}},
     };
     return additional_config;
@@ -808,6 +808,56 @@ INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnSharedKVCache,
                          PagedAttnTestBase::getTestCaseName);
 }  // namespace
 
+class PagedAttnStagePerfCountersTest : public PagedAttnVSSDPATest {};
+
+TEST_P(PagedAttnStagePerfCountersTest, CheckStageCounters) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto& [inType, inputShapes, extendBlockIndices, enableXattn, sinkInput, slidingWindow, additional_config,
+                 addSharedReader] = this->GetParam();
+    const bool stageCounters =
+        intel_cpu::contains_key_value(additional_config, {ov::intel_cpu::cpu_stage_perf_counters.name(), true});
+
+    configuration[ov::enable_profiling.name()] = true;
+    run_test(function, extendBlockIndices, sinkInput);
+
+    // the stages of the only PagedAttention node are reported for the last inference, which is a decode step
+    std::map<std::string, ov::ProfilingInfo> stages;
+    for (const auto& pc : inferRequest.get_profiling_info()) {
+        if (pc.node_type == "PagedAttentionStage") {
+            stages[pc.node_name.substr(pc.node_name.rfind('/') + 1)] = pc;
+        }
+    }
+    if (!stageCounters) {
+        ASSERT_TRUE(stages.empty());
+        return;
+    }
+    for (const auto* stage : {"kv_cache_update", "kv_reorder", "attention", "attention_prefill", "attention_decode"}) {
+        ASSERT_EQ(stages.count(stage), 1u) << stage;
+    }
+    ASSERT_EQ(stages.size(), 5u);
+    // no prefill in the decode step, the values are not averaged with the previous prefill inference
+    ASSERT_EQ(stages.at("attention_prefill").cpu_time.count(), 0);
+}
+
+namespace {
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnStagePerfCounters,
+                         PagedAttnStagePerfCountersTest,
+                         ::testing::Combine(::testing::Values(ElementType::f32),
+                                            ::testing::ValuesIn(inputShapeAndReorders),
+                                            ::testing::Values(false),  // extendBlockIndices
+                                            ::testing::Values(false),  // enableXattn
+                                            ::testing::Values(false),  // sinkInput
+                                            ::testing::Values(0),      // slidingWindow
+                                            ::testing::Values(ov::AnyMap{{ov::intel_cpu::enable_sage_attn.name(),
+                                                                          false},
+                                                                         {ov::intel_cpu::cpu_stage_perf_counters.name(),
+                                                                          true}},
+                                                              ov::AnyMap{{ov::intel_cpu::enable_sage_attn.name(),
+                                                                          false}}),
+                                            ::testing::Values(false)),  // addSharedReader
+                         PagedAttnTestBase::getTestCaseName);
+}  // namespace
+
 class PagedAttnVSMatmulTest : public PagedAttnTestBase {
 public:
     std::shared_ptr<ov::Model> get_ref_model(ov::element::Type data_type,
@@ -0,0 +1,302 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "nodes/kernels/scaled_attn/paged_attn_block_manager.hpp"
+#include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+using namespace ov::op;
+using ov::intel_cpu::PagedAttentionBlockManager;
+
+namespace ov {
+namespace test {
+
+// prefix length, suffix length, number of the requests sharing the prefix
+using PagedAttnPrefixSharingParams = std::tuple<size_t, size_t, size_t>;
+
+class PagedAttnPrefixSharingTest : public testing::WithParamInterface<PagedAttnPrefixSharingParams>,
+                                   virtual public ov::test::SubgraphBaseTest,
+                                   public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PagedAttnPrefixSharingParams>& obj) {
+        const auto& [prefix_len, suffix_len, num_requests] = obj.param;
+        std::ostringstream result;
+        result << "Prefix=" << prefix_len << "_";
+        result << "Suffix=" << suffix_len << "_";
+        result << "Requests=" << num_requests;
+        return result.str();
+    }
+
+protected:
+    static constexpr size_t block_size = 32;
+    static constexpr size_t head_num = 4;
+    static constexpr size_t head_size = 64;
+
+    struct RunResult {
+        // the output of the last prompt token of every request
+        std::vector<std::vector<float>> outputs;
+        std::vector<double> ttft_ms;
+        size_t used_blocks;
+        size_t block_bytes;
+    };
+
+    static std::shared_ptr<v0::Parameter> make_param(const PartialShape& pshape,
+                                                     element::Type element_type,
+                                                     const std::string& name) {
+        auto param = std::make_shared<v0::Parameter>(element_type, pshape);
+        param->set_friendly_name(name);
+        param->get_output_tensor(0).set_names({name});
+        return param;
+    }
+
+    static std::shared_ptr<ov::Model> get_pa_model() {
+        const auto hidden = static_cast<ov::Dimension::value_type>(head_num * head_size);
+        auto q = make_param(PartialShape{ov::Dimension::dynamic(), hidden}, ov::element::f32, "q");
+        auto k = make_param(PartialShape{ov::Dimension::dynamic(), hidden}, ov::element::f32, "k");
+        auto v = make_param(PartialShape{ov::Dimension::dynamic(), hidden}, ov::element::f32, "v");
+        auto key_cache = make_param(PartialShape{ov::Dimension::dynamic(), 32, ov::Dimension::dynamic()},
+                                    ov::element::dynamic,
+                                    "key_cache.0");
+        auto value_cache = make_param(PartialShape{ov::Dimension::dynamic(), 32, ov::Dimension::dynamic()},
+                                      ov::element::dynamic,
+                                      "value_cache.0");
+        auto past_lens = make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "past_lens");
+        auto subsequence_begins =
+            make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "subsequence_begins");
+        auto block_indices = make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "block_indices");
+        auto block_indices_begins =
+            make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "block_indices_begins");
+
+        const float scale_value = 1.0f / std::sqrt(static_cast<float>(head_size));
+        auto i32_scalar = [](int32_t value) {
+            return std::make_shared<v0::Constant>(ov::element::i32, Shape{}, std::vector<int32_t>{value});
+        };
+        auto i32_empty = [] {
+            return std::make_shared<v0::Constant>(ov::element::i32, Shape{0}, std::vector<int32_t>{});
+        };
+        auto f32_empty = [] {
+            return std::make_shared<v0::Constant>(ov::element::f32, Shape{0}, std::vector<float>{});
+        };
+
+        OutputVector pa_inputs = {q,
+                                  k,
+                                  v,
+                                  key_cache,
+                                  value_cache,
+                                  past_lens,
+                                  subsequence_begins,
+                                  block_indices,
+                                  block_indices_begins,
+                                  std::make_shared<v0::Constant>(ov::element::f32, Shape{}, scale_value),
+                                  i32_scalar(0),     // sliding_window
+                                  f32_empty(),       // alibi_slopes
+                                  i32_scalar(8192),  // max_context_len
+                                  i32_scalar(0),     // score_aggregation_window
+                                  i32_empty(),       // rotated_block_indices
+                                  i32_empty(),       // rotation_deltas
+                                  f32_empty(),       // rotation_trig_lut
+                                  f32_empty(),       // xattention_threshold
+                                  i32_scalar(64),    // xattention_block_size
+                                  i32_scalar(8),     // xattention_stride
+                                  ov::test::utils::make_constant(ov::element::f32, Shape{0}),  // sinks
+                                  i32_scalar(0),  // adaptive_rkv_start_size
+                                  i32_empty(),    // adaptive_rkv_evictable_sizes
+                                  i32_empty(),    // adaptive_rkv_diversity_block_set_indices
+                                  i32_empty(),    // adaptive_rkv_diversity_block_set_indices_begins
+                                  i32_empty(),    // token_type_ids
+                                  std::make_shared<v0::Constant>(ov::element::u8, Shape{0}, std::vector<uint8_t>{}),
+                                  i32_empty()};  // qq_bias_begins
+
+        auto paged_attn = std::make_shared<op::PagedAttentionExtension>(pa_inputs);
+        paged_attn->get_rt_info()["num_k_heads"] = head_num;
+        paged_attn->get_rt_info()["k_head_size"] = head_size;
+        paged_attn->get_rt_info()["num_v_heads"] = head_num;
+        paged_attn->get_rt_info()["v_head_size"] = head_size;
+
+        ParameterVector params =
+            {q, k, v, key_cache, value_cache, past_lens, subsequence_begins, block_indices, block_indices_begins};
+        return std::make_shared<ov::Model>(OutputVector{paged_attn}, params);
+    }
+
+    // the projections of a token depend only on the token and its position, as in a real model
+    static void fill_projections(ov::Tensor& tensor,
+                                 const std::vector<PagedAttentionBlockManager::Token>& tokens,
+                                 size_t begin,
+                                 float phase) {
+        auto* data = tensor.data<float>();
+        const size_t hidden = head_num * head_size;
+        for (size_t i = 0; i < tensor.get_shape()[0]; i++) {
+            const auto token = static_cast<float>(tokens[begin + i] % 997);
+            const auto position = static_cast<float>(begin + i);
+            for (size_t d = 0; d < hidden; d++) {
+                data[i * hidden + d] = std::sin(0.013f * token + 0.007f * position + 0.11f * d + phase);
+            }
+        }
+    }
+
+    std::vector<std::vector<PagedAttentionBlockManager::Token>> make_prompts() const {
+        const auto& [prefix_len, suffix_len, num_requests] = GetParam();
+        std::vector<PagedAttentionBlockManager::Token> prefix(prefix_len);
+        std::iota(prefix.begin(), prefix.end(), 1);
+
+        std::vector<std::vector<PagedAttentionBlockManager::Token>> prompts;
+        for (size_t r = 0; r < num_requests; r++) {
+            auto prompt = prefix;
+            for (size_t i = 0; i < suffix_len; i++) {
+                prompt.push_back(static_cast<PagedAttentionBlockManager::Token>(10000 * (r + 1) + i));
+            }
+            prompts.push_back(std::move(prompt));
+        }
+        // the prompt equal to the cached prefix makes the last shared block be copied on write
+        prompts.push_back(prefix);
+        return prompts;
+    }
+
+    RunResult run(bool prefix_caching) {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::f32;
+        function = get_pa_model();
+        compile_model();
+        auto infer_request = compiledModel.create_infer_request();
+
+        const auto prompts = make_prompts();
+        size_t num_blocks = 0;
+        for (const auto& prompt : prompts) {
+            num_blocks += (prompt.size() + block_size - 1) / block_size;
+        }
+
+        ov::Tensor key_cache;
+        ov::Tensor value_cache;
+        for (const auto& input : compiledModel.inputs()) {
+            auto pshape = input.get_partial_shape();
+            pshape[0] = num_blocks;
+            if (input.get_any_name() == "key_cache.0") {
+                key_cache = ov::Tensor(input.get_element_type(), pshape.get_shape());
+            } else if (input.get_any_name() == "value_cache.0") {
+                value_cache = ov::Tensor(input.get_element_type(), pshape.get_shape());
+            }
+        }
+        infer_request.set_tensor("key_cache.0", key_cache);
+        infer_request.set_tensor("value_cache.0", value_cache);
+
+        PagedAttentionBlockManager manager(num_blocks, block_size, prefix_caching);
+        RunResult result;
+        const size_t key_block_bytes = key_cache.get_byte_size() / num_blocks;
+        const size_t value_block_bytes = value_cache.get_byte_size() / num_blocks;
+        result.block_bytes = key_block_bytes + value_block_bytes;
+        const size_t hidden = head_num * head_size;
+        for (size_t r = 0; r < prompts.size(); r++) {
+            const auto start = std::chrono::steady_clock::now();
+            const auto& prompt = prompts[r];
+            const auto past_len = manager.addSequence(r, prompt);
+            const auto copies = manager.reserve(r);
+            PagedAttentionBlockManager::copyBlocks(copies, key_cache.data(), key_block_bytes);
+            PagedAttentionBlockManager::copyBlocks(copies, value_cache.data(), value_block_bytes);
+            const auto inputs = manager.inputs({r});
+
+            const size_t new_tokens = prompt.size() - past_len;
+            ov::Tensor q(ov::element::f32, {new_tokens, hidden});
+            ov::Tensor k(ov::element::f32, {new_tokens, hidden});
+            ov::Tensor v(ov::element::f32, {new_tokens, hidden});
+            fill_projections(q, prompt, past_len, 0.0f);
+            fill_projections(k, prompt, past_len, 1.0f);
+            fill_projections(v, prompt, past_len, 2.0f);
+            auto make_i32 = [](const std::vector<int32_t>& values) {
+                ov::Tensor tensor(ov::element::i32, {values.size()});
+                std::copy(values.begin(), values.end(), tensor.data<int32_t>());
+                return tensor;
+            };
+            infer_request.set_tensor("q", q);
+            infer_request.set_tensor("k", k);
+            infer_request.set_tensor("v", v);
+            infer_request.set_tensor("past_lens", make_i32(inputs.pastLens));
+            infer_request.set_tensor("subsequence_begins", make_i32(inputs.subsequenceBegins));
+            infer_request.set_tensor("block_indices", make_i32(inputs.blockIndices));
+            infer_request.set_tensor("block_indices_begins", make_i32(inputs.blockIndicesBegins));
+            infer_request.infer();
+            manager.commit(r);
+
+            const auto output = infer_request.get_output_tensor(0);
+            const auto* last = output.data<const float>() + (new_tokens - 1) * hidden;
+            result.outputs.emplace_back(last, last + hidden);
+            result.ttft_ms.push_back(
+                std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+        }
+        // all the requests are alive, so the blocks are not reused
+        result.used_blocks = manager.statistics().usedBlocks;
+        return result;
+    }
+
+    void compare(const RunResult& shared, const RunResult& reference) {
+        ASSERT_EQ(shared.outputs.size(), reference.outputs.size());
+        for (size_t r = 0; r < shared.outputs.size(); r++) {
+            for (size_t i = 0; i < shared.outputs[r].size(); i++) {
+                ASSERT_NEAR(shared.outputs[r][i], reference.outputs[r][i], 1e-4f)
+                    << "request " << r << " index " << i;
+            }
+        }
+    }
+};
+
+TEST_P(PagedAttnPrefixSharingTest, CompareWithoutSharing) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto shared = run(true);
+    const auto reference = run(false);
+    compare(shared, reference);
+    ASSERT_LT(shared.used_blocks, reference.used_blocks);
+}
+
+const std::vector<PagedAttnPrefixSharingParams> smoke_params = {{64, 16, 3}, {96, 40, 2}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnPrefixSharing,
+                         PagedAttnPrefixSharingTest,
+                         ::testing::ValuesIn(smoke_params),
+                         PagedAttnPrefixSharingTest::getTestCaseName);
+
+// Reports the time to the first token and the KV cache memory of the requests sharing the prefix,
+// run with --gtest_also_run_disabled_tests
+class PagedAttnPrefixSharingBenchmark : public PagedAttnPrefixSharingTest {};
+
+TEST_P(PagedAttnPrefixSharingBenchmark, DISABLED_TTFTAndKVMemory) {
+    const auto shared = run(true);
+    const auto reference = run(false);
+    compare(shared, reference);
+
+    auto average = [](const std::vector<double>& values) {
+        // the first request computes the prefix in both cases
+        return std::accumulate(values.begin() + 1, values.end(), 0.0) / static_cast<double>(values.size() - 1);
+    };
+    std::cout << "Requests: " << shared.ttft_ms.size() << ", first request TTFT " << reference.ttft_ms[0]
+              << " ms\n";
+    std::cout << "Average TTFT of the next requests: " << average(reference.ttft_ms) << " ms without sharing, "
+              << average(shared.ttft_ms) << " ms with prefix sharing\n";
+    std::cout << "KV cache memory: " << reference.used_blocks * reference.block_bytes << " bytes ("
+              << reference.used_blocks << " blocks) without sharing, " << shared.used_blocks * shared.block_bytes
+              << " bytes (" << shared.used_blocks << " blocks) with prefix sharing\n";
+}
+
+INSTANTIATE_TEST_SUITE_P(PagedAttnPrefixSharing,
+                         PagedAttnPrefixSharingBenchmark,
+                         ::testing::Values(PagedAttnPrefixSharingParams{1024, 64, 8},
+                                           PagedAttnPrefixSharingParams{4096, 128, 16}),
+                         PagedAttnPrefixSharingTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
@@ -0,0 +1,285 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include "common_test_utils/node_builders/constant.hpp"
+#include "nodes/kernels/scaled_attn/paged_attn_block_manager.hpp"
+#include "openvino/op/paged_attention.hpp"
+#include "openvino/op/parameter.hpp"
+#include "shared_test_classes/base/ov_subgraph.hpp"
+#include "utils/cpu_test_utils.hpp"
+
+using namespace ov::test;
+using namespace CPUTestUtils;
+using namespace ov::op;
+using ov::intel_cpu::PagedAttentionBlockManager;
+
+namespace ov {
+namespace test {
+
+// prompt length, number of the draft tokens, number of the accepted draft tokens
+using PagedAttnSpeculativeDecodeParams = std::tuple<size_t, size_t, size_t>;
+
+// The draft tokens verified in one step (the multi query decode) must produce the same outputs as the tokens decoded
+// one by one, and the rejected tokens must not affect the next step after the rollback
+class PagedAttnSpeculativeDecodeTest : public testing::WithParamInterface<PagedAttnSpeculativeDecodeParams>,
+                                       virtual public ov::test::SubgraphBaseTest,
+                                       public CPUTestsBase {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<PagedAttnSpeculativeDecodeParams>& obj) {
+        const auto& [prompt_len, draft_len, accepted] = obj.param;
+        std::ostringstream result;
+        result << "Prompt=" << prompt_len << "_";
+        result << "Draft=" << draft_len << "_";
+        result << "Accepted=" << accepted;
+        return result.str();
+    }
+
+protected:
+    using Tokens = std::vector<PagedAttentionBlockManager::Token>;
+
+    static constexpr size_t block_size = 32;
+    static constexpr size_t head_num = 4;
+    static constexpr size_t head_size = 64;
+    static constexpr size_t hidden = head_num * head_size;
+    static constexpr size_t num_blocks = 16;
+
+    static std::shared_ptr<v0::Parameter> make_param(const PartialShape& pshape,
+                                                     element::Type element_type,
+                                                     const std::string& name) {
+        auto param = std::make_shared<v0::Parameter>(element_type, pshape);
+        param->set_friendly_name(name);
+        param->get_output_tensor(0).set_names({name});
+        return param;
+    }
+
+    static std::shared_ptr<ov::Model> get_pa_model() {
+        const auto hidden_dim = static_cast<ov::Dimension::value_type>(hidden);
+        auto q = make_param(PartialShape{ov::Dimension::dynamic(), hidden_dim}, ov::element::f32, "q");
+        auto k = make_param(PartialShape{ov::Dimension::dynamic(), hidden_dim}, ov::element::f32, "k");
+        auto v = make_param(PartialShape{ov::Dimension::dynamic(), hidden_dim}, ov::element::f32, "v");
+        auto key_cache = make_param(PartialShape{ov::Dimension::dynamic(), 32, ov::Dimension::dynamic()},
+                                    ov::element::dynamic,
+                                    "key_cache.0");
+        auto value_cache = make_param(PartialShape{ov::Dimension::dynamic(), 32, ov::Dimension::dynamic()},
+                                      ov::element::dynamic,
+                                      "value_cache.0");
+        auto past_lens = make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "past_lens");
+        auto subsequence_begins =
+            make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "subsequence_begins");
+        auto block_indices = make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "block_indices");
+        auto block_indices_begins =
+            make_param(PartialShape{ov::Dimension::dynamic()}, ov::element::i32, "block_indices_begins");
+
+        const float scale_value = 1.0f / std::sqrt(static_cast<float>(head_size));
+        auto i32_scalar = [](int32_t value) {
+            return std::make_shared<v0::Constant>(ov::element::i32, Shape{}, std::vector<int32_t>{value});
+        };
+        auto i32_empty = [] {
+            return std::make_shared<v0::Constant>(ov::element::i32, Shape{0}, std::vector<int32_t>{});
+        };
+        auto f32_empty = [] {
+            return std::make_shared<v0::Constant>(ov::element::f32, Shape{0}, std::vector<float>{});
+        };
+
+        OutputVector pa_inputs = {q,
+                                  k,
+                                  v,
+                                  key_cache,
+                                  value_cache,
+                                  past_lens,
+                                  subsequence_begins,
+                                  block_indices,
+                                  block_indices_begins,
+                                  std::make_shared<v0::Constant>(ov::element::f32, Shape{}, scale_value),
+                                  i32_scalar(0),     // sliding_window
+                                  f32_empty(),       // alibi_slopes
+                                  i32_scalar(8192),  // max_context_len
+                                  i32_scalar(0),     // score_aggregation_window
+                                  i32_empty(),       // rotated_block_indices
+                                  i32_empty(),       // rotation_deltas
+                                  f32_empty(),       // rotation_trig_lut
+                                  f32_empty(),       // xattention_threshold
+                                  i32_scalar(64),    // xattention_block_size
+                                  i32_scalar(8),     // xattention_stride
+                                  ov::test::utils::make_constant(ov::element::f32, Shape{0}),  // sinks
+                                  i32_scalar(0),  // adaptive_rkv_start_size
+                                  i32_empty(),    // adaptive_rkv_evictable_sizes
+                                  i32_empty(),    // adaptive_rkv_diversity_block_set_indices
+                                  i32_empty(),    // adaptive_rkv_diversity_block_set_indices_begins
+                                  i32_empty(),    // token_type_ids
+                                  std::make_shared<v0::Constant>(ov::element::u8, Shape{0}, std::vector<uint8_t>{}),
+                                  i32_empty()};  // qq_bias_begins
+
+        auto paged_attn = std::make_shared<op::PagedAttentionExtension>(pa_inputs);
+        paged_attn->get_rt_info()["num_k_heads"] = head_num;
+        paged_attn->get_rt_info()["k_head_size"] = head_size;
+        paged_attn->get_rt_info()["num_v_heads"] = head_num;
+        paged_attn->get_rt_info()["v_head_size"] = head_size;
+
+        ParameterVector params =
+            {q, k, v, key_cache, value_cache, past_lens, subsequence_begins, block_indices, block_indices_begins};
+        return std::make_shared<ov::Model>(OutputVector{paged_attn}, params);
+    }
+
+    // the projections of a token depend only on the token and its position, as in a real model
+    static void fill_projections(ov::Tensor& tensor, const Tokens& tokens, size_t begin, float phase) {
+        auto* data = tensor.data<float>();
+        for (size_t i = 0; i < tensor.get_shape()[0]; i++) {
+            const auto token = static_cast<float>(tokens[begin + i] % 997);
+            const auto position = static_cast<float>(begin + i);
+            for (size_t d = 0; d < hidden; d++) {
+                data[i * hidden + d] = std::sin(0.013f * token + 0.007f * position + 0.11f * d + phase);
+            }
+        }
+    }
+
+    void init() {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        configuration[ov::hint::inference_precision.name()] = ov::element::f32;
+        configuration[ov::hint::kv_cache_precision.name()] = ov::element::f32;
+        function = get_pa_model();
+        compile_model();
+        m_infer_request = compiledModel.create_infer_request();
+
+        for (const auto& input : compiledModel.inputs()) {
+            auto pshape = input.get_partial_shape();
+            pshape[0] = num_blocks;
+            if (input.get_any_name() == "key_cache.0") {
+                m_key_cache = ov::Tensor(input.get_element_type(), pshape.get_shape());
+            } else if (input.get_any_name() == "value_cache.0") {
+                m_value_cache = ov::Tensor(input.get_element_type(), pshape.get_shape());
+            }
+        }
+        m_infer_request.set_tensor("key_cache.0", m_key_cache);
+        m_infer_request.set_tensor("value_cache.0", m_value_cache);
+    }
+
+    // computes the not computed tokens of the sequence in one step, returns the outputs of the tokens
+    std::vector<std::vector<float>> step(PagedAttentionBlockManager& manager,
+                                         PagedAttentionBlockManager::SequenceId id,
+                                         const Tokens& tokens) {
+        const auto past_len = manager.computedTokens(id);
+        const auto copies = manager.reserve(id);
+        PagedAttentionBlockManager::copyBlocks(copies, m_key_cache.data(), m_key_cache.get_byte_size() / num_blocks);
+        PagedAttentionBlockManager::copyBlocks(copies,
+                                               m_value_cache.data(),
+                                               m_value_cache.get_byte_size() / num_blocks);
+        const auto inputs = manager.inputs({id});
+
+        const size_t new_tokens = tokens.size() - past_len;
+        ov::Tensor q(ov::element::f32, {new_tokens, hidden});
+        ov::Tensor k(ov::element::f32, {new_tokens, hidden});
+        ov::Tensor v(ov::element::f32, {new_tokens, hidden});
+        fill_projections(q, tokens, past_len, 0.0f);
+        fill_projections(k, tokens, past_len, 1.0f);
+        fill_projections(v, tokens, past_len, 2.0f);
+        auto make_i32 = [](const std::vector<int32_t>& values) {
+            ov::Tensor tensor(ov::element::i32, {values.size()});
+            std::copy(values.begin(), values.end(), tensor.data<int32_t>());
+            return tensor;
+        };
+        m_infer_request.set_tensor("q", q);
+        m_infer_request.set_tensor("k", k);
+        m_infer_request.set_tensor("v", v);
+        m_infer_request.set_tensor("past_lens", make_i32(inputs.pastLens));
+        m_infer_request.set_tensor("subsequence_begins", make_i32(inputs.subsequenceBegins));
+        m_infer_request.set_tensor("block_indices", make_i32(inputs.blockIndices));
+        m_infer_request.set_tensor("block_indices_begins", make_i32(inputs.blockIndicesBegins));
+        m_infer_request.infer();
+        manager.commit(id);
+
+        const auto output = m_infer_request.get_output_tensor(0);
+        std::vector<std::vector<float>> outputs;
+        for (size_t i = 0; i < new_tokens; i++) {
+            const auto* data = output.data<const float>() + i * hidden;
+            outputs.emplace_back(data, data + hidden);
+        }
+        return outputs;
+    }
+
+    // decodes the tokens after the prompt one by one, returns the outputs of the decoded tokens
+    std::vector<std::vector<float>> decode(PagedAttentionBlockManager::SequenceId id,
+                                           const Tokens& prompt,
+                                           const Tokens& generated) {
+        PagedAttentionBlockManager manager(num_blocks, block_size, false);
+        manager.addSequence(id, prompt);
+        auto tokens = prompt;
+        step(manager, id, tokens);
+        std::vector<std::vector<float>> outputs;
+        for (const auto token : generated) {
+            manager.appendTokens(id, {token});
+            tokens.push_back(token);
+            outputs.push_back(step(manager, id, tokens).front());
+        }
+        return outputs;
+    }
+
+    static void compare(const std::vector<float>& actual, const std::vector<float>& expected, const char* what) {
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); i++) {
+            ASSERT_NEAR(actual[i], expected[i], 1e-4f) << what << " index " << i;
+        }
+    }
+
+    ov::InferRequest m_infer_request;
+    ov::Tensor m_key_cache;
+    ov::Tensor m_value_cache;
+};
+
+TEST_P(PagedAttnSpeculativeDecodeTest, CompareWithTokenByTokenDecode) {
+    SKIP_IF_CURRENT_TEST_IS_DISABLED();
+    const auto& [prompt_len, draft_len, accepted] = GetParam();
+    init();
+
+    Tokens prompt(prompt_len);
+    std::iota(prompt.begin(), prompt.end(), 1);
+    Tokens draft(draft_len);
+    std::iota(draft.begin(), draft.end(), 5000);
+    // the token sampled by the target model instead of the first rejected draft token
+    const PagedAttentionBlockManager::Token correction = 9000;
+
+    Tokens generated(draft.begin(), draft.begin() + accepted);
+    generated.push_back(correction);
+    // the reference sequences reuse the cache blocks, so they are decoded before the verified one
+    const auto expected_draft = decode(1, prompt, draft);
+    const auto expected_correction = decode(2, prompt, generated).back();
+
+    PagedAttentionBlockManager manager(num_blocks, block_size);
+    manager.addSequence(0, prompt);
+    auto tokens = prompt;
+    step(manager, 0, tokens);
+
+    manager.appendTokens(0, draft);
+    tokens.insert(tokens.end(), draft.begin(), draft.end());
+    const auto verified = step(manager, 0, tokens);
+    ASSERT_EQ(verified.size(), draft_len);
+    for (size_t i = 0; i < draft_len; i++) {
+        compare(verified[i], expected_draft[i], "draft token");
+    }
+
+    manager.rollback(0, draft_len - accepted);
+    tokens.resize(prompt_len + accepted);
+    manager.appendTokens(0, {correction});
+    tokens.push_back(correction);
+    compare(step(manager, 0, tokens).front(), expected_correction, "correction token");
+}
+
+// the draft crossing the block boundary and the draft of the max length
+const std::vector<PagedAttnSpeculativeDecodeParams> smoke_params = {{40, 4, 2}, {60, 8, 0}, {70, 16, 15}};
+
+INSTANTIATE_TEST_SUITE_P(smoke_PagedAttnSpeculativeDecode,
+                         PagedAttnSpeculativeDecodeTest,
+                         ::testing::ValuesIn(smoke_params),
+                         PagedAttnSpeculativeDecodeTest::getTestCaseName);
+
+}  // namespace test
+}  // namespace ov
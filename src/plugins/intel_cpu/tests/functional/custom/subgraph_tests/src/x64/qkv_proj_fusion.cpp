@@ -2,15 +2,24 @@
 // SPDX-License-Identifier: Apache-2.0
 //
 
+#include <cstdint>
+#include <limits>
 #include <string>
 #include <vector>
 
 #include "common_test_utils/ov_tensor_utils.hpp"
 #include "openvino/runtime/exec_model_info.hpp"
 #include "shared_test_classes/base/ov_subgraph.hpp"
+#include "openvino/op/add.hpp"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
 #include "openvino/op/convert.hpp"
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
+#include "openvino/op/slice.hpp"
+#include "openvino/op/transpose.hpp"
 
 namespace ov {
 namespace test {
@@ -117,6 +126,176 @@ TEST_P(QKVProjFusionTest, CompareWithRefs) {
     check_results();
 }
 
+struct QKVProjRoPEFusionParams {
+    ov::test::InputShape inputShape;
+    size_t hidden;
+    size_t head_size;
+    size_t q_heads;
+    size_t kv_heads;
+    size_t rotary_ndims;
+    bool use_dynamic_quant;
+};
+
+// The rotate-half RoPE of q & k is fused into QKVProjection, the result is compared with the reference of the
+// original subgraph.
+class QKVProjRoPEFusionTest : public testing::WithParamInterface<QKVProjRoPEFusionParams>,
+                              public ov::test::SubgraphBaseTest {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<QKVProjRoPEFusionParams>& obj) {
+        std::ostringstream result;
+        result << "IS=" << ov::test::utils::partialShape2str({obj.param.inputShape.first}) << "_";
+        result << "TS=";
+        for (const auto& shape : obj.param.inputShape.second) {
+            result << ov::test::utils::vec2str(shape);
+            result << "_";
+        }
+        result << "hidden=" << obj.param.hidden << "_";
+        result << "head_size=" << obj.param.head_size << "_";
+        result << "q_heads=" << obj.param.q_heads << "_";
+        result << "kv_heads=" << obj.param.kv_heads << "_";
+        result << "rotary_ndims=" << obj.param.rotary_ndims << "_";
+        result << "use_dynamic_quant=" << obj.param.use_dynamic_quant << "_";
+        result << obj.index;
+        return result.str();
+    }
+
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+
+        auto& param = this->GetParam();
+
+        configuration[ov::hint::inference_precision.name()] = "bf16";
+        if (param.use_dynamic_quant) {
+            configuration.insert(
+                {ov::hint::dynamic_quantization_group_size.name(), std::numeric_limits<uint64_t>::max()});
+        }
+
+        // the cos & sin tables are [B, 1, L, rotary_ndims], so every batch reads its own positions
+        const auto rotary_ndims = static_cast<int64_t>(param.rotary_ndims);
+        ov::test::InputShape cosSinShape{ov::PartialShape{-1, 1, -1, rotary_ndims}, {}};
+        for (const auto& shape : param.inputShape.second) {
+            cosSinShape.second.push_back(ov::Shape{shape[0], 1, shape[1], param.rotary_ndims});
+        }
+        init_input_shapes({param.inputShape, cosSinShape, cosSinShape});
+
+        auto src = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[0]);
+        auto cos = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[1]);
+        auto sin = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, inputDynamicShapes[2]);
+
+        auto create_const = [&](size_t OC, size_t IC) -> std::shared_ptr<ov::Node> {
+            ov::test::utils::InputGenerateData in_data;
+            if (param.use_dynamic_quant) {
+                in_data.start_from = -128;
+                in_data.range = 256;
+                in_data.resolution = 256;
+                auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::i8, ov::Shape{OC, IC}, in_data);
+                auto weight_const_i8 = std::make_shared<ov::op::v0::Constant>(tensor);
+                auto weight_const_f32 = std::make_shared<ov::op::v0::Convert>(weight_const_i8, ov::element::f32);
+
+                in_data.start_from = 0;
+                in_data.range = 1;
+                in_data.resolution = 128;
+                auto tensor_scale_per_oc =
+                    ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{OC, 1}, in_data);
+                auto scale_per_oc = std::make_shared<ov::op::v0::Constant>(tensor_scale_per_oc);
+                return std::make_shared<ov::op::v1::Multiply>(weight_const_f32, scale_per_oc);
+            }
+            in_data.start_from = -0.5;
+            in_data.range = 1;
+            in_data.resolution = 128;
+            auto tensor = ov::test::utils::create_and_fill_tensor(ov::element::f32, ov::Shape{OC, IC}, in_data);
+            return std::make_shared<ov::op::v0::Constant>(tensor);
+        };
+        auto make_slice = [](const ov::Output<ov::Node>& data, int64_t start, int64_t stop) {
+            return std::make_shared<ov::op::v8::Slice>(data,
+                                                       ov::op::v0::Constant::create(ov::element::i64, {1}, {start}),
+                                                       ov::op::v0::Constant::create(ov::element::i64, {1}, {stop}),
+                                                       ov::op::v0::Constant::create(ov::element::i64, {1}, {1}),
+                                                       ov::op::v0::Constant::create(ov::element::i64, {1}, {3}));
+        };
+        // [B, L, H * S] => [B, H, L, S] with the rotate-half RoPE applied to the first rotary_ndims of every head
+        auto make_rope = [&](const std::shared_ptr<ov::Node>& proj, size_t heads) -> std::shared_ptr<ov::Node> {
+            const auto head_size = static_cast<int64_t>(param.head_size);
+            const auto int32_max = static_cast<int64_t>(std::numeric_limits<int32_t>::max());
+            auto target_shape = ov::op::v0::Constant::create(ov::element::i64,
+                                                             {4},
+                                                             {int64_t{0}, int64_t{0}, static_cast<int64_t>(heads),
+                                                              head_size});
+            auto reshape = std::make_shared<ov::op::v1::Reshape>(proj, target_shape, true);
+            auto transpose = std::make_shared<ov::op::v1::Transpose>(
+                reshape,
+                ov::op::v0::Constant::create(ov::element::i64, {4}, {0, 2, 1, 3}));
+
+            ov::Output<ov::Node> x = transpose;
+            if (rotary_ndims < head_size) {
+                x = make_slice(transpose, 0, rotary_ndims);
+            }
+            auto x1 = make_slice(x, 0, rotary_ndims / 2);
+            auto x2 = make_slice(x, rotary_ndims / 2, int32_max);
+            auto x2neg = std::make_shared<ov::op::v1::Multiply>(
+                x2,
+                ov::op::v0::Constant::create(ov::element::f32, {1, 1, 1, 1}, {-1.0f}));
+            auto x_rotate_half = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{x2neg, x1}, -1);
+            auto mul_cos = std::make_shared<ov::op::v1::Multiply>(x, cos);
+            auto mul_sin = std::make_shared<ov::op::v1::Multiply>(x_rotate_half, sin);
+            std::shared_ptr<ov::Node> rope = std::make_shared<ov::op::v1::Add>(mul_cos, mul_sin);
+            if (rotary_ndims < head_size) {
+                auto x_pass = make_slice(transpose, rotary_ndims, int32_max);
+                rope = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{rope, x_pass}, -1);
+            }
+            return rope;
+        };
+
+        const auto q_proj_size = param.q_heads * param.head_size;
+        const auto kv_proj_size = param.kv_heads * param.head_size;
+        auto q_proj = std::make_shared<ov::op::v0::MatMul>(src, create_const(q_proj_size, param.hidden), false, true);
+        auto k_proj = std::make_shared<ov::op::v0::MatMul>(src, create_const(kv_proj_size, param.hidden), false, true);
+        auto v_proj = std::make_shared<ov::op::v0::MatMul>(src, create_const(kv_proj_size, param.hidden), false, true);
+
+        function = std::make_shared<ov::Model>(
+            ov::OutputVector{make_rope(q_proj, param.q_heads), make_rope(k_proj, param.kv_heads), v_proj},
+            ov::ParameterVector{src, cos, sin});
+    }
+
+    void generate_inputs(const std::vector<ov::Shape>& targetInputStaticShapes) override {
+        SubgraphBaseTest::generate_inputs(targetInputStaticShapes);
+        // keep the cos & sin tables in the range of the real ones
+        const auto& funcInputs = function->inputs();
+        ov::test::utils::InputGenerateData in_data;
+        in_data.start_from = -1;
+        in_data.range = 2;
+        in_data.resolution = 32768;
+        for (size_t i = 1; i < funcInputs.size(); i++) {
+            inputs[funcInputs[i].get_node_shared_ptr()] =
+                ov::test::utils::create_and_fill_tensor(ov::element::f32, targetInputStaticShapes[i], in_data);
+        }
+    }
+
+    void check_results() {
+        auto exec_model = compiledModel.get_runtime_model();
+
+        int fused_node_found = 0;
+        int rope_node_found = 0;
+        for (const auto& n : exec_model->get_ordered_ops()) {
+            auto layer_type = n->get_rt_info().at(ov::exec_model_info::LAYER_TYPE).as<std::string>();
+            if (layer_type == "QKVProjection")
+                fused_node_found++;
+            if (layer_type == "RoPE")
+                rope_node_found++;
+        }
+        ASSERT_EQ(fused_node_found, 1);
+        ASSERT_EQ(rope_node_found, 0);
+    }
+};
+
+TEST_P(QKVProjRoPEFusionTest, CompareWithRefs) {
+    if (!ov::with_cpu_x86_avx512_core_amx_bf16())
+        GTEST_SKIP();
+    run();
+    check_results();
+}
+
 namespace {
 
 static ov::test::InputShape ishape_llama2_7b{ov::PartialShape{-1, -1, 4096}, {ov::Shape{1, 8, 4096}, ov::Shape{5, 7, 4096}}};
@@ -136,6 +315,27 @@ INSTANTIATE_TEST_SUITE_P(smoke_QKVProjFusion,
                          ::testing::ValuesIn(qkv_params),
                          QKVProjFusionTest::getTestCaseName);
 
+// B > 1 and L both below and above CACHE_BLK_M_SIZE (256) without being a multiple of it, so a block of rows
+// starts in the middle of a batch
+static ov::test::InputShape ishape_rope_4096{ov::PartialShape{-1, -1, 4096},
+                                             {ov::Shape{1, 8, 4096}, ov::Shape{3, 7, 4096}, ov::Shape{2, 300, 4096}}};
+static ov::test::InputShape ishape_rope_2048{ov::PartialShape{-1, -1, 2048},
+                                             {ov::Shape{1, 8, 2048}, ov::Shape{4, 5, 2048}, ov::Shape{3, 257, 2048}}};
+
+const std::vector<QKVProjRoPEFusionParams> qkv_rope_params = {
+    // Llama-7B
+    {ishape_rope_4096, 4096, 128, 32, 32, 128, false},
+    {ishape_rope_4096, 4096, 128, 32, 32, 128, true},
+    // GQA with a partial rotary embedding, as in Phi-2 & StableLM
+    {ishape_rope_2048, 2048, 128, 16, 4, 64, false},
+    {ishape_rope_2048, 2048, 128, 16, 4, 64, true},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_QKVProjRoPEFusion,
+                         QKVProjRoPEFusionTest,
+                         ::testing::ValuesIn(qkv_rope_params),
+                         QKVProjRoPEFusionTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
@@ -114,6 +114,51 @@ INSTANTIATE_TEST_SUITE_P(smoke_SubgraphCache, SubgraphCacheTest,
                                 ::testing::Values(ElementType::f32)),
                         SubgraphCacheTest::getTestCaseName);
 
+}  // namespace
+
+// The graph memoizes the output shapes per graph input shapes, so the shape inference is skipped when
+// the input shapes repeat (A, B, A). The Subgraph kernel must still be selected for the current input shapes.
+class SubgraphRepeatedShapesTest : public SubgraphCacheTest {
+protected:
+    void SetUp() override {
+        targetDevice = ov::test::utils::DEVICE_CPU;
+        const auto& [inputShapes, inputPrecision] = this->GetParam();
+        init_input_shapes(inputShapes);
+
+        configuration.insert(ov::intel_cpu::snippets_mode(ov::intel_cpu::SnippetsMode::IGNORE_CALLBACK));
+
+        ov::ParameterVector paramVec;
+        for (size_t i = 0; i < inputDynamicShapes.size(); i++) {
+            paramVec.push_back(std::make_shared<ov::op::v0::Parameter>(inputPrecision, inputDynamicShapes[i]));
+        }
+
+        auto add = std::make_shared<ov::op::v1::Add>(paramVec[0], paramVec[1]);
+        auto multiply = std::make_shared<ov::op::v1::Multiply>(add, paramVec[1]);
+        auto relu = std::make_shared<ov::op::v0::Relu>(multiply);
+        function = std::make_shared<ov::Model>(relu, paramVec, "SubgraphRepeatedShapes");
+    }
+};
+
+TEST_P(SubgraphRepeatedShapesTest, CompareWithRefs) {
+    run();
+
+    CheckNumberOfNodesWithType(compiledModel, "Subgraph", 1);
+}
+
+namespace {
+
+std::vector<InputShape> repeatedInputShapes {
+    {{-1, -1, -1, -1}, {{1, 3, 16, 16}, {2, 5, 7, 9}, {1, 3, 16, 16}, {2, 5, 7, 9}}},
+    // the broadcasting of the second input changes between the requests
+    {{-1, -1, -1, -1}, {{1, 3, 16, 16}, {2, 5, 1, 9}, {1, 3, 16, 16}, {2, 5, 1, 9}}},
+};
+
+INSTANTIATE_TEST_SUITE_P(smoke_SubgraphRepeatedShapes, SubgraphRepeatedShapesTest,
+                        ::testing::Combine(
+                                ::testing::Values(repeatedInputShapes),
+                                ::testing::Values(ElementType::f32)),
+                        SubgraphRepeatedShapesTest::getTestCaseName);
+
 }  // namespace
 }  // namespace test
 }  // namespace ov
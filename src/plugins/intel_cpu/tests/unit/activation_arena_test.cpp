@@ -0,0 +1,112 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <utility>
+
+#include "activation_arena.hpp"
+
+using namespace ov::intel_cpu;
+
+TEST(ActivationArenaTest, ReuseReturnedBuffer) {
+    auto arena = std::make_shared<ActivationArena>(-1);
+    ActivationArenaStatistics stats;
+
+    void* data = nullptr;
+    {
+        auto lease = arena->lease(1024, &stats);
+        ASSERT_TRUE(lease);
+        ASSERT_NE(lease.data(), nullptr);
+        ASSERT_EQ(lease.size(), 1024U);
+        ASSERT_EQ(arena->leased(), 1024U);
+        data = lease.data();
+    }
+    ASSERT_EQ(arena->leased(), 0U);
+    ASSERT_EQ(arena->allocated(), 1024U);
+
+    // the smaller lease is served by the pooled buffer
+    auto lease = arena->lease(512, &stats);
+    ASSERT_EQ(lease.data(), data);
+    ASSERT_EQ(arena->allocated(), 1024U);
+
+    // the concurrent lease needs a new buffer
+    auto otherLease = arena->lease(512, &stats);
+    ASSERT_NE(otherLease.data(), data);
+    ASSERT_EQ(arena->allocated(), 1536U);
+    ASSERT_EQ(arena->peakLeased(), 1536U);
+
+    ASSERT_EQ(stats.leases.load(), 3U);
+    ASSERT_EQ(stats.overcommits.load(), 0U);
+}
+
+TEST(ActivationArenaTest, MoveLease) {
+    auto arena = std::make_shared<ActivationArena>(-1);
+    auto lease = arena->lease(256);
+    ActivationArena::Lease otherLease;
+    ASSERT_FALSE(otherLease);
+
+    otherLease = std::move(lease);
+    ASSERT_TRUE(otherLease);
+    ASSERT_EQ(arena->leased(), 256U);
+
+    otherLease.reset();
+    ASSERT_FALSE(otherLease);
+    ASSERT_EQ(arena->leased(), 0U);
+}
+
+TEST(ActivationArenaTest, CapacityDropsPooledBuffers) {
+    auto arena = std::make_shared<ActivationArena>(-1, 1024);
+    arena->lease(256).reset();
+    ASSERT_EQ(arena->allocated(), 256U);
+
+    // the pooled buffer is too small, it is dropped to make room for the new one
+    auto lease = arena->lease(1024);
+    ASSERT_EQ(arena->allocated(), 1024U);
+
+    // the capacity can be exceeded by a single lease, otherwise it would never be served
+    lease.reset();
+    auto bigLease = arena->lease(4096);
+    ASSERT_EQ(arena->allocated(), 4096U);
+    bigLease.reset();
+
+    // the pool is trimmed to the capacity
+    ASSERT_EQ(arena->allocated(), 0U);
+}
+
+TEST(ActivationArenaTest, OvercommitInsteadOfWait) {
+    auto arena = std::make_shared<ActivationArena>(-1, 1024);
+    ActivationArenaStatistics stats;
+
+    // the second lease does not wait for the first one to be returned
+    auto lease = arena->lease(1024, &stats);
+    auto otherLease = arena->lease(1024, &stats);
+
+    ASSERT_EQ(arena->allocated(), 2048U);
+    ASSERT_EQ(stats.leases.load(), 2U);
+    ASSERT_EQ(stats.overcommits.load(), 1U);
+
+    lease.reset();
+    otherLease.reset();
+    ASSERT_EQ(arena->allocated(), 1024U);
+}
+
+TEST(ActivationArenaTest, LargestRequestedCapacity) {
+    auto arena = std::make_shared<ActivationArena>(-1);
+    arena->requestCapacity(2048);
+    ASSERT_EQ(arena->capacity(), 2048U);
+
+    // the client requesting less does not shrink the arena of the other ones
+    arena->requestCapacity(1024);
+    ASSERT_EQ(arena->capacity(), 2048U);
+    arena->requestCapacity(4096);
+    ASSERT_EQ(arena->capacity(), 4096U);
+
+    // unlimited capacity is the largest one
+    arena->requestCapacity(0);
+    ASSERT_EQ(arena->capacity(), 0U);
+    arena->requestCapacity(1024);
+    ASSERT_EQ(arena->capacity(), 0U);
+}
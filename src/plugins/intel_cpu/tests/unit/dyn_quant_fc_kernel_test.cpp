@@ -0,0 +1,192 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/x64/dyn_quant_fc.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// The kernels are called directly, so they are checked on any x64 machine. The DynQuantFC executor itself is selected
+// only on the cores without VNNI.
+
+namespace {
+
+using DynQuantFCKernelParams = std::tuple<size_t,  // M
+                                          size_t,  // K
+                                          size_t,  // group size
+                                          bool>;   // u4 weights
+
+class DynQuantFCKernelTest : public ::testing::TestWithParam<DynQuantFCKernelParams> {
+public:
+    static std::string getTestCaseName(const testing::TestParamInfo<DynQuantFCKernelParams>& obj) {
+        const auto& [M, K, group_size, weights_u4] = obj.param;
+        std::ostringstream result;
+        result << "M=" << M << "_K=" << K << "_group=" << group_size << "_wei=" << (weights_u4 ? "u4" : "u8");
+        return result.str();
+    }
+};
+
+// packs the chunks of 32 elements of a row: the low nibbles hold the first 16 elements, the high nibbles the others
+std::vector<uint8_t> pack_u4(const std::vector<uint8_t>& weights, size_t N, size_t K) {
+    std::vector<uint8_t> packed(N * K / 2);
+    for (size_t n = 0; n < N; n++) {
+        for (size_t i = 0; i < K; i += 32) {
+            for (size_t j = 0; j < 16; j++) {
+                const auto lo = weights[n * K + i + j];
+                const auto hi = weights[n * K + i + 16 + j];
+                packed[(n * K + i) / 2 + j] = static_cast<uint8_t>(lo | (hi << 4));
+            }
+        }
+    }
+    return packed;
+}
+
+TEST_P(DynQuantFCKernelTest, QuantizeSrc) {
+    const auto& [M, K, group_size, weights_u4] = GetParam();
+    const size_t groups = K / group_size;
+    // the rows of the source are strided to check that the stride is respected
+    const size_t src_stride = K + 8;
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-4.0F, 4.0F);
+    std::vector<float> src(M * src_stride);
+    for (auto& value : src) {
+        value = dist(gen);
+    }
+    // a zero group must not produce NaNs
+    for (size_t i = 0; i < group_size; i++) {
+        src[i] = 0.0F;
+    }
+
+    std::vector<int8_t> quantized(M * K);
+    std::vector<float> scales(M * groups);
+    std::vector<int32_t> sums(M * groups);
+    ov::Extensions::Cpu::XARCH::dyn_quant_fc_quantize_src(src.data(),
+                                                          src_stride,
+                                                          quantized.data(),
+                                                          scales.data(),
+                                                          sums.data(),
+                                                          M,
+                                                          K,
+                                                          group_size);
+
+    for (size_t m = 0; m < M; m++) {
+        for (size_t g = 0; g < groups; g++) {
+            const auto scale = scales[m * groups + g];
+            float amax = 0.0F;
+            int32_t sum = 0;
+            for (size_t i = g * group_size; i < (g + 1) * group_size; i++) {
+                const auto value = src[m * src_stride + i];
+                const auto q = quantized[m * K + i];
+                amax = std::max(amax, std::abs(value));
+                sum += q;
+                ASSERT_GE(q, -127);
+                ASSERT_NEAR(q * scale, value, scale * 0.5F + 1e-6F) << "m=" << m << " i=" << i;
+            }
+            ASSERT_NEAR(scale, amax / 127.0F, 1e-6F) << "m=" << m << " g=" << g;
+            ASSERT_EQ(sums[m * groups + g], sum) << "m=" << m << " g=" << g;
+        }
+    }
+}
+
+TEST_P(DynQuantFCKernelTest, MatchesReference) {
+    const auto& [M, K, group_size, weights_u4] = GetParam();
+    const size_t N = 24;
+    const size_t groups = K / group_size;
+    const size_t dst_stride = N + 3;
+    // only a part of the output channels is computed, as by one thread of the executor
+    const size_t n_begin = 5;
+    const size_t n_end = 21;
+
+    std::mt19937 gen(7);
+    std::uniform_int_distribution<int> src_dist(-127, 127);
+    std::uniform_int_distribution<int> wei_dist(0, weights_u4 ? 15 : 255);
+    std::uniform_real_distribution<float> scale_dist(0.001F, 0.05F);
+    std::uniform_real_distribution<float> bias_dist(-1.0F, 1.0F);
+
+    std::vector<int8_t> src(M * K);
+    std::vector<float> src_scales(M * groups);
+    std::vector<int32_t> src_sums(M * groups, 0);
+    for (size_t m = 0; m < M; m++) {
+        for (size_t i = 0; i < K; i++) {
+            src[m * K + i] = static_cast<int8_t>(src_dist(gen));
+            src_sums[m * groups + i / group_size] += src[m * K + i];
+        }
+        for (size_t g = 0; g < groups; g++) {
+            src_scales[m * groups + g] = scale_dist(gen);
+        }
+    }
+
+    std::vector<uint8_t> weights(N * K);
+    for (auto& value : weights) {
+        value = static_cast<uint8_t>(wei_dist(gen));
+    }
+    std::vector<float> weights_scales(N * groups);
+    std::vector<float> weights_zps(N * groups);
+    for (size_t i = 0; i < N * groups; i++) {
+        weights_scales[i] = scale_dist(gen);
+        weights_zps[i] = static_cast<float>(wei_dist(gen));
+    }
+    std::vector<float> bias(N);
+    for (auto& value : bias) {
+        value = bias_dist(gen);
+    }
+
+    const auto kernel_weights = weights_u4 ? pack_u4(weights, N, K) : weights;
+    const float untouched = -12345.0F;
+    std::vector<float> dst(M * dst_stride, untouched);
+    ov::Extensions::Cpu::XARCH::dyn_quant_fc_kernel(src.data(),
+                                                    src_scales.data(),
+                                                    src_sums.data(),
+                                                    M,
+                                                    kernel_weights.data(),
+                                                    weights_u4,
+                                                    weights_scales.data(),
+                                                    weights_zps.data(),
+                                                    bias.data(),
+                                                    dst.data(),
+                                                    dst_stride,
+                                                    n_begin,
+                                                    n_end,
+                                                    K,
+                                                    group_size);
+
+    for (size_t m = 0; m < M; m++) {
+        for (size_t n = 0; n < N; n++) {
+            const auto result = dst[m * dst_stride + n];
+            if (n < n_begin || n >= n_end) {
+                ASSERT_EQ(result, untouched) << "m=" << m << " n=" << n;
+                continue;
+            }
+            double expected = bias[n];
+            for (size_t g = 0; g < groups; g++) {
+                double acc = 0.0;
+                for (size_t i = g * group_size; i < (g + 1) * group_size; i++) {
+                    acc += static_cast<double>(src[m * K + i]) * (weights[n * K + i] - weights_zps[n * groups + g]);
+                }
+                expected += acc * src_scales[m * groups + g] * weights_scales[n * groups + g];
+            }
+            ASSERT_NEAR(result, expected, 1e-4 * (std::abs(expected) + 1.0)) << "m=" << m << " n=" << n;
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_DynQuantFCKernel,
+                         DynQuantFCKernelTest,
+                         ::testing::Combine(::testing::Values(1, 3, 16),
+                                            ::testing::Values(64, 256, 4096),
+                                            ::testing::Values(32, 64),
+                                            ::testing::Bool()),
+                         DynQuantFCKernelTest::getTestCaseName);
+
+}  // namespace
@@ -0,0 +1,43 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include "dynamic_shapes_cache.h"
+
+using namespace ov::intel_cpu;
+
+TEST(DynamicShapesCacheTests, HitMiss) {
+    DynamicShapesCache cache(2, {true, false});
+
+    auto record = cache.lookUp({{1, 10}});
+    ASSERT_EQ(cache.misses(), 1U);
+    ASSERT_EQ(cache.hits(), 0U);
+
+    ASSERT_NE(record->outputShapes(0), nullptr);
+    ASSERT_TRUE(record->outputShapes(0)->empty());
+    ASSERT_EQ(record->outputShapes(1), nullptr);
+    *record->outputShapes(0) = {{1, 10, 64}};
+
+    auto sameRecord = cache.lookUp({{1, 10}});
+    ASSERT_EQ(cache.hits(), 1U);
+    ASSERT_EQ(sameRecord, record);
+    ASSERT_EQ(*sameRecord->outputShapes(0), std::vector<VectorDims>{{1, 10, 64}});
+
+    auto otherRecord = cache.lookUp({{1, 20}});
+    ASSERT_EQ(cache.misses(), 2U);
+    ASSERT_NE(otherRecord, record);
+    ASSERT_TRUE(otherRecord->outputShapes(0)->empty());
+}
+
+TEST(DynamicShapesCacheTests, Evict) {
+    DynamicShapesCache cache(1, {true});
+
+    cache.lookUp({{1, 10}});
+    cache.lookUp({{1, 20}});
+    cache.lookUp({{1, 10}});
+
+    ASSERT_EQ(cache.hits(), 0U);
+    ASSERT_EQ(cache.misses(), 3U);
+}
@@ -0,0 +1,149 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/executors/dnnl/dnnl_gathermatmul_executor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "config.h"
+#include "cpu_memory.h"
+#include "graph_context.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "memory_desc/cpu_memory_desc_utils.h"
+#include "nodes/executors/executor.hpp"
+#include "nodes/executors/memory_arguments.hpp"
+#include "openvino/runtime/system_conf.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t expertsNum = 4;
+constexpr size_t N = 32;
+constexpr size_t K = 64;
+constexpr size_t groupSize = 32;
+constexpr size_t tokensNum = 32;
+constexpr size_t topK = 2;
+
+// the parameter is whether the weights are compressed to u8
+class GatherMatmulDnnlExecutorTest : public ::testing::TestWithParam<bool> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<bool>& obj) {
+        return obj.param ? "CompressedWeights" : "F32Weights";
+    }
+};
+
+TEST_P(GatherMatmulDnnlExecutorTest, GroupedGemm) {
+    const bool compressed = GetParam();
+    if (compressed && !ov::with_cpu_x86_avx2()) {
+        GTEST_SKIP() << "The compressed weights require AVX2";
+    }
+
+    Config conf;
+    conf.rtCacheCapacity = 100;
+    auto context = std::make_shared<GraphContext>(conf, nullptr, false);
+    auto executorContext = std::make_shared<ExecutorContext>(
+        context,
+        std::vector<impl_desc_type>{},
+        std::make_shared<std::unordered_map<std::string, MemoryPtr>>());
+    const auto& engine = context->getEngine();
+    auto makeMemory = [&engine](ov::element::Type precision, const VectorDims& dims) {
+        return std::make_shared<Memory>(engine, CpuBlockedMemoryDesc(precision, Shape(dims)));
+    };
+
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+    std::uniform_int_distribution<int> u8Dist(0, 255);
+
+    // the source rows are shared by all the experts a token is routed to
+    auto src = makeMemory(ov::element::f32, {1, tokensNum, K});
+    auto* srcData = src->getDataAs<float>();
+    for (size_t i = 0; i < tokensNum * K; i++) {
+        srcData[i] = dist(gen);
+    }
+
+    // the experts get 32, 14, 14 and 4 rows, so the last one is computed by GEMV and the others by GEMM
+    auto index = makeMemory(ov::element::i32, {tokensNum, topK});
+    auto* indexData = index->getDataAs<int32_t>();
+    for (size_t m = 0; m < tokensNum; m++) {
+        indexData[m * topK] = 0;
+        indexData[m * topK + 1] = m < tokensNum - 4 ? static_cast<int32_t>(1 + m % 2) : 3;
+    }
+
+    // the dequantized weights for the reference
+    std::vector<float> weights(expertsNum * N * K);
+    MemoryPtr weightsMem;
+    MemoryPtr scalesMem = MemoryDescUtils::makeEmptyMemory(context);
+    MemoryPtr zpMem = MemoryDescUtils::makeEmptyMemory(context);
+    if (compressed) {
+        constexpr size_t groupsNum = K / groupSize;
+        weightsMem = makeMemory(ov::element::u8, {expertsNum, N, K});
+        scalesMem = makeMemory(ov::element::f32, {expertsNum, N, groupsNum});
+        zpMem = makeMemory(ov::element::f32, {expertsNum, N, groupsNum});
+        auto* weightsData = weightsMem->getDataAs<uint8_t>();
+        auto* scalesData = scalesMem->getDataAs<float>();
+        auto* zpData = zpMem->getDataAs<float>();
+        for (size_t i = 0; i < expertsNum * N * groupsNum; i++) {
+            scalesData[i] = 0.01F * (1.0F + dist(gen));
+            zpData[i] = static_cast<float>(u8Dist(gen));
+        }
+        for (size_t i = 0; i < expertsNum * N * K; i++) {
+            weightsData[i] = static_cast<uint8_t>(u8Dist(gen));
+            const size_t group = i / groupSize;
+            weights[i] = (static_cast<float>(weightsData[i]) - zpData[group]) * scalesData[group];
+        }
+    } else {
+        weightsMem = makeMemory(ov::element::f32, {expertsNum, N, K});
+        auto* weightsData = weightsMem->getDataAs<float>();
+        for (size_t i = 0; i < expertsNum * N * K; i++) {
+            weightsData[i] = weights[i] = dist(gen);
+        }
+    }
+
+    auto dst = makeMemory(ov::element::f32, {topK, tokensNum, N});
+
+    MemoryArgs memory;
+    memory[ARG_SRC] = src;
+    memory[ARG_WEI] = weightsMem;
+    memory[ARG_SRC_1] = index;
+    memory[ARG_BIAS] = MemoryDescUtils::makeEmptyMemory(context);
+    memory[ARG_SRC_3] = scalesMem;
+    memory[ARG_SRC_4] = zpMem;
+    memory[ARG_DST] = dst;
+
+    GatherMatmulDnnlExecutor executor(GatherMatmulAttrs{}, memory, executorContext);
+    ASSERT_TRUE(executor.groupedGemm()) << "The rows routed to an expert are expected to be computed by GEMM";
+    ASSERT_TRUE(executor.update(memory));
+    executor.execute(memory);
+
+    const auto* dstData = dst->getDataAs<float>();
+    for (size_t m = 0; m < tokensNum; m++) {
+        for (size_t i = 0; i < topK; i++) {
+            const auto* expertWeights = &weights[indexData[m * topK + i] * N * K];
+            for (size_t n = 0; n < N; n++) {
+                float expected = 0.0F;
+                for (size_t k = 0; k < K; k++) {
+                    expected += srcData[m * K + k] * expertWeights[n * K + k];
+                }
+                ASSERT_NEAR(dstData[(i * tokensNum + m) * N + n], expected, 1e-3F)
+                    << "token " << m << ", expert " << indexData[m * topK + i] << ", n " << n;
+            }
+        }
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_GatherMatmul,
+                         GatherMatmulDnnlExecutorTest,
+                         ::testing::Bool(),
+                         GatherMatmulDnnlExecutorTest::getTestCaseName);
+
+}  // namespace
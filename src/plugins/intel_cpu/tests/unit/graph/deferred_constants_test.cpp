@@ -0,0 +1,71 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include "graph.h"
+#include "openvino/op/concat.hpp"
+#include "openvino/op/constant.hpp"
+#include "openvino/op/convert.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/result.hpp"
+#include "openvino/runtime/make_tensor.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+/*
+ * The constants of the graph activated with the deferred constants are prepared in the background,
+ * the first inference must wait for them and produce the same result as the eagerly activated graph.
+ *
+ *   Parameter   Constant(f16)
+ *       |           |
+ *       |        Convert
+ *        \         /
+ *          Concat
+ *            |
+ *          Result
+ */
+TEST(DeferredConstantsTest, smoke_Infer_With_Deferred_Constants) {
+    const ov::Shape shape{2, 4};
+    std::vector<float> values(ov::shape_size(shape));
+    std::iota(values.begin(), values.end(), 0.0F);
+
+    auto param = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, shape);
+    auto constant = ov::op::v0::Constant::create(ov::element::f16, shape, values);
+    auto convert = std::make_shared<ov::op::v0::Convert>(constant, ov::element::f32);
+    auto concat = std::make_shared<ov::op::v0::Concat>(ov::OutputVector{param, convert}, 0);
+    auto result = std::make_shared<ov::op::v0::Result>(concat);
+    auto model = std::make_shared<ov::Model>(ov::ResultVector{result}, ov::ParameterVector{param});
+
+    Config conf;
+    conf.rtCacheCapacity = 0;
+    conf.enableLazyWeightsRepacking = true;
+    auto context = std::make_shared<GraphContext>(conf, std::make_shared<WeightsSharing>(), false);
+
+    Graph graph;
+    graph.Init(model, context);
+    graph.Activate(true);
+
+    for (size_t infer = 0; infer < 2; infer++) {
+        auto input = ov::make_tensor(ov::element::f32, shape);
+        std::fill_n(input->data<float>(), values.size(), -1.0F);
+        graph.PushInputData(0, input);
+        graph.Infer();
+
+        const auto& output = graph.getOutputNodeByIndex(0)->getParentEdgeAt(0)->getMemory();
+        const auto* data = output.getDataAs<const float>();
+        for (size_t i = 0; i < values.size(); i++) {
+            ASSERT_EQ(data[i], -1.0F);
+            ASSERT_EQ(data[values.size() + i], values[i]);
+        }
+    }
+
+    // the constants are ready after the first inference
+    graph.WaitForConstants();
+}
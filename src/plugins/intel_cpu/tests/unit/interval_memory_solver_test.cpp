@@ -0,0 +1,232 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "interval_memory_solver.hpp"
+#include "memory_control.hpp"
+#include "openvino/runtime/memory_solver.hpp"
+
+using namespace ov::intel_cpu;
+using Box = ov::MemorySolver::Box;
+
+namespace {
+
+void checkPlacement(const std::vector<Box>& boxes, const IntervalMemorySolver& solver, int64_t total, size_t alignment) {
+    int maxTs = 0;
+    for (const auto& box : boxes) {
+        maxTs = std::max({maxTs, box.start, box.finish});
+    }
+    auto finish = [maxTs](const Box& box) {
+        return box.finish == -1 ? maxTs : box.finish;
+    };
+
+    for (size_t i = 0; i < boxes.size(); i++) {
+        const auto& l = boxes[i];
+        const auto lOffset = solver.getOffset(l.id);
+        ASSERT_EQ(lOffset % static_cast<int64_t>(alignment), 0) << "box " << l.id;
+        ASSERT_LE(lOffset + l.size, total) << "box " << l.id;
+        for (size_t j = i + 1; j < boxes.size(); j++) {
+            const auto& r = boxes[j];
+            const bool timeOverlap = l.start <= finish(r) && r.start <= finish(l);
+            if (!timeOverlap || l.size == 0 || r.size == 0) {
+                continue;
+            }
+            const auto rOffset = solver.getOffset(r.id);
+            const bool memOverlap = lOffset < rOffset + r.size && rOffset < lOffset + l.size;
+            ASSERT_FALSE(memOverlap) << "boxes " << l.id << " and " << r.id;
+        }
+    }
+    ASSERT_GE(total, solver.lowerBound());
+}
+
+// the way MemoryManagerStatic solves the boxes by default
+int64_t solveDefault(std::vector<Box> boxes) {
+    constexpr int64_t alignment = 32;
+    for (auto& box : boxes) {
+        box.size = (box.size + alignment - 1) / alignment;
+    }
+    ov::MemorySolver solver(boxes);
+    return solver.solve() * alignment;
+}
+
+std::vector<Box> randomBoxes(std::mt19937& gen, size_t count, int duration) {
+    std::uniform_int_distribution<int> startDist(0, duration - 1);
+    std::geometric_distribution<int> lifetimeDist(0.3);
+    std::uniform_int_distribution<int64_t> sizeDist(1, 1 << 20);
+    std::uniform_int_distribution<int> kindDist(0, 9);
+
+    std::vector<Box> boxes;
+    for (size_t i = 0; i < count; i++) {
+        const int start = startDist(gen);
+        const int kind = kindDist(gen);
+        int finish = std::min(start + 1 + lifetimeDist(gen), duration);
+        if (kind == 0) {
+            finish = -1;
+        }
+        int64_t size = sizeDist(gen);
+        if (kind == 1 && !boxes.empty()) {
+            // same lifetime as the previous box, like the outputs of a multi-output node
+            boxes.push_back({boxes.back().start, boxes.back().finish, size, static_cast<int64_t>(i)});
+            continue;
+        }
+        boxes.push_back({start, finish, size, static_cast<int64_t>(i)});
+    }
+    return boxes;
+}
+
+std::vector<Box> staticBoxes(const MemoryRegions& regions) {
+    std::vector<Box> boxes;
+    for (const auto& reg : regions) {
+        if (reg.size >= 0 && reg.type == MemoryRegion::RegionType::VARIABLE &&
+            reg.alloc_type == MemoryRegion::AllocType::POD) {
+            boxes.push_back({reg.start, reg.finish, reg.size, reg.id});
+        }
+    }
+    return boxes;
+}
+
+}  // namespace
+
+TEST(IntervalMemorySolverTest, Chain) {
+    // every box is consumed by the next one, so two slots are enough
+    std::vector<Box> boxes;
+    for (int i = 0; i < 10; i++) {
+        boxes.push_back({i, i + 1, 1000, i});
+    }
+    IntervalMemorySolver solver(boxes);
+    const auto total = solver.solve();
+    checkPlacement(boxes, solver, total, IntervalMemorySolver::defaultAlignment);
+    ASSERT_EQ(total, 2 * 1024);
+    ASSERT_EQ(total, solver.lowerBound());
+}
+
+TEST(IntervalMemorySolverTest, Alignment) {
+    std::vector<Box> boxes = {{0, 2, 1, 0}, {1, 3, 33, 1}, {2, 4, 65, 2}, {0, -1, 0, 3}};
+    IntervalMemorySolver solver(boxes, 32);
+    const auto total = solver.solve();
+    checkPlacement(boxes, solver, total, 32);
+    ASSERT_EQ(total, 32 + 64 + 96);
+}
+
+TEST(IntervalMemorySolverTest, SameLifetimeClustering) {
+    std::vector<Box> boxes = {{2, 5, 128, 0}, {2, 5, 64, 1}, {2, 5, 256, 2}, {0, 3, 64, 3}, {4, 7, 64, 4}};
+    IntervalMemorySolver solver(boxes);
+    const auto total = solver.solve();
+    checkPlacement(boxes, solver, total, IntervalMemorySolver::defaultAlignment);
+
+    // the boxes with the same lifetime are packed contiguously in the descending size order
+    ASSERT_EQ(solver.getOffset(0), solver.getOffset(2) + 256);
+    ASSERT_EQ(solver.getOffset(1), solver.getOffset(0) + 128);
+    ASSERT_EQ(total, solver.lowerBound());
+}
+
+TEST(IntervalMemorySolverTest, BestFitGap) {
+    // the released box 1 leaves a gap between the boxes 0 and 2, which is reused by the box 4
+    std::vector<Box> boxes = {{0, 10, 512, 0}, {0, 1, 256, 1}, {0, 3, 128, 2}, {0, 2, 64, 3}, {2, 10, 128, 4}};
+    IntervalMemorySolver solver(boxes);
+    const auto total = solver.solve();
+    checkPlacement(boxes, solver, total, IntervalMemorySolver::defaultAlignment);
+    ASSERT_EQ(solver.getOffset(1), 512);
+    ASSERT_EQ(solver.getOffset(4), 512);
+    ASSERT_EQ(total, solver.lowerBound());
+}
+
+TEST(IntervalMemorySolverTest, UnknownBoxId) {
+    IntervalMemorySolver solver({{0, 1, 64, 0}});
+    solver.solve();
+    ASSERT_THROW((void)solver.getOffset(1), ov::Exception);
+}
+
+TEST(IntervalMemorySolverTest, Random) {
+    std::mt19937 gen(42);
+    for (size_t i = 0; i < 50; i++) {
+        auto boxes = randomBoxes(gen, 200, 150);
+        IntervalMemorySolver solver(boxes);
+        const auto total = solver.solve();
+        checkPlacement(boxes, solver, total, IntervalMemorySolver::defaultAlignment);
+    }
+}
+
+TEST(IntervalMemorySolverTest, RegionsSerialization) {
+    MemoryRegions regions = {{0, 3, 128, 0, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD},
+                             {1, -1, -1, 1, MemoryRegion::RegionType::VARIABLE, MemoryRegion::AllocType::POD},
+                             {0, 5, 64, 2, MemoryRegion::RegionType::INPUT, MemoryRegion::AllocType::STRING}};
+    std::stringstream stream;
+    writeMemoryRegions(stream, regions);
+    auto restored = readMemoryRegions(stream);
+
+    ASSERT_EQ(restored.size(), regions.size());
+    for (size_t i = 0; i < regions.size(); i++) {
+        ASSERT_EQ(restored[i].start, regions[i].start);
+        ASSERT_EQ(restored[i].finish, regions[i].finish);
+        ASSERT_EQ(restored[i].size, regions[i].size);
+        ASSERT_EQ(restored[i].id, regions[i].id);
+        ASSERT_EQ(restored[i].type, regions[i].type);
+        ASSERT_EQ(restored[i].alloc_type, regions[i].alloc_type);
+    }
+
+    std::stringstream broken("0 3 128\n");
+    ASSERT_THROW(readMemoryRegions(broken), ov::Exception);
+}
+
+// Compares the solvers on the region dumps of real models (see OV_CPU_MEMORY_REGIONS_DUMP_DIR debug capability)
+TEST(IntervalMemorySolverTest, Corpus) {
+    const char* corpusDir = std::getenv("OV_CPU_MEMORY_REGIONS_CORPUS");
+    if (corpusDir == nullptr) {
+        GTEST_SKIP() << "OV_CPU_MEMORY_REGIONS_CORPUS is not set";
+    }
+
+    std::cout << std::left << std::setw(48) << "dump" << std::right << std::setw(8) << "regions" << std::setw(14)
+              << "lower bound" << std::setw(14) << "default" << std::setw(14) << "interval" << std::setw(10)
+              << "ratio" << std::setw(12) << "time [us]" << "\n";
+
+    int64_t defaultSum = 0;
+    int64_t intervalSum = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(corpusDir)) {
+        if (entry.path().extension() != ".regions") {
+            continue;
+        }
+        std::ifstream input(entry.path());
+        const auto boxes = staticBoxes(readMemoryRegions(input));
+        if (boxes.empty()) {
+            continue;
+        }
+
+        const auto defaultTotal = solveDefault(boxes);
+        const auto startTime = std::chrono::steady_clock::now();
+        IntervalMemorySolver solver(boxes);
+        const auto intervalTotal = solver.solve();
+        const auto time =
+            std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+        checkPlacement(boxes, solver, intervalTotal, IntervalMemorySolver::defaultAlignment);
+
+        defaultSum += defaultTotal;
+        intervalSum += intervalTotal;
+        std::cout << std::left << std::setw(48) << entry.path().filename().string() << std::right << std::setw(8)
+                  << boxes.size() << std::setw(14) << solver.lowerBound() << std::setw(14) << defaultTotal
+                  << std::setw(14) << intervalTotal << std::setw(10) << std::fixed << std::setprecision(3)
+                  << static_cast<double>(intervalTotal) / static_cast<double>(defaultTotal) << std::setw(12)
+                  << time.count() << "\n";
+    }
+
+    if (defaultSum > 0) {
+        std::cout << "total: default " << defaultSum << " interval " << intervalSum << " ratio "
+                  << static_cast<double>(intervalSum) / static_cast<double>(defaultSum) << "\n";
+    }
+}
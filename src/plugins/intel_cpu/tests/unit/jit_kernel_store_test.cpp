@@ -0,0 +1,189 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "cache/jit_kernel_store.h"
+#include "openvino/core/except.hpp"
+
+#if defined(__linux__)
+#    include <sys/mman.h>
+#    include <unistd.h>
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t codeSize = 20;
+
+// mov rax, <address of the constant below>; mov eax, [rax]; ret; nop x3; dd 42
+class TestKernel {
+public:
+    TestKernel() {
+        void* memory = mmap(nullptr, 4096, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        OPENVINO_ASSERT(memory != MAP_FAILED);
+        m_code = static_cast<uint8_t*>(memory);
+        const uint8_t code[] = {0x48, 0xB8, 0, 0, 0, 0, 0, 0, 0, 0, 0x8B, 0x00, 0xC3, 0x90, 0x90, 0x90, 42, 0, 0, 0};
+        std::memcpy(m_code, code, sizeof(code));
+        const auto constant = reinterpret_cast<uint64_t>(m_code + 16);
+        std::memcpy(m_code + 2, &constant, sizeof(constant));
+    }
+    ~TestKernel() {
+        munmap(m_code, 4096);
+    }
+
+    uint8_t* code() const {
+        return m_code;
+    }
+
+private:
+    uint8_t* m_code;
+};
+
+class JitKernelStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        const auto name = "jit_kernel_store_test_" + std::to_string(getpid());
+        m_dir = (std::filesystem::temp_directory_path() / name).string();
+        std::filesystem::remove_all(m_dir);
+    }
+    void TearDown() override {
+        std::filesystem::remove_all(m_dir);
+    }
+
+    std::string m_dir;
+};
+
+}  // namespace
+
+TEST_F(JitKernelStoreTest, Relocations) {
+    TestKernel kernel, sameKernel;
+    std::vector<uint32_t> relocations;
+    ASSERT_TRUE(JitKernelStore::findRelocations(kernel.code(), sameKernel.code(), codeSize, relocations));
+    ASSERT_EQ(relocations, std::vector<uint32_t>{2});
+
+    // the absolute address of the process data can not be relocated
+    static int data = 0;
+    const auto address = reinterpret_cast<uint64_t>(&data);
+    std::memcpy(kernel.code() + 12, &address, sizeof(address));
+    std::memcpy(sameKernel.code() + 12, &address, sizeof(address));
+    ASSERT_FALSE(JitKernelStore::findRelocations(kernel.code(), sameKernel.code(), codeSize, relocations));
+}
+
+TEST_F(JitKernelStoreTest, RelativeDisplacement) {
+    TestKernel kernel, sameKernel;
+    // call rel32 to the same target outside the code, so the displacements of the copies differ
+    const auto target = reinterpret_cast<uint64_t>(kernel.code()) + 4096 * 16;
+    for (auto* code : {kernel.code(), sameKernel.code()}) {
+        const auto displacement = static_cast<uint32_t>(target - (reinterpret_cast<uint64_t>(code) + 15));
+        code[10] = 0xE8;
+        std::memcpy(code + 11, &displacement, sizeof(displacement));
+    }
+    std::vector<uint32_t> relocations;
+    ASSERT_FALSE(JitKernelStore::findRelocations(kernel.code(), sameKernel.code(), codeSize, relocations));
+
+    JitKernelStore store(m_dir + "/kernels.bin", 1 << 20);
+    ASSERT_FALSE(store.store("kernel", kernel.code(), sameKernel.code(), codeSize));
+}
+
+TEST_F(JitKernelStoreTest, StoreLoad) {
+    TestKernel kernel, sameKernel;
+    {
+        JitKernelStore store(m_dir + "/kernels.bin", 1 << 20);
+        ASSERT_EQ(store.load("kernel"), nullptr);
+        ASSERT_TRUE(store.store("kernel", kernel.code(), sameKernel.code(), codeSize));
+    }
+
+    JitKernelStore store(m_dir + "/kernels.bin", 1 << 20);
+    const auto code = store.load("kernel");
+    ASSERT_NE(code, nullptr);
+    ASSERT_EQ(store.hits(), 1U);
+    ASSERT_EQ(reinterpret_cast<int (*)()>(const_cast<uint8_t*>(code->get()))(), 42);
+    ASSERT_EQ(store.load("another kernel"), nullptr);
+}
+
+TEST_F(JitKernelStoreTest, Corrupted) {
+    TestKernel kernel, sameKernel;
+    const auto path = m_dir + "/kernels.bin";
+    {
+        JitKernelStore store(path, 1 << 20);
+        ASSERT_TRUE(store.store("kernel", kernel.code(), sameKernel.code(), codeSize));
+    }
+    {
+        std::fstream file(path, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(-3, std::ios::end);
+        file.put(0x55);
+    }
+
+    JitKernelStore store(path, 1 << 20);
+    ASSERT_EQ(store.load("kernel"), nullptr);
+}
+
+TEST_F(JitKernelStoreTest, SizeCap) {
+    TestKernel kernel, sameKernel;
+    const auto path = m_dir + "/kernels.bin";
+    {
+        JitKernelStore store(path, 1 << 20);
+        for (int i = 0; i < 50; i++) {
+            ASSERT_TRUE(store.store("kernel" + std::to_string(i), kernel.code(), sameKernel.code(), codeSize));
+        }
+    }
+
+    constexpr size_t sizeCap = 512;
+    JitKernelStore store(path, sizeCap);
+    ASSERT_LE(std::filesystem::file_size(path), sizeCap);
+    // the most recently added records are kept
+    ASSERT_NE(store.load("kernel49"), nullptr);
+    ASSERT_EQ(store.load("kernel0"), nullptr);
+}
+
+TEST_F(JitKernelStoreTest, CompactionKeepsConcurrentAppends) {
+    TestKernel kernel, sameKernel;
+    const auto path = m_dir + "/kernels.bin";
+    JitKernelStore first(path, 1 << 20);
+    for (int i = 0; i < 50; i++) {
+        ASSERT_TRUE(first.store("kernel" + std::to_string(i), kernel.code(), sameKernel.code(), codeSize));
+    }
+    // the records appended by another store after its open are seen by the compaction
+    JitKernelStore second(path, 1 << 20);
+    ASSERT_TRUE(second.store("appended", kernel.code(), sameKernel.code(), codeSize));
+
+    JitKernelStore compacted(path, 1024);
+    ASSERT_LE(std::filesystem::file_size(path), 1024U);
+    ASSERT_NE(compacted.load("appended"), nullptr);
+}
+
+TEST_F(JitKernelStoreTest, UntrustedDirectory) {
+    TestKernel kernel, sameKernel;
+    std::filesystem::create_directories(m_dir);
+    std::filesystem::permissions(m_dir, std::filesystem::perms::others_write, std::filesystem::perm_options::add);
+
+    JitKernelStore store(m_dir + "/kernels.bin", 1 << 20);
+    ASSERT_FALSE(store.store("kernel", kernel.code(), sameKernel.code(), codeSize));
+    ASSERT_FALSE(std::filesystem::exists(m_dir + "/kernels.bin"));
+}
+
+TEST_F(JitKernelStoreTest, UntrustedFile) {
+    TestKernel kernel, sameKernel;
+    const auto path = m_dir + "/kernels.bin";
+    {
+        JitKernelStore store(path, 1 << 20);
+        ASSERT_EQ(std::filesystem::status(m_dir).permissions() & std::filesystem::perms::all,
+                  std::filesystem::perms::owner_all);
+        ASSERT_TRUE(store.store("kernel", kernel.code(), sameKernel.code(), codeSize));
+    }
+    std::filesystem::permissions(path, std::filesystem::perms::group_write, std::filesystem::perm_options::add);
+
+    JitKernelStore store(path, 1 << 20);
+    ASSERT_EQ(store.load("kernel"), nullptr);
+}
+
+#endif  // __linux__
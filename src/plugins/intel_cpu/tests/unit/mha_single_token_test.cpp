@@ -0,0 +1,160 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include "nodes/kernels/scaled_attn/mha_single_token.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "cpu_parallel.hpp"
+#include "openvino/core/parallel.hpp"
+#include "utils/plain_tensor.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+// a single query of a single head doesn't occupy the threads, so the KV cache of this length is split among them
+constexpr size_t kvLen = 2048;
+constexpr size_t headSize = 16;
+constexpr int threadsNum = 8;
+
+template <typename F>
+void runWithThreads(int threads, const F& func) {
+#if OV_THREAD_USE_TBB
+    tbb::task_arena arena(threads);
+    arena.execute(func);
+#elif OV_THREAD == OV_THREAD_OMP
+    const auto prevThreads = parallel_get_max_threads();
+    parallel_set_num_threads(threads);
+    func();
+    parallel_set_num_threads(prevThreads);
+#else
+    (void)threads;
+    func();
+#endif
+}
+
+class MhaSingleTokenSplitKvTest : public ::testing::TestWithParam<size_t> {
+public:
+    static std::string getTestCaseName(const ::testing::TestParamInfo<size_t>& obj) {
+        return "MaskedLen" + std::to_string(obj.param);
+    }
+
+protected:
+    void SetUp() override {
+        std::mt19937 gen(42);
+        std::uniform_real_distribution<float> dist(-1.0F, 1.0F);
+        for (auto* data : {&m_query, &m_key, &m_value}) {
+            data->resize(data == &m_query ? headSize : kvLen * headSize);
+            std::generate(data->begin(), data->end(), [&] {
+                return dist(gen);
+            });
+        }
+        // the leading tokens are masked, so the first parts of the split cache are fully masked
+        m_mask.assign(kvLen, 0.0F);
+        std::fill_n(m_mask.begin(), GetParam(), -std::numeric_limits<float>::infinity());
+    }
+
+    std::vector<float> reference() const {
+        const float scale = 1.0F / std::sqrt(static_cast<float>(headSize));
+        std::vector<float> logits(kvLen);
+        for (size_t pk = 0; pk < kvLen; pk++) {
+            float dot = 0.0F;
+            for (size_t i = 0; i < headSize; i++) {
+                dot += m_query[i] * m_key[pk * headSize + i];
+            }
+            logits[pk] = dot * scale + m_mask[pk];
+        }
+        std::vector<float> output(headSize, 0.0F);
+        const float max = *std::max_element(logits.begin(), logits.end());
+        if (max == -std::numeric_limits<float>::infinity()) {
+            // nothing to attend to
+            return output;
+        }
+        float sum = 0.0F;
+        for (auto& logit : logits) {
+            logit = std::exp(logit - max);
+            sum += logit;
+        }
+        for (size_t pk = 0; pk < kvLen; pk++) {
+            for (size_t i = 0; i < headSize; i++) {
+                output[i] += logits[pk] / sum * m_value[pk * headSize + i];
+            }
+        }
+        return output;
+    }
+
+    std::vector<float> m_query;
+    std::vector<float> m_key;
+    std::vector<float> m_value;
+    std::vector<float> m_mask;
+};
+
+TEST_P(MhaSingleTokenSplitKvTest, CompareWithReference) {
+#if OV_THREAD == OV_THREAD_SEQ
+    GTEST_SKIP() << "The KV cache is split only among several threads";
+#endif
+    PlainTensor query;
+    PlainTensor presentKey;
+    PlainTensor presentValue;
+    PlainTensor attentionMask;
+    query.resize<float>({1, 1, 1, headSize}, m_query.data());
+    presentKey.resize<float>({1, 1, kvLen, headSize}, m_key.data());
+    presentValue.resize<float>({1, 1, kvLen, headSize}, m_value.data());
+    attentionMask.resize<float>({1, 1, 1, kvLen}, m_mask.data());
+
+    std::vector<float> output(headSize, std::numeric_limits<float>::quiet_NaN());
+    PlainTensor outputEmb;
+    outputEmb.resize<float>({1, 1, 1, headSize}, output.data());
+    PlainTensor bufAttnW;
+    bufAttnW.resize<float>({1, 1, 1, kvLen});
+    PlainTensor bufAttnScore;
+    PlainTensor headSum;
+    const auto cpuParallel = std::make_shared<CpuParallel>(TbbPartitioner::STATIC);
+
+    runWithThreads(threadsNum, [&] {
+        ov::Extensions::Cpu::XARCH::mha_single_token(query,
+                                                     presentKey,
+                                                     presentValue,
+                                                     PlainTensor(),
+                                                     attentionMask,
+                                                     PlainTensor(),
+                                                     outputEmb,
+                                                     bufAttnW,
+                                                     bufAttnScore,
+                                                     false,
+                                                     false,
+                                                     0.0F,
+                                                     PlainTensor(),
+                                                     PlainTensor(),
+                                                     headSum,
+                                                     headSize,
+                                                     headSize,
+                                                     false,
+                                                     PlainTensor(),
+                                                     cpuParallel);
+    });
+
+    const auto expected = reference();
+    for (size_t i = 0; i < headSize; i++) {
+        ASSERT_NEAR(output[i], expected[i], 1e-4F) << "at " << i;
+    }
+}
+
+INSTANTIATE_TEST_SUITE_P(smoke_MhaSingleToken,
+                         MhaSingleTokenSplitKvTest,
+                         // no masked part, fully masked parts, a part masked partially and the whole row masked
+                         ::testing::Values(0, 1024, 1100, kvLen),
+                         MhaSingleTokenSplitKvTest::getTestCaseName);
+
+}  // namespace
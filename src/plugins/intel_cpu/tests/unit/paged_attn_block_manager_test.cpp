@@ -0,0 +1,168 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <numeric>
+#include <vector>
+
+#include "nodes/kernels/scaled_attn/paged_attn_block_manager.hpp"
+#include "openvino/core/except.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+constexpr size_t kBlockSize = 4;
+
+std::vector<PagedAttentionBlockManager::Token> makeTokens(size_t count, int64_t first = 0) {
+    std::vector<PagedAttentionBlockManager::Token> tokens(count);
+    std::iota(tokens.begin(), tokens.end(), first);
+    return tokens;
+}
+
+// computes the prompt of the sequence in one step
+void prefill(PagedAttentionBlockManager& manager, PagedAttentionBlockManager::SequenceId id) {
+    (void)manager.reserve(id);
+    manager.commit(id);
+}
+
+}  // namespace
+
+TEST(PagedAttentionBlockManagerTest, SharesComputedPrefix) {
+    PagedAttentionBlockManager manager(16, kBlockSize);
+    auto prefix = makeTokens(8);
+
+    auto first = prefix;
+    first.push_back(100);
+    ASSERT_EQ(manager.addSequence(0, first), 0U);
+    prefill(manager, 0);
+
+    auto second = prefix;
+    second.insert(second.end(), {200, 201, 202});
+    ASSERT_EQ(manager.addSequence(1, second), 8U);
+    ASSERT_TRUE(manager.reserve(1).empty());
+
+    const auto& table0 = manager.blockTable(0);
+    const auto& table1 = manager.blockTable(1);
+    ASSERT_EQ(table1.size(), 3U);
+    ASSERT_EQ(table0[0], table1[0]);
+    ASSERT_EQ(table0[1], table1[1]);
+    ASSERT_NE(table0[2], table1[2]);
+
+    const auto inputs = manager.inputs({1});
+    ASSERT_EQ(inputs.pastLens, std::vector<int32_t>{8});
+    ASSERT_EQ(inputs.subsequenceBegins, (std::vector<int32_t>{0, 3}));
+    ASSERT_EQ(inputs.blockIndices, table1);
+    ASSERT_EQ(inputs.blockIndicesBegins, (std::vector<int32_t>{0, 3}));
+
+    const auto stats = manager.statistics();
+    ASSERT_EQ(stats.usedBlocks, 4U);
+    ASSERT_EQ(stats.sharedBlocks, 2U);
+    ASSERT_EQ(stats.prefixHitTokens, 8U);
+}
+
+TEST(PagedAttentionBlockManagerTest, CopyOnWriteOfFullyCachedPrompt) {
+    PagedAttentionBlockManager manager(16, kBlockSize);
+    const auto prompt = makeTokens(8);
+    manager.addSequence(0, prompt);
+    prefill(manager, 0);
+
+    // the last token is computed again, so the last shared block is copied
+    ASSERT_EQ(manager.addSequence(1, prompt), 7U);
+    const auto shared = manager.blockTable(1)[1];
+    const auto copies = manager.reserve(1);
+    ASSERT_EQ(copies.size(), 1U);
+    ASSERT_EQ(copies[0].src, shared);
+    ASSERT_EQ(copies[0].dst, manager.blockTable(1)[1]);
+    ASSERT_EQ(manager.blockTable(0)[1], shared);
+
+    // the copy has the same content as the cached block, so it is released by the commit
+    const auto freeBlocks = manager.freeBlocks();
+    manager.commit(1);
+    ASSERT_EQ(manager.blockTable(1)[1], shared);
+    ASSERT_EQ(manager.freeBlocks(), freeBlocks + 1);
+}
+
+TEST(PagedAttentionBlockManagerTest, ForkedSequencesCopyPartialBlock) {
+    PagedAttentionBlockManager manager(16, kBlockSize);
+    manager.addSequence(0, makeTokens(6));
+    prefill(manager, 0);
+    manager.forkSequence(0, 1);
+
+    manager.appendTokens(0, {10});
+    manager.appendTokens(1, {20});
+    const auto copies0 = manager.reserve(0);
+    ASSERT_EQ(copies0.size(), 1U);
+    // the last owner writes to the block in place
+    ASSERT_TRUE(manager.reserve(1).empty());
+    ASSERT_EQ(manager.blockTable(0)[0], manager.blockTable(1)[0]);
+    ASSERT_NE(manager.blockTable(0)[1], manager.blockTable(1)[1]);
+
+    std::vector<uint8_t> cache(16 * 2);
+    std::iota(cache.begin(), cache.end(), 0);
+    PagedAttentionBlockManager::copyBlocks(copies0, cache.data(), 2);
+    ASSERT_EQ(cache[copies0[0].dst * 2], copies0[0].src * 2);
+    ASSERT_EQ(cache[copies0[0].dst * 2 + 1], copies0[0].src * 2 + 1);
+}
+
+TEST(PagedAttentionBlockManagerTest, EvictsLeastRecentlyUsedCachedBlocks) {
+    PagedAttentionBlockManager manager(4, kBlockSize);
+    manager.addSequence(0, makeTokens(8));
+    prefill(manager, 0);
+    manager.removeSequence(0);
+    ASSERT_EQ(manager.statistics().cachedBlocks, 2U);
+    ASSERT_EQ(manager.freeBlocks(), 4U);
+
+    // the cached blocks are evicted when the free ones are over, the prefix block is evicted last
+    manager.addSequence(1, makeTokens(12, 100));
+    prefill(manager, 1);
+    ASSERT_EQ(manager.statistics().cachedBlocks, 1U);
+    ASSERT_EQ(manager.addSequence(2, makeTokens(8)), 4U);
+
+    ASSERT_THROW(manager.addSequence(2, makeTokens(8)), ov::Exception);
+    manager.removeSequence(1);
+    manager.removeSequence(2);
+    ASSERT_EQ(manager.statistics().usedBlocks, 0U);
+}
+
+TEST(PagedAttentionBlockManagerTest, PrefixCachingDisabled) {
+    PagedAttentionBlockManager manager(16, kBlockSize, false);
+    manager.addSequence(0, makeTokens(8));
+    prefill(manager, 0);
+    ASSERT_EQ(manager.addSequence(1, makeTokens(8)), 0U);
+    prefill(manager, 1);
+    ASSERT_EQ(manager.statistics().usedBlocks, 4U);
+    ASSERT_EQ(manager.statistics().sharedBlocks, 0U);
+}
+
+TEST(PagedAttentionBlockManagerTest, RollbackOfRejectedDraftTokens) {
+    PagedAttentionBlockManager manager(16, kBlockSize);
+    manager.addSequence(0, makeTokens(6));
+    prefill(manager, 0);
+
+    // the draft tokens are verified in one step, the last three are rejected
+    manager.appendTokens(0, makeTokens(4, 100));
+    ASSERT_TRUE(manager.reserve(0).empty());
+    const auto table = manager.blockTable(0);
+    ASSERT_EQ(manager.inputs({0}).subsequenceBegins, (std::vector<int32_t>{0, 4}));
+    manager.commit(0);
+    manager.rollback(0, 3);
+    ASSERT_EQ(manager.computedTokens(0), 7U);
+    ASSERT_EQ(manager.blockTable(0), table);
+
+    // the slots of the rejected tokens are overwritten by the next step, the block with them is cached meanwhile
+    manager.appendTokens(0, {200});
+    const auto copies = manager.reserve(0);
+    ASSERT_EQ(copies.size(), 1U);
+    ASSERT_EQ(copies[0].src, table[1]);
+    const auto inputs = manager.inputs({0});
+    ASSERT_EQ(inputs.pastLens, std::vector<int32_t>{7});
+    ASSERT_EQ(inputs.subsequenceBegins, (std::vector<int32_t>{0, 1}));
+
+    ASSERT_THROW(manager.rollback(0, 1), ov::Exception);
+    manager.commit(0);
+    ASSERT_THROW(manager.rollback(0, 9), ov::Exception);
+}
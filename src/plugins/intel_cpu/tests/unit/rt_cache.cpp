@@ -7,6 +7,8 @@
 #include <gtest/gtest.h>
 #include <gmock/gmock.h>
 
+#include "cache/cache_budget.h"
+#include "cache/concurrent_lru_cache.h"
 #include "cache/lru_cache.h"
 #include "cache/multi_cache.h"
 #include "common_test_utils/test_assertions.hpp"
@@ -380,3 +382,127 @@ TEST(MultiCacheTests, SmokeTypeIdSync) {
         vecThreads.emplace_back(std::thread(testRoutine, std::ref(vecCache[i])));
     }
 }
+
+TEST(MultiCacheTests, SharedCache) {
+    using IntValueType = std::shared_ptr<int>;
+
+    constexpr int capacity = 1000;
+    constexpr size_t numThreads = 8;
+
+    auto intBuilder = [&](const IntKey& key) { return std::make_shared<int>(key.data); };
+
+    MultiCache cache(capacity);
+
+    auto testRoutine = [&]() {
+        for (int i = 0; i < capacity; ++i) {
+            auto intResult = cache.getOrCreate(IntKey{i}, intBuilder);
+            ASSERT_NE(intResult.first, IntValueType());
+            ASSERT_EQ(*intResult.first, i);
+        }
+    };
+
+    {
+        std::vector<ScopedThread> vecThreads;
+        vecThreads.reserve(numThreads);
+        for (size_t i = 0; i < numThreads; ++i) {
+            vecThreads.emplace_back(std::thread(testRoutine));
+        }
+    }
+
+    const auto& stats = cache.getStatistics();
+    ASSERT_EQ(stats.hits.load() + stats.misses.load(), numThreads * capacity);
+    ASSERT_GE(stats.misses.load(), static_cast<uint64_t>(capacity));
+    ASSERT_EQ(stats.evictions.load(), 0U);
+}
+
+TEST(ConcurrentLruCacheTests, ByteBudget) {
+    constexpr size_t capacity = 100;
+    constexpr size_t recordCost = 10;
+    auto budget = std::make_shared<CacheMemoryBudget>(5 * recordCost);
+    auto stats = std::make_shared<CacheStatistics>();
+    {
+        ConcurrentLruCache<IntKey, int> cache(capacity, budget, stats);
+        for (int i = 1; i <= 10; ++i) {
+            OV_ASSERT_NO_THROW(cache.put({i}, i, recordCost));
+        }
+        ASSERT_EQ(cache.size(), 5U);
+        ASSERT_EQ(budget->used(), 5 * recordCost);
+        ASSERT_EQ(stats->bytes.load(), 5 * recordCost);
+        ASSERT_EQ(stats->evictions.load(), 5U);
+
+        for (int i = 1; i <= 5; ++i) {
+            ASSERT_EQ(cache.get({i}), int());
+        }
+        for (int i = 6; i <= 10; ++i) {
+            ASSERT_EQ(cache.get({i}), i);
+        }
+
+        // the record exceeding the whole budget is not stored
+        OV_ASSERT_NO_THROW(cache.put({11}, 11, 6 * recordCost));
+        ASSERT_EQ(cache.get({11}), int());
+    }
+    // the budget is released on destruction
+    ASSERT_EQ(budget->used(), 0U);
+}
+
+TEST(ConcurrentLruCacheTests, SharedByteBudget) {
+    constexpr size_t capacity = 100;
+    constexpr size_t recordCost = 10;
+    auto budget = std::make_shared<CacheMemoryBudget>(4 * recordCost);
+
+    ConcurrentLruCache<IntKey, int> first(capacity, budget);
+    ConcurrentLruCache<IntKey, int> second(capacity, budget);
+    for (int i = 1; i <= 4; ++i) {
+        first.put({i}, i, recordCost);
+    }
+    ASSERT_EQ(first.size(), 4U);
+    ASSERT_EQ(first.get({1}), 1);
+
+    // the least recently used records of all the caches sharing the budget are evicted
+    second.put({1}, 1, recordCost);
+    second.put({2}, 2, recordCost);
+    ASSERT_EQ(first.size(), 2U);
+    ASSERT_EQ(first.get({1}), 1);
+    ASSERT_EQ(first.get({4}), 4);
+    ASSERT_EQ(second.size(), 2U);
+    ASSERT_EQ(budget->used(), 4 * recordCost);
+
+    budget->setLimit(0);
+    second.put({3}, 3, recordCost);
+    ASSERT_EQ(second.size(), 3U);
+}
+
+TEST(ConcurrentLruCacheTests, ReclaimKeepsStoredRecord) {
+    constexpr size_t capacity = 100;
+    constexpr size_t recordCost = 10;
+    auto budget = std::make_shared<CacheMemoryBudget>(4 * recordCost);
+
+    ConcurrentLruCache<IntKey, int> first(capacity, budget);
+    ConcurrentLruCache<IntKey, int> second(capacity, budget);
+    first.put({1}, 1, recordCost);
+
+    // the record just stored is the only one of its cache, so the records of the other cache are evicted instead
+    second.put({1}, 1, 4 * recordCost);
+    ASSERT_EQ(first.size(), 0U);
+    ASSERT_EQ(second.get({1}), 1);
+    ASSERT_EQ(budget->used(), 4 * recordCost);
+
+    // the stored record is kept even if it is the least recently used one in the budget
+    second.put({2}, 2, 4 * recordCost);
+    ASSERT_EQ(second.get({1}), int());
+    ASSERT_EQ(second.get({2}), 2);
+}
+
+TEST(ConcurrentLruCacheTests, ShardedLruPolicy) {
+    constexpr size_t capacity = 4096;
+    ConcurrentLruCache<IntKey, int> cache(capacity);
+    for (int i = 0; i < static_cast<int>(capacity); ++i) {
+        cache.put({i}, i);
+    }
+    // each shard keeps its own LRU order, so the number of evicted records is exact only overall
+    for (int i = static_cast<int>(capacity); i < static_cast<int>(2 * capacity); ++i) {
+        cache.put({i}, i);
+    }
+    ASSERT_LE(cache.size(), capacity);
+    ASSERT_EQ(cache.get({static_cast<int>(2 * capacity) - 1}), static_cast<int>(2 * capacity) - 1);
+}
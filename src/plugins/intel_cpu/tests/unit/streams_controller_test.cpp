@@ -0,0 +1,107 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+#include <optional>
+#include <string>
+
+#include "streams_controller.hpp"
+
+using namespace ov::intel_cpu;
+using namespace std::chrono_literals;
+
+namespace {
+
+class StreamsControllerTest : public ::testing::Test {
+protected:
+    StreamsControllerTest()
+        : m_now(StreamsController::Clock::now()),
+          m_controller({{1, 8}, {2, 4}, {4, 2}, {8, 1}}, 1, {}, m_now) {}
+
+    // submits the samples for the whole window with the given queue depth and streams utilization
+    std::optional<size_t> window(size_t queueDepth, float utilization) {
+        const auto& candidate = m_controller.candidates()[m_controller.current()];
+        const auto window = StreamsController::Settings{}.window;
+        const size_t samples = 32;
+        const auto busyTime = std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::duration_cast<std::chrono::microseconds>(window * candidate.streams) * utilization / samples);
+        for (size_t i = 0; i < samples; i++) {
+            m_controller.record({queueDepth, busyTime * 2, busyTime});
+        }
+        m_now += window;
+        return m_controller.evaluate(m_now);
+    }
+
+    StreamsController::Clock::time_point m_now;
+    StreamsController m_controller;
+};
+
+}  // namespace
+
+TEST_F(StreamsControllerTest, ScalesUpWhenSaturated) {
+    ASSERT_FALSE(window(8, 1.0F).has_value());
+    ASSERT_FALSE(window(8, 1.0F).has_value());
+    ASSERT_EQ(window(8, 1.0F), 2U);
+    ASSERT_EQ(m_controller.current(), 2U);
+
+    ASSERT_EQ(m_controller.decisions().size(), 1U);
+    const auto& decision = m_controller.decisions().front();
+    ASSERT_EQ(decision.from.streams, 2);
+    ASSERT_EQ(decision.to.streams, 4);
+    ASSERT_NE(decision.toString().find("streams 2x4 -> 4x2"), std::string::npos);
+}
+
+TEST_F(StreamsControllerTest, ScalesDownWhenIdle) {
+    ASSERT_FALSE(window(0, 0.1F).has_value());
+    ASSERT_FALSE(window(0, 0.1F).has_value());
+    ASSERT_EQ(window(0, 0.1F), 0U);
+    // the candidate with the fewest streams is the last one
+    ASSERT_FALSE(window(0, 0.1F).has_value());
+    for (size_t i = 0; i < 3; i++) {
+        ASSERT_FALSE(window(0, 0.1F).has_value());
+    }
+    ASSERT_EQ(m_controller.current(), 0U);
+}
+
+TEST_F(StreamsControllerTest, QueueOfIdleStreamsIsNotScaledUp) {
+    // the requests are queued, but the streams are not saturated, e.g. the requests wait for the inputs
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_FALSE(window(8, 0.3F).has_value());
+    }
+    ASSERT_TRUE(m_controller.decisions().empty());
+}
+
+TEST_F(StreamsControllerTest, Hysteresis) {
+    // the opposite windows reset the trend
+    for (size_t i = 0; i < 4; i++) {
+        ASSERT_FALSE(window(8, 1.0F).has_value());
+        ASSERT_FALSE(window(0, 0.1F).has_value());
+    }
+    // the load in between the thresholds keeps the configuration
+    for (size_t i = 0; i < 5; i++) {
+        ASSERT_FALSE(window(2, 1.0F).has_value());
+    }
+    ASSERT_EQ(m_controller.current(), 1U);
+
+    ASSERT_FALSE(window(8, 1.0F).has_value());
+    ASSERT_FALSE(window(8, 1.0F).has_value());
+    ASSERT_EQ(window(8, 1.0F), 2U);
+    // the window after the switch is skipped
+    ASSERT_FALSE(window(0, 0.1F).has_value());
+    ASSERT_FALSE(window(0, 0.1F).has_value());
+    ASSERT_FALSE(window(0, 0.1F).has_value());
+    ASSERT_EQ(window(0, 0.1F), 1U);
+}
+
+TEST_F(StreamsControllerTest, WindowWithFewSamplesIsExtended) {
+    for (size_t i = 0; i < 3; i++) {
+        m_controller.record({8, 1ms, 1ms});
+        m_now += 10s;
+        ASSERT_FALSE(m_controller.evaluate(m_now).has_value());
+    }
+    ASSERT_TRUE(m_controller.decisions().empty());
+}
@@ -0,0 +1,85 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+#include "openvino/core/except.hpp"
+#include "openvino/core/model.hpp"
+#include "openvino/op/parameter.hpp"
+#include "openvino/op/scaled_dot_product_attention.hpp"
+#include "openvino/pass/manager.hpp"
+#include "openvino/runtime/internal_properties.hpp"
+#include "transformations/cpu_opset/common/pass/apply_kv_cache_precision_policy.hpp"
+#include "utils/kv_cache_precision_policy.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+
+const KVCachePrecision f16{ov::element::f16, ov::internal::CacheQuantAlgorithm::SCALAR};
+const KVCachePrecision u8{ov::element::u8, ov::internal::CacheQuantAlgorithm::SCALAR};
+const KVCachePrecision u4{ov::element::u4, ov::internal::CacheQuantAlgorithm::SCALAR};
+const KVCachePrecision tbq3{ov::element::u3, ov::internal::CacheQuantAlgorithm::TURBO};
+
+}  // namespace
+
+TEST(KVCachePrecisionPolicyTest, LaterRulesOverrideEarlierOnes) {
+    const KVCachePrecisionPolicy policy("*:u4; 0-1:f16; 6-:key=u8,value=tbq3; 3:value=u8");
+    ASSERT_FALSE(policy.empty());
+
+    const auto first = policy.get(0);
+    ASSERT_EQ(first.key, f16);
+    ASSERT_EQ(first.value, f16);
+    ASSERT_EQ(policy.get(2).key, u4);
+    ASSERT_EQ(policy.get(3).key, u4);
+    ASSERT_EQ(policy.get(3).value, u8);
+    const auto deep = policy.get(100);
+    ASSERT_EQ(deep.key, u8);
+    ASSERT_EQ(deep.value, tbq3);
+    ASSERT_EQ(deep.value->to_string(), "tbq3");
+}
+
+TEST(KVCachePrecisionPolicyTest, UncoveredLayersKeepModelPrecision) {
+    const KVCachePrecisionPolicy policy("2-3:key=u4");
+    ASSERT_FALSE(policy.get(1).key.has_value());
+    ASSERT_EQ(policy.get(2).key, u4);
+    ASSERT_FALSE(policy.get(2).value.has_value());
+    ASSERT_TRUE(KVCachePrecisionPolicy("").empty());
+}
+
+TEST(KVCachePrecisionPolicyTest, WrongPolicy) {
+    for (const auto* policy : {"u4", "a:u4", "3-1:u4", "0:i4", "0:key=u4,val=u8", "0-:key"}) {
+        ASSERT_THROW(KVCachePrecisionPolicy{policy}, ov::Exception) << policy;
+    }
+}
+
+TEST(KVCachePrecisionPolicyTest, AnnotatesAttentionLayers) {
+    auto make_sdpa = [](const ov::Output<ov::Node>& input) {
+        return std::make_shared<ov::op::v13::ScaledDotProductAttention>(input, input, input, false);
+    };
+    auto input = std::make_shared<ov::op::v0::Parameter>(ov::element::f32, ov::PartialShape{1, 8, -1, 64});
+    auto sdpa0 = make_sdpa(input);
+    auto sdpa1 = make_sdpa(sdpa0);
+    auto sdpa2 = make_sdpa(sdpa1);
+    // the precision set for the layer explicitly takes priority over the policy
+    sdpa2->get_rt_info()[KEY_CACHE_PRECISION_RT_INFO] = std::string("u8");
+    auto model = std::make_shared<ov::Model>(ov::OutputVector{sdpa2}, ov::ParameterVector{input});
+
+    ov::pass::Manager manager;
+    manager.register_pass<ApplyKVCachePrecisionPolicy>(KVCachePrecisionPolicy("1-:tbq4;0:value=f16"),
+                                                       [](const ov::element::Type&, bool) {
+                                                           return false;
+                                                       });
+    manager.run_passes(model);
+
+    const auto& rt0 = sdpa0->get_rt_info();
+    ASSERT_EQ(rt0.count(KEY_CACHE_PRECISION_RT_INFO), 0U);
+    ASSERT_EQ(rt0.at(VALUE_CACHE_PRECISION_RT_INFO).as<std::string>(), "f16");
+    ASSERT_EQ(sdpa1->get_rt_info().at(KEY_CACHE_PRECISION_RT_INFO).as<std::string>(), "tbq4");
+    ASSERT_EQ(sdpa2->get_rt_info().at(KEY_CACHE_PRECISION_RT_INFO).as<std::string>(), "u8");
+    ASSERT_EQ(sdpa2->get_rt_info().at(VALUE_CACHE_PRECISION_RT_INFO).as<std::string>(), "tbq4");
+}
@@ -17,7 +17,9 @@
 #include "openvino/op/matmul.hpp"
 #include "openvino/op/multiply.hpp"
 #include "openvino/op/parameter.hpp"
+#include "openvino/op/reshape.hpp"
 #include "openvino/pass/visualize_tree.hpp"
+#include "ov_ops/rotary_positional_embeddings.hpp"
 
 using namespace testing;
 using namespace ov::pass;
@@ -36,7 +38,8 @@ TEST_F(TransformationTestsF, QKVProjFusion1Test) {
     auto weights_combined = false;
     {
         auto input_multiply_const = std::make_shared<v0::Constant>(element::f32, Shape{1, 1, hidden_size});
-        auto input_param = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
         auto input_multiply = std::make_shared<v1::Multiply>(input_multiply_const, input_param);
 
         auto q_proj_weight_const = std::make_shared<v0::Constant>(element::f16, Shape{q_proj_size, hidden_size});
@@ -60,7 +63,8 @@ TEST_F(TransformationTestsF, QKVProjFusion1Test) {
     }
     {
         auto input_multiply_const = std::make_shared<v0::Constant>(element::f32, Shape{1, 1, hidden_size});
-        auto input_param = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
         auto input_multiply = std::make_shared<v1::Multiply>(input_multiply_const, input_param);
 
         auto q_proj_weight_const = std::make_shared<v0::Constant>(element::f16, Shape{q_proj_size, hidden_size});
@@ -83,4 +87,84 @@ TEST_F(TransformationTestsF, QKVProjFusion1Test) {
         auto v_proj = std::make_shared<v0::Result>(qkv_proj->output(2));
         model_ref = std::make_shared<ov::Model>(OutputVector{q_proj, k_proj, v_proj}, ParameterVector{input_param});
     }
-}
\ No newline at end of file
+}
+
+TEST_F(TransformationTestsF, QKVProjRoPEFusionTest) {
+    disable_rt_info_check();
+    disable_result_friendly_names_check();
+
+    size_t hidden_size = 2048;
+    size_t head_size = 64;
+    size_t q_proj_size = 2048;
+    size_t k_proj_size = 256;
+    size_t v_proj_size = 256;
+
+    op::internal::RoPE::Config rope_config;
+    rope_config.input_trans0213 = true;
+    rope_config.rotary_ndims = head_size;
+    rope_config.cos_sin_ndims = head_size;
+    {
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        auto cos = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 1, -1, static_cast<int>(head_size)});
+        auto sin = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 1, -1, static_cast<int>(head_size)});
+
+        auto make_proj = [&](size_t proj_size) {
+            auto weight_const = std::make_shared<v0::Constant>(element::f16, Shape{proj_size, hidden_size});
+            auto weight_cvt = std::make_shared<v0::Convert>(weight_const, element::f32);
+            return std::make_shared<v0::MatMul>(input_param, weight_cvt, false, true);
+        };
+        auto make_rope = [&](const std::shared_ptr<Node>& proj, size_t proj_size) {
+            auto shape = v0::Constant::create(element::i64,
+                                              Shape{4},
+                                              {int64_t{0}, int64_t{0}, static_cast<int64_t>(proj_size / head_size),
+                                               static_cast<int64_t>(head_size)});
+            auto reshape = std::make_shared<v1::Reshape>(proj, shape, true);
+            return std::make_shared<op::internal::RoPE>(OutputVector{reshape, cos, sin}, rope_config);
+        };
+        auto q_rope = make_rope(make_proj(q_proj_size), q_proj_size);
+        auto k_rope = make_rope(make_proj(k_proj_size), k_proj_size);
+        auto v_proj = make_proj(v_proj_size);
+
+        model =
+            std::make_shared<ov::Model>(OutputVector{q_rope, k_rope, v_proj}, ParameterVector{input_param, cos, sin});
+        manager.register_pass<ov::intel_cpu::QKVProjFusion>();
+        manager.get_pass_config()->set_callback<ov::intel_cpu::QKVProjFusionPass1>(
+            [=](const std::shared_ptr<const ov::Node>) -> bool {
+                return true;
+            });
+        manager.get_pass_config()->set_callback<ov::intel_cpu::QKVProjRoPEFusion>(
+            [=](const std::shared_ptr<const ov::Node>) -> bool {
+                return true;
+            });
+    }
+    {
+        auto input_param =
+            std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, -1, static_cast<int>(hidden_size)});
+        auto cos = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 1, -1, static_cast<int>(head_size)});
+        auto sin = std::make_shared<v0::Parameter>(element::f32, PartialShape{-1, 1, -1, static_cast<int>(head_size)});
+
+        auto q_proj_weight_const = std::make_shared<v0::Constant>(element::f16, Shape{q_proj_size, hidden_size});
+        auto k_proj_weight_const = std::make_shared<v0::Constant>(element::f16, Shape{k_proj_size, hidden_size});
+        auto v_proj_weight_const = std::make_shared<v0::Constant>(element::f16, Shape{v_proj_size, hidden_size});
+
+        intel_cpu::QKVProjectionNode::Config config{false,
+                                                    static_cast<int>(hidden_size),
+                                                    static_cast<int>(q_proj_size),
+                                                    static_cast<int>(k_proj_size),
+                                                    static_cast<int>(v_proj_size),
+                                                    false};
+        config.rope_head_size = static_cast<int>(head_size);
+        config.rope_rotary_ndims = static_cast<int>(head_size);
+        config.rope_cos_sin_ndims = static_cast<int>(head_size);
+        auto qkv_proj = std::make_shared<intel_cpu::QKVProjectionNode>(
+            OutputVector{input_param, q_proj_weight_const, k_proj_weight_const, v_proj_weight_const, cos, sin},
+            config);
+
+        auto q_proj = std::make_shared<v0::Result>(qkv_proj->output(0));
+        auto k_proj = std::make_shared<v0::Result>(qkv_proj->output(1));
+        auto v_proj = std::make_shared<v0::Result>(qkv_proj->output(2));
+        model_ref =
+            std::make_shared<ov::Model>(OutputVector{q_proj, k_proj, v_proj}, ParameterVector{input_param, cos, sin});
+    }
+}
@@ -0,0 +1,78 @@
+// Copyright (C) 2018-2026 Intel Corporation
+// SPDX-License-Identifier: Apache-2.0
+//
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <set>
+
+#include "cpu_memory.h"
+#include "memory_desc/cpu_blocked_memory_desc.h"
+#include "openvino/runtime/system_conf.hpp"
+#include "weights_cache.hpp"
+
+using namespace ov::intel_cpu;
+
+namespace {
+MemoryPtr createMemory() {
+    static const dnnl::engine eng(dnnl::engine::kind::cpu, 0);
+    auto desc = std::make_shared<CpuBlockedMemoryDesc>(ov::element::f32, Shape{16, 16});
+    return std::make_shared<Memory>(eng, desc);
+}
+}  // namespace
+
+TEST(WeightsSharingTest, TotalSize) {
+    WeightsSharing cache;
+    size_t created = 0;
+    auto create = [&created]() {
+        created++;
+        return createMemory();
+    };
+
+    auto memory = MemoryPtr(*cache.findOrCreate("key", create));
+    auto sameMemory = MemoryPtr(*cache.findOrCreate("key", create));
+    ASSERT_EQ(created, 1U);
+    ASSERT_EQ(memory, sameMemory);
+    ASSERT_EQ(cache.totalSize(), 16U * 16U * sizeof(float));
+
+    memory.reset();
+    sameMemory.reset();
+    ASSERT_EQ(cache.totalSize(), 0U);
+}
+
+TEST(WeightsSharingTest, NumaNodeReplicas) {
+    // only the NUMA nodes with CPUs get a replica, their ids are not necessarily contiguous
+    std::set<int> numaNodes;
+    for (const auto& row : ov::get_proc_type_table()) {
+        if (row[ov::PROC_NUMA_NODE_ID] >= 0) {
+            numaNodes.insert(row[ov::PROC_NUMA_NODE_ID]);
+        }
+    }
+    ASSERT_FALSE(numaNodes.empty());
+    const int numaNodeId = *numaNodes.begin();
+
+    SocketsWeights weights;
+    const auto& replica = weights.numaNode(numaNodeId);
+    ASSERT_NE(replica, nullptr);
+    ASSERT_EQ(replica->getNumaNodeId(), numaNodeId);
+    ASSERT_NE(replica, weights[0]);
+    ASSERT_EQ(weights.numaNode(*numaNodes.rbegin() + 1), nullptr);
+    ASSERT_EQ(weights.numaNode(-1), nullptr);
+
+    // the replica is bound to the node, but the content is the same
+    auto memory = MemoryPtr(*replica->findOrCreate("key", [] {
+        auto memory = createMemory();
+        memory->nullify();
+        return memory;
+    }));
+    ASSERT_EQ(memory->getDataAs<const float>()[0], 0.0F);
+
+    const auto sizes = weights.numaNodesTotalSize();
+    std::set<int> cachedNodes;
+    for (const auto& size : sizes) {
+        cachedNodes.insert(size.first);
+    }
+    ASSERT_EQ(cachedNodes, numaNodes);
+    ASSERT_EQ(sizes.at(numaNodeId), memory->getSize());
+}